@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <openssl/sha.h>
 
 #include "blocktemplate.hpp"
@@ -15,7 +16,7 @@
 #include "rpc.hpp"
 #include "coinbase.hpp"
 #include "merkle.hpp"
-#include "metal_miner.hpp"  // GPU mining interface
+#include "metal_miner.hpp"  // GPU mining session
 
 void appendUint32LE(std::vector<uint8_t>& data, uint32_t val) {
     for (int i = 0; i < 4; ++i)
@@ -73,7 +74,7 @@ int main() {
 
         std::vector<std::string> txids = { bytesToHex(coinbaseHash) };
         for (const auto& tx : tmpl.transactions)
-            txids.push_back(tx.txid);
+            txids.push_back(bytesToHex(std::vector<uint8_t>(tx.tx.txid.rbegin(), tx.tx.txid.rend())));
 
         std::vector<uint8_t> merkleRoot = calculateMerkleRoot(txids);
 
@@ -103,13 +104,15 @@ int main() {
         std::cout << "Starting GPU mining...\n";
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        uint32_t validNonce = 0;
-        std::vector<uint8_t> validHash(32);
-        uint64_t totalHashesTried = 0;
-
-        std::cout << "Launching metalMineBlock...\n";
-        bool found = metalMineBlock(header, target, 0, validNonce, validHash, totalHashesTried);
-        std::cout << "metalMineBlock finished.\n";
+        std::unique_ptr<MiningSession> session = makeMetalSession();
+        session->setJob(header, target);
+        std::cout << "Mining the first batch on " << session->describe() << "...\n";
+        MiningResult result = session->mine(0, 131072 * 8);
+        std::cout << "Batch finished.\n";
+        bool found = result.found;
+        uint32_t validNonce = result.nonce;
+        std::vector<uint8_t> validHash = result.hash;
+        uint64_t totalHashesTried = result.hashesTried;
 
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
@@ -125,8 +128,10 @@ int main() {
 
                 // Finalize full block data
                 std::vector<std::vector<uint8_t>> allTxs = { coinbaseBytes };
-                for (const auto& tx : tmpl.transactions)
-                    allTxs.push_back(hexToBytes(tx.data));
+                for (const auto& tx : tmpl.transactions) {
+                    auto raw = tmpl.txData.begin() + tx.tx.offset;
+                    allTxs.emplace_back(raw, raw + tx.tx.size);
+                }
 
                 std::vector<uint8_t> fullBlock = buildFullBlock(header, allTxs);
                 std::string blockHex = bytesToHex(fullBlock);
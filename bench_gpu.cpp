@@ -0,0 +1,105 @@
+// Checks a GPU backend's MiningSession against the CPU reference and reports its
+// rate. Built once per backend: OpenCL by default, Vulkan with -DBENCH_VULKAN.
+// Both run without a GPU, on the POCL and lavapipe CPU drivers:
+//
+//   build/bench_opencl [batches] [--easy]
+//   build/bench_vulkan [batches] [--easy]
+//
+// The first batch contains the genesis nonce and must find it with the genesis hash;
+// --easy lowers the target so every batch has hits to compare with the CPU scan.
+
+#include "cpu_dispatch.hpp"
+#include "nonce_scan.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#ifdef BENCH_VULKAN
+#include "vulkan_miner.hpp"
+#define makeGpuSession makeVulkanSession
+#else
+#include "opencl_miner.hpp"
+#define makeGpuSession makeOpenCLSession
+#endif
+
+static BlockHeader genesisHeader() {
+    std::array<uint8_t, 76> bytes = genesisHeaderPrefix();
+    auto le32 = [&](size_t at) {
+        return uint32_t(bytes[at]) | (uint32_t(bytes[at + 1]) << 8) |
+               (uint32_t(bytes[at + 2]) << 16) | (uint32_t(bytes[at + 3]) << 24);
+    };
+    BlockHeader header;
+    header.version = le32(0);
+    // Hashes in header byte order, as main.cpp's copyHashLE stores them
+    std::copy(bytes.begin() + 4, bytes.begin() + 36, header.prevBlockHash.begin());
+    std::copy(bytes.begin() + 36, bytes.begin() + 68, header.merkleRoot.begin());
+    header.timestamp = le32(68);
+    header.bits = le32(72);
+    header.nonce = 0;
+    return header;
+}
+
+static std::string hex(const std::vector<uint8_t>& bytes) {
+    std::ostringstream os;
+    for (uint8_t b : bytes) os << std::hex << std::setw(2) << std::setfill('0') << int(b);
+    return os.str();
+}
+
+int main(int argc, char** argv) {
+    int batches = 4;
+    bool easy = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--easy") easy = true;
+        else batches = std::atoi(argv[i]);
+    }
+
+    const uint32_t genesisNonce = 2083236893u;
+    const std::string genesisHash = "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f";
+    BlockHeader header = genesisHeader();
+    ScanJob job = genesisScanJob(easy ? 0x0000ffff : 0);
+    std::vector<uint8_t> target(32);
+    for (int i = 0; i < 8; ++i)
+        for (int b = 0; b < 4; ++b) target[28 - 4 * i + b] = (job.target[i] >> (8 * b)) & 0xff;
+
+    std::unique_ptr<MiningSession> session = makeGpuSession();
+    std::cout << session->describe() << "\n";
+    session->setJob(header, target);
+
+    uint32_t nonceBase = genesisNonce - 1000;
+    uint64_t total = 0;
+    double seconds = 0;
+    bool ok = true;
+    for (int batch = 0; batch < batches; ++batch) {
+        auto start = std::chrono::steady_clock::now();
+        MiningResult result = session->mine(nonceBase, 131072 * 8);
+        uint64_t tried = result.hashesTried;
+        // The first batch also warms up the driver; leave it out of the rate
+        if (batch > 0) {
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            total += tried;
+        }
+
+        // The lowest hit in the batch is the one reported
+        std::vector<uint32_t> hits;
+        scanNoncesScalar(job, nonceBase, (uint32_t)tried, hits);
+        bool expectFound = !hits.empty();
+        bool match = result.found == expectFound &&
+                     (!result.found || result.nonce == *std::min_element(hits.begin(), hits.end()));
+        if (batch == 0 && !easy) match = match && result.nonce == genesisNonce && hex(result.hash) == genesisHash;
+        ok = ok && match;
+
+        std::cout << "batch " << batch << ": " << (result.found ? "found " + std::to_string(result.nonce) : "no hit")
+                  << "  " << hex(result.hash) << (match ? "" : "  MISMATCH") << "\n";
+        nonceBase += (uint32_t)tried;
+    }
+
+    if (seconds > 0)
+        std::cout << std::fixed << std::setprecision(2) << total / seconds / 1e6 << " MH/s\n";
+    std::cout << (ok ? "OK" : "FAILED") << "\n";
+    return ok ? 0 : 1;
+}
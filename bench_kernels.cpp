@@ -0,0 +1,100 @@
+// Nonce scan kernel benchmark: runs every CPU kernel over the same nonce range
+// and reports hash rate next to the scalar baseline.
+//
+//   build/bench_kernels [nonces] [--easy]
+//
+// The default target has a zero top limb (real network difficulty), so kernels
+// take the H7 early exit; --easy uses a target that every kernel must fully compare.
+
+#include "cpu_dispatch.hpp"
+#include "midstate_utils.hpp"
+#include "nonce_scan.hpp"
+#include "sha256_avx2.hpp"
+#include "sha256_avx512.hpp"
+#include "sha256_bitslice.hpp"
+#include "sha256_ilp.hpp"
+#include "sha256_jit.hpp"
+#include "sha256_shani.hpp"
+#include "sha256_simd.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+typedef uint64_t (*ScanFn)(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+
+struct KernelEntry {
+    const char* name;
+    ScanFn fn;
+};
+
+static const KernelEntry kernels[] = {
+    {"scalar", scanNoncesScalar},
+    {"ilp2", scanNoncesILP<2>},
+    {"ilp3", scanNoncesILP<3>},
+    {"ilp4", scanNoncesILP<4>},
+    {"simd4", scanNoncesSIMD<4>},
+    {"simd8", scanNoncesSIMD<8>},
+    {"simd16", scanNoncesSIMD<16>},
+    {"avx2", scanNoncesAVX2},
+    {"avx512", scanNoncesAVX512},
+    {"shani", scanNoncesSHANI},
+    {"bitslice256", scanNoncesBitslice256},
+    {"bitslice512", scanNoncesBitslice512},
+    {"jit", scanNoncesJIT},
+};
+
+int main(int argc, char** argv) {
+    uint32_t count = 1u << 22;
+    bool easy = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--easy") easy = true;
+        else count = (uint32_t)std::strtoul(argv[i], nullptr, 0);
+    }
+
+    ScanJob job = genesisScanJob(easy ? 0x0000ffff : 0);
+    // Range ends on the genesis nonce so every kernel has one known hit to agree on
+    const uint32_t nonceStart = 2083236893u - count + 1;
+
+    std::vector<uint32_t> reference;
+    double baseline = 0;
+    std::cout << "Scanning " << count << " nonces (" << (easy ? "easy" : "network") << " target)\n";
+
+    for (const KernelEntry& k : kernels) {
+        std::vector<uint32_t> hits;
+        auto start = std::chrono::steady_clock::now();
+        uint64_t hashes = k.fn(job, nonceStart, count, hits);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double rate = hashes / seconds / 1e6;
+
+        if (baseline == 0) {
+            baseline = rate;
+            reference = hits;
+        }
+
+        std::cout << std::left << std::setw(12) << k.name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(9) << rate << " MH/s  "
+                  << std::setw(6) << rate / baseline << "x"
+                  << (hits == reference ? "" : "  MISMATCH") << "\n";
+    }
+
+    // Batch midstates, as extranonce/version rolling needs them, against one at a time
+    std::vector<uint8_t> prefixes(64 * 65536);
+    for (size_t i = 0; i < prefixes.size(); ++i) prefixes[i] = (uint8_t)(i * 2654435761u >> 24);
+    std::vector<std::array<uint32_t, 8>> midstates(prefixes.size() / 64);
+    auto start = std::chrono::steady_clock::now();
+    sha256Midstates(prefixes, midstates);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    bool midstatesMatch = true;
+    for (size_t i = 0; i < midstates.size(); ++i)
+        midstatesMatch = midstatesMatch &&
+                         midstates[i] == sha256Midstate(std::span<const uint8_t, 64>(&prefixes[i * 64], 64));
+    std::cout << std::left << std::setw(12) << "midstates" << std::right << std::fixed << std::setprecision(2)
+              << std::setw(9) << midstates.size() / seconds / 1e6 << " M/s" << (midstatesMatch ? "" : "  MISMATCH")
+              << "\n";
+
+    std::cout << "\n";
+    printCpuDispatch(cpuDispatch(), hashDispatch(), std::cout);
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Runs the Metal kernels on the CPU through metal_shim.hpp, checks them against
+// the reference double SHA-256 and reports their rate next to the native scan.
+//
+//   build/bench_metal_cpu [nonces] [--easy] [--tg threads] [--workers n]
+//
+// As in bench_kernels, the range ends on the genesis nonce; --easy uses a target
+// loose enough that many nonces hit.
+
+#include "cpu_dispatch.hpp"
+#include "gpu_job.hpp"
+#include "metal_cpu_kernels.hpp"
+#include "nonce_scan.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+static const uint32_t noNonce = 0xffffffff;
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, uint32_t count, double seconds, bool ok) {
+    std::cout << std::left << std::setw(22) << name << std::right << std::fixed
+              << std::setprecision(2) << std::setw(9) << count / seconds / 1e6 << " MH/s"
+              << (ok ? "" : "  MISMATCH") << "\n";
+}
+
+int main(int argc, char** argv) {
+    uint32_t count = 1u << 20;
+    uint32_t threadsPerThreadgroup = 256;
+    unsigned workers = 0;
+    bool easy = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--easy") easy = true;
+        else if (arg == "--tg" && i + 1 < argc) threadsPerThreadgroup = (uint32_t)std::strtoul(argv[++i], nullptr, 0);
+        else if (arg == "--workers" && i + 1 < argc) workers = (unsigned)std::strtoul(argv[++i], nullptr, 0);
+        else count = (uint32_t)std::strtoul(arg.c_str(), nullptr, 0);
+    }
+
+    ScanJob job = genesisScanJob(easy ? 0x0000ffff : 0);
+    const uint32_t nonceStart = 2083236893u - count + 1;
+    MetalCpuDevice gpu(workers);
+    std::cout << "Scanning " << count << " nonces on " << gpu.workerCount() << " workers, "
+              << threadsPerThreadgroup << " threads per threadgroup\n";
+
+    // Native reference
+    const CpuDispatch& dispatch = cpuDispatch();
+    std::vector<uint32_t> hits;
+    auto start = std::chrono::steady_clock::now();
+    dispatch.scanNonces(job, nonceStart, count, hits);
+    report(("native " + dispatch.scanKernel + " (1 thread)").c_str(), count, secondsSince(start), true);
+    auto isHit = [&](uint32_t nonce) { return std::find(hits.begin(), hits.end(), nonce) != hits.end(); };
+
+    // mineKernel.metal: the device-side reduction must match a full pass on the host.
+    // The kernel sees the result as atomic words, as on the GPU.
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "GpuResult is read as atomic words");
+    GpuResult result;
+    resetGpuResult(result, nonceStart);
+    MineKernelBuffers mine{job.midstate.data(), job.tail.data(), job.target.data(),
+                           reinterpret_cast<std::atomic<uint32_t>*>(&result), gpuCandidateCapacity, nonceStart, count};
+    // Whole threadgroups, as metal_miner.mm dispatches: the threads past count must not hash
+    uint64_t grid = (uint64_t(count) + threadsPerThreadgroup - 1) / threadsPerThreadgroup * threadsPerThreadgroup;
+    start = std::chrono::steady_clock::now();
+    runMineKernelCpu(gpu, mine, (uint32_t)std::min<uint64_t>(grid, UINT32_MAX), threadsPerThreadgroup);
+    double seconds = secondsSince(start);
+
+    // Every hit must be among the candidates (unless there are more than fit)
+    std::array<uint32_t, 8> hash;
+    uint32_t bestLimb = 0xffffffff;
+    for (uint32_t i = 0; i < count; ++i) {
+        hashHeaderNonce(job, nonceStart + i, hash);
+        bestLimb = std::min(bestLimb, __builtin_bswap32(hash[7]));
+    }
+    const uint32_t* candidates = result.candidates;
+    const uint32_t* candidatesEnd = candidates + std::min(result.candidateCount, gpuCandidateCapacity);
+    bool ok = result.hashCount == count && result.bestLimb == bestLimb && result.candidateCount >= hits.size();
+    for (uint32_t nonce : hits)
+        ok = ok && (hits.size() > gpuCandidateCapacity || std::find(candidates, candidatesEnd, nonce) != candidatesEnd);
+    report("mineKernel.metal", count, seconds, ok);
+
+    // sha256_kernel.metal works on header bytes and a little-endian byte target
+    std::array<uint8_t, 76> header = genesisHeaderPrefix();
+    uint8_t target[32];
+    for (int i = 0; i < 8; ++i)
+        for (int b = 0; b < 4; ++b) target[28 - 4 * i + b] = (job.target[i] >> (8 * b)) & 0xff;
+    std::atomic<uint32_t> resultNonce{noNonce};
+    uint8_t resultHash[32] = {};
+    Sha256KernelBuffers legacy{header.data(), target, &resultNonce, &nonceStart, resultHash};
+    start = std::chrono::steady_clock::now();
+    runSha256KernelCpu(gpu, legacy, count, threadsPerThreadgroup);
+    seconds = secondsSince(start);
+
+    ok = hits.empty() ? resultNonce == noNonce : isHit(resultNonce);
+    if (ok && !hits.empty()) {
+        hashHeaderNonce(job, resultNonce, hash);
+        for (int i = 0; i < 32; ++i) ok = ok && resultHash[i] == ((hash[i / 4] >> (24 - 8 * (i % 4))) & 0xff);
+    }
+    report("sha256_kernel.metal", count, seconds, ok);
+    return 0;
+}
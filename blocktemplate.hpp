@@ -4,19 +4,55 @@
 #include <iostream>
 #include <stdexcept>
 #include "nlohmann/json.hpp"
+#include "transaction.hpp"
 #include "utils.hpp"
 
 struct TransactionTemplate {
-    std::string data;
-    std::string txid;
+    TxView tx;      // where it sits in BlockTemplate::txData, with txid, wtxid and weight
     int fee;
 };
 
+// Decodes the "data" hex of each getblocktemplate transaction into txData, back
+// to back, then parses and hashes every one in place. A "txid" the node supplied
+// must match the computed one; throws std::runtime_error otherwise.
+inline std::vector<TxView> decodeTransactions(const nlohmann::json& txs, std::vector<uint8_t>& txData) {
+    size_t hexLength = 0;
+    for (const auto& tx : txs) {
+        if (!tx.contains("data") || !tx["data"].is_string())
+            throw std::runtime_error("Invalid or missing 'data' in transaction");
+        hexLength += tx["data"].get_ref<const std::string&>().size();
+    }
+    txData.reserve(txData.size() + hexLength / 2);
+
+    std::vector<TxView> views;
+    views.reserve(txs.size());
+    for (const auto& tx : txs) {
+        size_t offset = txData.size();
+        std::vector<uint8_t> bytes = hexToBytes(tx["data"].get_ref<const std::string&>());
+        txData.insert(txData.end(), bytes.begin(), bytes.end());
+        views.push_back(parseTransaction(txData, offset));
+        if (views.back().size != txData.size() - offset)
+            throw std::runtime_error("Trailing bytes after transaction " + std::to_string(views.size() - 1));
+    }
+    hashTransactions(txData, views);
+
+    for (size_t i = 0; i < views.size(); ++i) {
+        const auto& tx = txs[i];
+        if (tx.contains("txid") && tx["txid"].is_string()) {
+            std::vector<uint8_t> display(views[i].txid.rbegin(), views[i].txid.rend());
+            if (bytesToHex(display) != tx["txid"].get<std::string>())
+                throw std::runtime_error("txid mismatch for transaction " + std::to_string(i));
+        }
+    }
+    return views;
+}
+
 struct BlockTemplate {
     int version;
     std::vector<uint8_t> prevBlockHash;   // bytes, big-endian from hex
     std::string coinbaseAddress;
     std::vector<TransactionTemplate> transactions;
+    std::vector<uint8_t> txData;           // every transaction, serialized back to back
     uint64_t coinbaseValue;
     std::string bits;                      // hex string
     std::string target;                    // hex string (optional validation)
@@ -34,8 +70,7 @@ struct BlockTemplate {
         if (!j.contains("previousblockhash") || !j["previousblockhash"].is_string())
             throw std::runtime_error("Missing or invalid 'previousblockhash'");
 
-        std::string prevHashHex = j["previousblockhash"].get<std::string>();
-        bt.prevBlockHash = hexToBytes(prevHashHex);
+        bt.prevBlockHash = hexToBytes(j["previousblockhash"].get<std::string>());
         if (bt.prevBlockHash.size() != 32)
             throw std::runtime_error("previousBlockHash decoded length is not 32 bytes.");
 
@@ -72,24 +107,16 @@ struct BlockTemplate {
         if (!j.contains("transactions") || !j["transactions"].is_array())
             throw std::runtime_error("Missing or invalid 'transactions'");
 
-        for (const auto& tx : j["transactions"]) {
-            if (!tx.contains("data") || !tx["data"].is_string())
-                throw std::runtime_error("Invalid or missing 'data' in transaction");
-
-            if (!tx.contains("txid") || !tx["txid"].is_string())
-                throw std::runtime_error("Invalid or missing 'txid' in transaction");
-
+        const auto& txs = j["transactions"];
+        for (const auto& tx : txs) {
             if (!tx.contains("fee") || !tx["fee"].is_number_integer())
                 throw std::runtime_error("Invalid or missing 'fee' in transaction");
-
-            TransactionTemplate t;
-            t.data = tx["data"].get<std::string>();
-            t.txid = tx["txid"].get<std::string>();
-            t.fee = tx["fee"].get<int>();
-
-            bt.transactions.push_back(t);
         }
 
+        std::vector<TxView> views = decodeTransactions(txs, bt.txData);
+        for (size_t i = 0; i < views.size(); ++i)
+            bt.transactions.push_back({views[i], txs[i]["fee"].get<int>()});
+
         return bt;
     }
 };
@@ -1,514 +0,0 @@
-constant uint BSIG0_LUT[4096] = {
-    0x00000000, 0x40080400, 0x80100800, 0xc0180c00, 0x00201001, 0x40281401, 0x80301801, 0xc0381c01, 
-    0x00402002, 0x40482402, 0x80502802, 0xc0582c02, 0x00603003, 0x40683403, 0x80703803, 0xc0783c03, 
-    0x00804004, 0x40884404, 0x80904804, 0xc0984c04, 0x00a05005, 0x40a85405, 0x80b05805, 0xc0b85c05, 
-    0x00c06006, 0x40c86406, 0x80d06806, 0xc0d86c06, 0x00e07007, 0x40e87407, 0x80f07807, 0xc0f87c07, 
-    0x01008008, 0x41088408, 0x81108808, 0xc1188c08, 0x01209009, 0x41289409, 0x81309809, 0xc1389c09, 
-    0x0140a00a, 0x4148a40a, 0x8150a80a, 0xc158ac0a, 0x0160b00b, 0x4168b40b, 0x8170b80b, 0xc178bc0b, 
-    0x0180c00c, 0x4188c40c, 0x8190c80c, 0xc198cc0c, 0x01a0d00d, 0x41a8d40d, 0x81b0d80d, 0xc1b8dc0d, 
-    0x01c0e00e, 0x41c8e40e, 0x81d0e80e, 0xc1d8ec0e, 0x01e0f00f, 0x41e8f40f, 0x81f0f80f, 0xc1f8fc0f, 
-    0x02010010, 0x42090410, 0x82110810, 0xc2190c10, 0x02211011, 0x42291411, 0x82311811, 0xc2391c11, 
-    0x02412012, 0x42492412, 0x82512812, 0xc2592c12, 0x02613013, 0x42693413, 0x82713813, 0xc2793c13, 
-    0x02814014, 0x42894414, 0x82914814, 0xc2994c14, 0x02a15015, 0x42a95415, 0x82b15815, 0xc2b95c15, 
-    0x02c16016, 0x42c96416, 0x82d16816, 0xc2d96c16, 0x02e17017, 0x42e97417, 0x82f17817, 0xc2f97c17, 
-    0x03018018, 0x43098418, 0x83118818, 0xc3198c18, 0x03219019, 0x43299419, 0x83319819, 0xc3399c19, 
-    0x0341a01a, 0x4349a41a, 0x8351a81a, 0xc359ac1a, 0x0361b01b, 0x4369b41b, 0x8371b81b, 0xc379bc1b, 
-    0x0381c01c, 0x4389c41c, 0x8391c81c, 0xc399cc1c, 0x03a1d01d, 0x43a9d41d, 0x83b1d81d, 0xc3b9dc1d, 
-    0x03c1e01e, 0x43c9e41e, 0x83d1e81e, 0xc3d9ec1e, 0x03e1f01f, 0x43e9f41f, 0x83f1f81f, 0xc3f9fc1f, 
-    0x04020020, 0x440a0420, 0x84120820, 0xc41a0c20, 0x04221021, 0x442a1421, 0x84321821, 0xc43a1c21, 
-    0x04422022, 0x444a2422, 0x84522822, 0xc45a2c22, 0x04623023, 0x446a3423, 0x84723823, 0xc47a3c23, 
-    0x04824024, 0x448a4424, 0x84924824, 0xc49a4c24, 0x04a25025, 0x44aa5425, 0x84b25825, 0xc4ba5c25, 
-    0x04c26026, 0x44ca6426, 0x84d26826, 0xc4da6c26, 0x04e27027, 0x44ea7427, 0x84f27827, 0xc4fa7c27, 
-    0x05028028, 0x450a8428, 0x85128828, 0xc51a8c28, 0x05229029, 0x452a9429, 0x85329829, 0xc53a9c29, 
-    0x0542a02a, 0x454aa42a, 0x8552a82a, 0xc55aac2a, 0x0562b02b, 0x456ab42b, 0x8572b82b, 0xc57abc2b, 
-    0x0582c02c, 0x458ac42c, 0x8592c82c, 0xc59acc2c, 0x05a2d02d, 0x45aad42d, 0x85b2d82d, 0xc5badc2d, 
-    0x05c2e02e, 0x45cae42e, 0x85d2e82e, 0xc5daec2e, 0x05e2f02f, 0x45eaf42f, 0x85f2f82f, 0xc5fafc2f, 
-    0x06030030, 0x460b0430, 0x86130830, 0xc61b0c30, 0x06231031, 0x462b1431, 0x86331831, 0xc63b1c31, 
-    0x06432032, 0x464b2432, 0x86532832, 0xc65b2c32, 0x06633033, 0x466b3433, 0x86733833, 0xc67b3c33, 
-    0x06834034, 0x468b4434, 0x86934834, 0xc69b4c34, 0x06a35035, 0x46ab5435, 0x86b35835, 0xc6bb5c35, 
-    0x06c36036, 0x46cb6436, 0x86d36836, 0xc6db6c36, 0x06e37037, 0x46eb7437, 0x86f37837, 0xc6fb7c37, 
-    0x07038038, 0x470b8438, 0x87138838, 0xc71b8c38, 0x07239039, 0x472b9439, 0x87339839, 0xc73b9c39, 
-    0x0743a03a, 0x474ba43a, 0x8753a83a, 0xc75bac3a, 0x0763b03b, 0x476bb43b, 0x8773b83b, 0xc77bbc3b, 
-    0x0783c03c, 0x478bc43c, 0x8793c83c, 0xc79bcc3c, 0x07a3d03d, 0x47abd43d, 0x87b3d83d, 0xc7bbdc3d, 
-    0x07c3e03e, 0x47cbe43e, 0x87d3e83e, 0xc7dbec3e, 0x07e3f03f, 0x47ebf43f, 0x87f3f83f, 0xc7fbfc3f, 
-    0x08040040, 0x480c0440, 0x88140840, 0xc81c0c40, 0x08241041, 0x482c1441, 0x88341841, 0xc83c1c41, 
-    0x08442042, 0x484c2442, 0x88542842, 0xc85c2c42, 0x08643043, 0x486c3443, 0x88743843, 0xc87c3c43, 
-    0x08844044, 0x488c4444, 0x88944844, 0xc89c4c44, 0x08a45045, 0x48ac5445, 0x88b45845, 0xc8bc5c45, 
-    0x08c46046, 0x48cc6446, 0x88d46846, 0xc8dc6c46, 0x08e47047, 0x48ec7447, 0x88f47847, 0xc8fc7c47, 
-    0x09048048, 0x490c8448, 0x89148848, 0xc91c8c48, 0x09249049, 0x492c9449, 0x89349849, 0xc93c9c49, 
-    0x0944a04a, 0x494ca44a, 0x8954a84a, 0xc95cac4a, 0x0964b04b, 0x496cb44b, 0x8974b84b, 0xc97cbc4b, 
-    0x0984c04c, 0x498cc44c, 0x8994c84c, 0xc99ccc4c, 0x09a4d04d, 0x49acd44d, 0x89b4d84d, 0xc9bcdc4d, 
-    0x09c4e04e, 0x49cce44e, 0x89d4e84e, 0xc9dcec4e, 0x09e4f04f, 0x49ecf44f, 0x89f4f84f, 0xc9fcfc4f, 
-    0x0a050050, 0x4a0d0450, 0x8a150850, 0xca1d0c50, 0x0a251051, 0x4a2d1451, 0x8a351851, 0xca3d1c51, 
-    0x0a452052, 0x4a4d2452, 0x8a552852, 0xca5d2c52, 0x0a653053, 0x4a6d3453, 0x8a753853, 0xca7d3c53, 
-    0x0a854054, 0x4a8d4454, 0x8a954854, 0xca9d4c54, 0x0aa55055, 0x4aad5455, 0x8ab55855, 0xcabd5c55, 
-    0x0ac56056, 0x4acd6456, 0x8ad56856, 0xcadd6c56, 0x0ae57057, 0x4aed7457, 0x8af57857, 0xcafd7c57, 
-    0x0b058058, 0x4b0d8458, 0x8b158858, 0xcb1d8c58, 0x0b259059, 0x4b2d9459, 0x8b359859, 0xcb3d9c59, 
-    0x0b45a05a, 0x4b4da45a, 0x8b55a85a, 0xcb5dac5a, 0x0b65b05b, 0x4b6db45b, 0x8b75b85b, 0xcb7dbc5b, 
-    0x0b85c05c, 0x4b8dc45c, 0x8b95c85c, 0xcb9dcc5c, 0x0ba5d05d, 0x4badd45d, 0x8bb5d85d, 0xcbbddc5d, 
-    0x0bc5e05e, 0x4bcde45e, 0x8bd5e85e, 0xcbddec5e, 0x0be5f05f, 0x4bedf45f, 0x8bf5f85f, 0xcbfdfc5f, 
-    0x0c060060, 0x4c0e0460, 0x8c160860, 0xcc1e0c60, 0x0c261061, 0x4c2e1461, 0x8c361861, 0xcc3e1c61, 
-    0x0c462062, 0x4c4e2462, 0x8c562862, 0xcc5e2c62, 0x0c663063, 0x4c6e3463, 0x8c763863, 0xcc7e3c63, 
-    0x0c864064, 0x4c8e4464, 0x8c964864, 0xcc9e4c64, 0x0ca65065, 0x4cae5465, 0x8cb65865, 0xccbe5c65, 
-    0x0cc66066, 0x4cce6466, 0x8cd66866, 0xccde6c66, 0x0ce67067, 0x4cee7467, 0x8cf67867, 0xccfe7c67, 
-    0x0d068068, 0x4d0e8468, 0x8d168868, 0xcd1e8c68, 0x0d269069, 0x4d2e9469, 0x8d369869, 0xcd3e9c69, 
-    0x0d46a06a, 0x4d4ea46a, 0x8d56a86a, 0xcd5eac6a, 0x0d66b06b, 0x4d6eb46b, 0x8d76b86b, 0xcd7ebc6b, 
-    0x0d86c06c, 0x4d8ec46c, 0x8d96c86c, 0xcd9ecc6c, 0x0da6d06d, 0x4daed46d, 0x8db6d86d, 0xcdbedc6d, 
-    0x0dc6e06e, 0x4dcee46e, 0x8dd6e86e, 0xcddeec6e, 0x0de6f06f, 0x4deef46f, 0x8df6f86f, 0xcdfefc6f, 
-    0x0e070070, 0x4e0f0470, 0x8e170870, 0xce1f0c70, 0x0e271071, 0x4e2f1471, 0x8e371871, 0xce3f1c71, 
-    0x0e472072, 0x4e4f2472, 0x8e572872, 0xce5f2c72, 0x0e673073, 0x4e6f3473, 0x8e773873, 0xce7f3c73, 
-    0x0e874074, 0x4e8f4474, 0x8e974874, 0xce9f4c74, 0x0ea75075, 0x4eaf5475, 0x8eb75875, 0xcebf5c75, 
-    0x0ec76076, 0x4ecf6476, 0x8ed76876, 0xcedf6c76, 0x0ee77077, 0x4eef7477, 0x8ef77877, 0xceff7c77, 
-    0x0f078078, 0x4f0f8478, 0x8f178878, 0xcf1f8c78, 0x0f279079, 0x4f2f9479, 0x8f379879, 0xcf3f9c79, 
-    0x0f47a07a, 0x4f4fa47a, 0x8f57a87a, 0xcf5fac7a, 0x0f67b07b, 0x4f6fb47b, 0x8f77b87b, 0xcf7fbc7b, 
-    0x0f87c07c, 0x4f8fc47c, 0x8f97c87c, 0xcf9fcc7c, 0x0fa7d07d, 0x4fafd47d, 0x8fb7d87d, 0xcfbfdc7d, 
-    0x0fc7e07e, 0x4fcfe47e, 0x8fd7e87e, 0xcfdfec7e, 0x0fe7f07f, 0x4feff47f, 0x8ff7f87f, 0xcffffc7f, 
-    0x10080080, 0x50000480, 0x90180880, 0xd0100c80, 0x10281081, 0x50201481, 0x90381881, 0xd0301c81, 
-    0x10482082, 0x50402482, 0x90582882, 0xd0502c82, 0x10683083, 0x50603483, 0x90783883, 0xd0703c83, 
-    0x10884084, 0x50804484, 0x90984884, 0xd0904c84, 0x10a85085, 0x50a05485, 0x90b85885, 0xd0b05c85, 
-    0x10c86086, 0x50c06486, 0x90d86886, 0xd0d06c86, 0x10e87087, 0x50e07487, 0x90f87887, 0xd0f07c87, 
-    0x11088088, 0x51008488, 0x91188888, 0xd1108c88, 0x11289089, 0x51209489, 0x91389889, 0xd1309c89, 
-    0x1148a08a, 0x5140a48a, 0x9158a88a, 0xd150ac8a, 0x1168b08b, 0x5160b48b, 0x9178b88b, 0xd170bc8b, 
-    0x1188c08c, 0x5180c48c, 0x9198c88c, 0xd190cc8c, 0x11a8d08d, 0x51a0d48d, 0x91b8d88d, 0xd1b0dc8d, 
-    0x11c8e08e, 0x51c0e48e, 0x91d8e88e, 0xd1d0ec8e, 0x11e8f08f, 0x51e0f48f, 0x91f8f88f, 0xd1f0fc8f, 
-    0x12090090, 0x52010490, 0x92190890, 0xd2110c90, 0x12291091, 0x52211491, 0x92391891, 0xd2311c91, 
-    0x12492092, 0x52412492, 0x92592892, 0xd2512c92, 0x12693093, 0x52613493, 0x92793893, 0xd2713c93, 
-    0x12894094, 0x52814494, 0x92994894, 0xd2914c94, 0x12a95095, 0x52a15495, 0x92b95895, 0xd2b15c95, 
-    0x12c96096, 0x52c16496, 0x92d96896, 0xd2d16c96, 0x12e97097, 0x52e17497, 0x92f97897, 0xd2f17c97, 
-    0x13098098, 0x53018498, 0x93198898, 0xd3118c98, 0x13299099, 0x53219499, 0x93399899, 0xd3319c99, 
-    0x1349a09a, 0x5341a49a, 0x9359a89a, 0xd351ac9a, 0x1369b09b, 0x5361b49b, 0x9379b89b, 0xd371bc9b, 
-    0x1389c09c, 0x5381c49c, 0x9399c89c, 0xd391cc9c, 0x13a9d09d, 0x53a1d49d, 0x93b9d89d, 0xd3b1dc9d, 
-    0x13c9e09e, 0x53c1e49e, 0x93d9e89e, 0xd3d1ec9e, 0x13e9f09f, 0x53e1f49f, 0x93f9f89f, 0xd3f1fc9f, 
-    0x140a00a0, 0x540204a0, 0x941a08a0, 0xd4120ca0, 0x142a10a1, 0x542214a1, 0x943a18a1, 0xd4321ca1, 
-    0x144a20a2, 0x544224a2, 0x945a28a2, 0xd4522ca2, 0x146a30a3, 0x546234a3, 0x947a38a3, 0xd4723ca3, 
-    0x148a40a4, 0x548244a4, 0x949a48a4, 0xd4924ca4, 0x14aa50a5, 0x54a254a5, 0x94ba58a5, 0xd4b25ca5, 
-    0x14ca60a6, 0x54c264a6, 0x94da68a6, 0xd4d26ca6, 0x14ea70a7, 0x54e274a7, 0x94fa78a7, 0xd4f27ca7, 
-    0x150a80a8, 0x550284a8, 0x951a88a8, 0xd5128ca8, 0x152a90a9, 0x552294a9, 0x953a98a9, 0xd5329ca9, 
-    0x154aa0aa, 0x5542a4aa, 0x955aa8aa, 0xd552acaa, 0x156ab0ab, 0x5562b4ab, 0x957ab8ab, 0xd572bcab, 
-    0x158ac0ac, 0x5582c4ac, 0x959ac8ac, 0xd592ccac, 0x15aad0ad, 0x55a2d4ad, 0x95bad8ad, 0xd5b2dcad, 
-    0x15cae0ae, 0x55c2e4ae, 0x95dae8ae, 0xd5d2ecae, 0x15eaf0af, 0x55e2f4af, 0x95faf8af, 0xd5f2fcaf, 
-    0x160b00b0, 0x560304b0, 0x961b08b0, 0xd6130cb0, 0x162b10b1, 0x562314b1, 0x963b18b1, 0xd6331cb1, 
-    0x164b20b2, 0x564324b2, 0x965b28b2, 0xd6532cb2, 0x166b30b3, 0x566334b3, 0x967b38b3, 0xd6733cb3, 
-    0x168b40b4, 0x568344b4, 0x969b48b4, 0xd6934cb4, 0x16ab50b5, 0x56a354b5, 0x96bb58b5, 0xd6b35cb5, 
-    0x16cb60b6, 0x56c364b6, 0x96db68b6, 0xd6d36cb6, 0x16eb70b7, 0x56e374b7, 0x96fb78b7, 0xd6f37cb7, 
-    0x170b80b8, 0x570384b8, 0x971b88b8, 0xd7138cb8, 0x172b90b9, 0x572394b9, 0x973b98b9, 0xd7339cb9, 
-    0x174ba0ba, 0x5743a4ba, 0x975ba8ba, 0xd753acba, 0x176bb0bb, 0x5763b4bb, 0x977bb8bb, 0xd773bcbb, 
-    0x178bc0bc, 0x5783c4bc, 0x979bc8bc, 0xd793ccbc, 0x17abd0bd, 0x57a3d4bd, 0x97bbd8bd, 0xd7b3dcbd, 
-    0x17cbe0be, 0x57c3e4be, 0x97dbe8be, 0xd7d3ecbe, 0x17ebf0bf, 0x57e3f4bf, 0x97fbf8bf, 0xd7f3fcbf, 
-    0x180c00c0, 0x580404c0, 0x981c08c0, 0xd8140cc0, 0x182c10c1, 0x582414c1, 0x983c18c1, 0xd8341cc1, 
-    0x184c20c2, 0x584424c2, 0x985c28c2, 0xd8542cc2, 0x186c30c3, 0x586434c3, 0x987c38c3, 0xd8743cc3, 
-    0x188c40c4, 0x588444c4, 0x989c48c4, 0xd8944cc4, 0x18ac50c5, 0x58a454c5, 0x98bc58c5, 0xd8b45cc5, 
-    0x18cc60c6, 0x58c464c6, 0x98dc68c6, 0xd8d46cc6, 0x18ec70c7, 0x58e474c7, 0x98fc78c7, 0xd8f47cc7, 
-    0x190c80c8, 0x590484c8, 0x991c88c8, 0xd9148cc8, 0x192c90c9, 0x592494c9, 0x993c98c9, 0xd9349cc9, 
-    0x194ca0ca, 0x5944a4ca, 0x995ca8ca, 0xd954acca, 0x196cb0cb, 0x5964b4cb, 0x997cb8cb, 0xd974bccb, 
-    0x198cc0cc, 0x5984c4cc, 0x999cc8cc, 0xd994cccc, 0x19acd0cd, 0x59a4d4cd, 0x99bcd8cd, 0xd9b4dccd, 
-    0x19cce0ce, 0x59c4e4ce, 0x99dce8ce, 0xd9d4ecce, 0x19ecf0cf, 0x59e4f4cf, 0x99fcf8cf, 0xd9f4fccf, 
-    0x1a0d00d0, 0x5a0504d0, 0x9a1d08d0, 0xda150cd0, 0x1a2d10d1, 0x5a2514d1, 0x9a3d18d1, 0xda351cd1, 
-    0x1a4d20d2, 0x5a4524d2, 0x9a5d28d2, 0xda552cd2, 0x1a6d30d3, 0x5a6534d3, 0x9a7d38d3, 0xda753cd3, 
-    0x1a8d40d4, 0x5a8544d4, 0x9a9d48d4, 0xda954cd4, 0x1aad50d5, 0x5aa554d5, 0x9abd58d5, 0xdab55cd5, 
-    0x1acd60d6, 0x5ac564d6, 0x9add68d6, 0xdad56cd6, 0x1aed70d7, 0x5ae574d7, 0x9afd78d7, 0xdaf57cd7, 
-    0x1b0d80d8, 0x5b0584d8, 0x9b1d88d8, 0xdb158cd8, 0x1b2d90d9, 0x5b2594d9, 0x9b3d98d9, 0xdb359cd9, 
-    0x1b4da0da, 0x5b45a4da, 0x9b5da8da, 0xdb55acda, 0x1b6db0db, 0x5b65b4db, 0x9b7db8db, 0xdb75bcdb, 
-    0x1b8dc0dc, 0x5b85c4dc, 0x9b9dc8dc, 0xdb95ccdc, 0x1badd0dd, 0x5ba5d4dd, 0x9bbdd8dd, 0xdbb5dcdd, 
-    0x1bcde0de, 0x5bc5e4de, 0x9bdde8de, 0xdbd5ecde, 0x1bedf0df, 0x5be5f4df, 0x9bfdf8df, 0xdbf5fcdf, 
-    0x1c0e00e0, 0x5c0604e0, 0x9c1e08e0, 0xdc160ce0, 0x1c2e10e1, 0x5c2614e1, 0x9c3e18e1, 0xdc361ce1, 
-    0x1c4e20e2, 0x5c4624e2, 0x9c5e28e2, 0xdc562ce2, 0x1c6e30e3, 0x5c6634e3, 0x9c7e38e3, 0xdc763ce3, 
-    0x1c8e40e4, 0x5c8644e4, 0x9c9e48e4, 0xdc964ce4, 0x1cae50e5, 0x5ca654e5, 0x9cbe58e5, 0xdcb65ce5, 
-    0x1cce60e6, 0x5cc664e6, 0x9cde68e6, 0xdcd66ce6, 0x1cee70e7, 0x5ce674e7, 0x9cfe78e7, 0xdcf67ce7, 
-    0x1d0e80e8, 0x5d0684e8, 0x9d1e88e8, 0xdd168ce8, 0x1d2e90e9, 0x5d2694e9, 0x9d3e98e9, 0xdd369ce9, 
-    0x1d4ea0ea, 0x5d46a4ea, 0x9d5ea8ea, 0xdd56acea, 0x1d6eb0eb, 0x5d66b4eb, 0x9d7eb8eb, 0xdd76bceb, 
-    0x1d8ec0ec, 0x5d86c4ec, 0x9d9ec8ec, 0xdd96ccec, 0x1daed0ed, 0x5da6d4ed, 0x9dbed8ed, 0xddb6dced, 
-    0x1dcee0ee, 0x5dc6e4ee, 0x9ddee8ee, 0xddd6ecee, 0x1deef0ef, 0x5de6f4ef, 0x9dfef8ef, 0xddf6fcef, 
-    0x1e0f00f0, 0x5e0704f0, 0x9e1f08f0, 0xde170cf0, 0x1e2f10f1, 0x5e2714f1, 0x9e3f18f1, 0xde371cf1, 
-    0x1e4f20f2, 0x5e4724f2, 0x9e5f28f2, 0xde572cf2, 0x1e6f30f3, 0x5e6734f3, 0x9e7f38f3, 0xde773cf3, 
-    0x1e8f40f4, 0x5e8744f4, 0x9e9f48f4, 0xde974cf4, 0x1eaf50f5, 0x5ea754f5, 0x9ebf58f5, 0xdeb75cf5, 
-    0x1ecf60f6, 0x5ec764f6, 0x9edf68f6, 0xded76cf6, 0x1eef70f7, 0x5ee774f7, 0x9eff78f7, 0xdef77cf7, 
-    0x1f0f80f8, 0x5f0784f8, 0x9f1f88f8, 0xdf178cf8, 0x1f2f90f9, 0x5f2794f9, 0x9f3f98f9, 0xdf379cf9, 
-    0x1f4fa0fa, 0x5f47a4fa, 0x9f5fa8fa, 0xdf57acfa, 0x1f6fb0fb, 0x5f67b4fb, 0x9f7fb8fb, 0xdf77bcfb, 
-    0x1f8fc0fc, 0x5f87c4fc, 0x9f9fc8fc, 0xdf97ccfc, 0x1fafd0fd, 0x5fa7d4fd, 0x9fbfd8fd, 0xdfb7dcfd, 
-    0x1fcfe0fe, 0x5fc7e4fe, 0x9fdfe8fe, 0xdfd7ecfe, 0x1feff0ff, 0x5fe7f4ff, 0x9ffff8ff, 0xdff7fcff, 
-    0x20100100, 0x60180500, 0xa0000900, 0xe0080d00, 0x20301101, 0x60381501, 0xa0201901, 0xe0281d01, 
-    0x20502102, 0x60582502, 0xa0402902, 0xe0482d02, 0x20703103, 0x60783503, 0xa0603903, 0xe0683d03, 
-    0x20904104, 0x60984504, 0xa0804904, 0xe0884d04, 0x20b05105, 0x60b85505, 0xa0a05905, 0xe0a85d05, 
-    0x20d06106, 0x60d86506, 0xa0c06906, 0xe0c86d06, 0x20f07107, 0x60f87507, 0xa0e07907, 0xe0e87d07, 
-    0x21108108, 0x61188508, 0xa1008908, 0xe1088d08, 0x21309109, 0x61389509, 0xa1209909, 0xe1289d09, 
-    0x2150a10a, 0x6158a50a, 0xa140a90a, 0xe148ad0a, 0x2170b10b, 0x6178b50b, 0xa160b90b, 0xe168bd0b, 
-    0x2190c10c, 0x6198c50c, 0xa180c90c, 0xe188cd0c, 0x21b0d10d, 0x61b8d50d, 0xa1a0d90d, 0xe1a8dd0d, 
-    0x21d0e10e, 0x61d8e50e, 0xa1c0e90e, 0xe1c8ed0e, 0x21f0f10f, 0x61f8f50f, 0xa1e0f90f, 0xe1e8fd0f, 
-    0x22110110, 0x62190510, 0xa2010910, 0xe2090d10, 0x22311111, 0x62391511, 0xa2211911, 0xe2291d11, 
-    0x22512112, 0x62592512, 0xa2412912, 0xe2492d12, 0x22713113, 0x62793513, 0xa2613913, 0xe2693d13, 
-    0x22914114, 0x62994514, 0xa2814914, 0xe2894d14, 0x22b15115, 0x62b95515, 0xa2a15915, 0xe2a95d15, 
-    0x22d16116, 0x62d96516, 0xa2c16916, 0xe2c96d16, 0x22f17117, 0x62f97517, 0xa2e17917, 0xe2e97d17, 
-    0x23118118, 0x63198518, 0xa3018918, 0xe3098d18, 0x23319119, 0x63399519, 0xa3219919, 0xe3299d19, 
-    0x2351a11a, 0x6359a51a, 0xa341a91a, 0xe349ad1a, 0x2371b11b, 0x6379b51b, 0xa361b91b, 0xe369bd1b, 
-    0x2391c11c, 0x6399c51c, 0xa381c91c, 0xe389cd1c, 0x23b1d11d, 0x63b9d51d, 0xa3a1d91d, 0xe3a9dd1d, 
-    0x23d1e11e, 0x63d9e51e, 0xa3c1e91e, 0xe3c9ed1e, 0x23f1f11f, 0x63f9f51f, 0xa3e1f91f, 0xe3e9fd1f, 
-    0x24120120, 0x641a0520, 0xa4020920, 0xe40a0d20, 0x24321121, 0x643a1521, 0xa4221921, 0xe42a1d21, 
-    0x24522122, 0x645a2522, 0xa4422922, 0xe44a2d22, 0x24723123, 0x647a3523, 0xa4623923, 0xe46a3d23, 
-    0x24924124, 0x649a4524, 0xa4824924, 0xe48a4d24, 0x24b25125, 0x64ba5525, 0xa4a25925, 0xe4aa5d25, 
-    0x24d26126, 0x64da6526, 0xa4c26926, 0xe4ca6d26, 0x24f27127, 0x64fa7527, 0xa4e27927, 0xe4ea7d27, 
-    0x25128128, 0x651a8528, 0xa5028928, 0xe50a8d28, 0x25329129, 0x653a9529, 0xa5229929, 0xe52a9d29, 
-    0x2552a12a, 0x655aa52a, 0xa542a92a, 0xe54aad2a, 0x2572b12b, 0x657ab52b, 0xa562b92b, 0xe56abd2b, 
-    0x2592c12c, 0x659ac52c, 0xa582c92c, 0xe58acd2c, 0x25b2d12d, 0x65bad52d, 0xa5a2d92d, 0xe5aadd2d, 
-    0x25d2e12e, 0x65dae52e, 0xa5c2e92e, 0xe5caed2e, 0x25f2f12f, 0x65faf52f, 0xa5e2f92f, 0xe5eafd2f, 
-    0x26130130, 0x661b0530, 0xa6030930, 0xe60b0d30, 0x26331131, 0x663b1531, 0xa6231931, 0xe62b1d31, 
-    0x26532132, 0x665b2532, 0xa6432932, 0xe64b2d32, 0x26733133, 0x667b3533, 0xa6633933, 0xe66b3d33, 
-    0x26934134, 0x669b4534, 0xa6834934, 0xe68b4d34, 0x26b35135, 0x66bb5535, 0xa6a35935, 0xe6ab5d35, 
-    0x26d36136, 0x66db6536, 0xa6c36936, 0xe6cb6d36, 0x26f37137, 0x66fb7537, 0xa6e37937, 0xe6eb7d37, 
-    0x27138138, 0x671b8538, 0xa7038938, 0xe70b8d38, 0x27339139, 0x673b9539, 0xa7239939, 0xe72b9d39, 
-    0x2753a13a, 0x675ba53a, 0xa743a93a, 0xe74bad3a, 0x2773b13b, 0x677bb53b, 0xa763b93b, 0xe76bbd3b, 
-    0x2793c13c, 0x679bc53c, 0xa783c93c, 0xe78bcd3c, 0x27b3d13d, 0x67bbd53d, 0xa7a3d93d, 0xe7abdd3d, 
-    0x27d3e13e, 0x67dbe53e, 0xa7c3e93e, 0xe7cbed3e, 0x27f3f13f, 0x67fbf53f, 0xa7e3f93f, 0xe7ebfd3f, 
-    0x28140140, 0x681c0540, 0xa8040940, 0xe80c0d40, 0x28341141, 0x683c1541, 0xa8241941, 0xe82c1d41, 
-    0x28542142, 0x685c2542, 0xa8442942, 0xe84c2d42, 0x28743143, 0x687c3543, 0xa8643943, 0xe86c3d43, 
-    0x28944144, 0x689c4544, 0xa8844944, 0xe88c4d44, 0x28b45145, 0x68bc5545, 0xa8a45945, 0xe8ac5d45, 
-    0x28d46146, 0x68dc6546, 0xa8c46946, 0xe8cc6d46, 0x28f47147, 0x68fc7547, 0xa8e47947, 0xe8ec7d47, 
-    0x29148148, 0x691c8548, 0xa9048948, 0xe90c8d48, 0x29349149, 0x693c9549, 0xa9249949, 0xe92c9d49, 
-    0x2954a14a, 0x695ca54a, 0xa944a94a, 0xe94cad4a, 0x2974b14b, 0x697cb54b, 0xa964b94b, 0xe96cbd4b, 
-    0x2994c14c, 0x699cc54c, 0xa984c94c, 0xe98ccd4c, 0x29b4d14d, 0x69bcd54d, 0xa9a4d94d, 0xe9acdd4d, 
-    0x29d4e14e, 0x69dce54e, 0xa9c4e94e, 0xe9cced4e, 0x29f4f14f, 0x69fcf54f, 0xa9e4f94f, 0xe9ecfd4f, 
-    0x2a150150, 0x6a1d0550, 0xaa050950, 0xea0d0d50, 0x2a351151, 0x6a3d1551, 0xaa251951, 0xea2d1d51, 
-    0x2a552152, 0x6a5d2552, 0xaa452952, 0xea4d2d52, 0x2a753153, 0x6a7d3553, 0xaa653953, 0xea6d3d53, 
-    0x2a954154, 0x6a9d4554, 0xaa854954, 0xea8d4d54, 0x2ab55155, 0x6abd5555, 0xaaa55955, 0xeaad5d55, 
-    0x2ad56156, 0x6add6556, 0xaac56956, 0xeacd6d56, 0x2af57157, 0x6afd7557, 0xaae57957, 0xeaed7d57, 
-    0x2b158158, 0x6b1d8558, 0xab058958, 0xeb0d8d58, 0x2b359159, 0x6b3d9559, 0xab259959, 0xeb2d9d59, 
-    0x2b55a15a, 0x6b5da55a, 0xab45a95a, 0xeb4dad5a, 0x2b75b15b, 0x6b7db55b, 0xab65b95b, 0xeb6dbd5b, 
-    0x2b95c15c, 0x6b9dc55c, 0xab85c95c, 0xeb8dcd5c, 0x2bb5d15d, 0x6bbdd55d, 0xaba5d95d, 0xebaddd5d, 
-    0x2bd5e15e, 0x6bdde55e, 0xabc5e95e, 0xebcded5e, 0x2bf5f15f, 0x6bfdf55f, 0xabe5f95f, 0xebedfd5f, 
-    0x2c160160, 0x6c1e0560, 0xac060960, 0xec0e0d60, 0x2c361161, 0x6c3e1561, 0xac261961, 0xec2e1d61, 
-    0x2c562162, 0x6c5e2562, 0xac462962, 0xec4e2d62, 0x2c763163, 0x6c7e3563, 0xac663963, 0xec6e3d63, 
-    0x2c964164, 0x6c9e4564, 0xac864964, 0xec8e4d64, 0x2cb65165, 0x6cbe5565, 0xaca65965, 0xecae5d65, 
-    0x2cd66166, 0x6cde6566, 0xacc66966, 0xecce6d66, 0x2cf67167, 0x6cfe7567, 0xace67967, 0xecee7d67, 
-    0x2d168168, 0x6d1e8568, 0xad068968, 0xed0e8d68, 0x2d369169, 0x6d3e9569, 0xad269969, 0xed2e9d69, 
-    0x2d56a16a, 0x6d5ea56a, 0xad46a96a, 0xed4ead6a, 0x2d76b16b, 0x6d7eb56b, 0xad66b96b, 0xed6ebd6b, 
-    0x2d96c16c, 0x6d9ec56c, 0xad86c96c, 0xed8ecd6c, 0x2db6d16d, 0x6dbed56d, 0xada6d96d, 0xedaedd6d, 
-    0x2dd6e16e, 0x6ddee56e, 0xadc6e96e, 0xedceed6e, 0x2df6f16f, 0x6dfef56f, 0xade6f96f, 0xedeefd6f, 
-    0x2e170170, 0x6e1f0570, 0xae070970, 0xee0f0d70, 0x2e371171, 0x6e3f1571, 0xae271971, 0xee2f1d71, 
-    0x2e572172, 0x6e5f2572, 0xae472972, 0xee4f2d72, 0x2e773173, 0x6e7f3573, 0xae673973, 0xee6f3d73, 
-    0x2e974174, 0x6e9f4574, 0xae874974, 0xee8f4d74, 0x2eb75175, 0x6ebf5575, 0xaea75975, 0xeeaf5d75, 
-    0x2ed76176, 0x6edf6576, 0xaec76976, 0xeecf6d76, 0x2ef77177, 0x6eff7577, 0xaee77977, 0xeeef7d77, 
-    0x2f178178, 0x6f1f8578, 0xaf078978, 0xef0f8d78, 0x2f379179, 0x6f3f9579, 0xaf279979, 0xef2f9d79, 
-    0x2f57a17a, 0x6f5fa57a, 0xaf47a97a, 0xef4fad7a, 0x2f77b17b, 0x6f7fb57b, 0xaf67b97b, 0xef6fbd7b, 
-    0x2f97c17c, 0x6f9fc57c, 0xaf87c97c, 0xef8fcd7c, 0x2fb7d17d, 0x6fbfd57d, 0xafa7d97d, 0xefafdd7d, 
-    0x2fd7e17e, 0x6fdfe57e, 0xafc7e97e, 0xefcfed7e, 0x2ff7f17f, 0x6ffff57f, 0xafe7f97f, 0xefeffd7f, 
-    0x30180180, 0x70100580, 0xb0080980, 0xf0000d80, 0x30381181, 0x70301581, 0xb0281981, 0xf0201d81, 
-    0x30582182, 0x70502582, 0xb0482982, 0xf0402d82, 0x30783183, 0x70703583, 0xb0683983, 0xf0603d83, 
-    0x30984184, 0x70904584, 0xb0884984, 0xf0804d84, 0x30b85185, 0x70b05585, 0xb0a85985, 0xf0a05d85, 
-    0x30d86186, 0x70d06586, 0xb0c86986, 0xf0c06d86, 0x30f87187, 0x70f07587, 0xb0e87987, 0xf0e07d87, 
-    0x31188188, 0x71108588, 0xb1088988, 0xf1008d88, 0x31389189, 0x71309589, 0xb1289989, 0xf1209d89, 
-    0x3158a18a, 0x7150a58a, 0xb148a98a, 0xf140ad8a, 0x3178b18b, 0x7170b58b, 0xb168b98b, 0xf160bd8b, 
-    0x3198c18c, 0x7190c58c, 0xb188c98c, 0xf180cd8c, 0x31b8d18d, 0x71b0d58d, 0xb1a8d98d, 0xf1a0dd8d, 
-    0x31d8e18e, 0x71d0e58e, 0xb1c8e98e, 0xf1c0ed8e, 0x31f8f18f, 0x71f0f58f, 0xb1e8f98f, 0xf1e0fd8f, 
-    0x32190190, 0x72110590, 0xb2090990, 0xf2010d90, 0x32391191, 0x72311591, 0xb2291991, 0xf2211d91, 
-    0x32592192, 0x72512592, 0xb2492992, 0xf2412d92, 0x32793193, 0x72713593, 0xb2693993, 0xf2613d93, 
-    0x32994194, 0x72914594, 0xb2894994, 0xf2814d94, 0x32b95195, 0x72b15595, 0xb2a95995, 0xf2a15d95, 
-    0x32d96196, 0x72d16596, 0xb2c96996, 0xf2c16d96, 0x32f97197, 0x72f17597, 0xb2e97997, 0xf2e17d97, 
-    0x33198198, 0x73118598, 0xb3098998, 0xf3018d98, 0x33399199, 0x73319599, 0xb3299999, 0xf3219d99, 
-    0x3359a19a, 0x7351a59a, 0xb349a99a, 0xf341ad9a, 0x3379b19b, 0x7371b59b, 0xb369b99b, 0xf361bd9b, 
-    0x3399c19c, 0x7391c59c, 0xb389c99c, 0xf381cd9c, 0x33b9d19d, 0x73b1d59d, 0xb3a9d99d, 0xf3a1dd9d, 
-    0x33d9e19e, 0x73d1e59e, 0xb3c9e99e, 0xf3c1ed9e, 0x33f9f19f, 0x73f1f59f, 0xb3e9f99f, 0xf3e1fd9f, 
-    0x341a01a0, 0x741205a0, 0xb40a09a0, 0xf4020da0, 0x343a11a1, 0x743215a1, 0xb42a19a1, 0xf4221da1, 
-    0x345a21a2, 0x745225a2, 0xb44a29a2, 0xf4422da2, 0x347a31a3, 0x747235a3, 0xb46a39a3, 0xf4623da3, 
-    0x349a41a4, 0x749245a4, 0xb48a49a4, 0xf4824da4, 0x34ba51a5, 0x74b255a5, 0xb4aa59a5, 0xf4a25da5, 
-    0x34da61a6, 0x74d265a6, 0xb4ca69a6, 0xf4c26da6, 0x34fa71a7, 0x74f275a7, 0xb4ea79a7, 0xf4e27da7, 
-    0x351a81a8, 0x751285a8, 0xb50a89a8, 0xf5028da8, 0x353a91a9, 0x753295a9, 0xb52a99a9, 0xf5229da9, 
-    0x355aa1aa, 0x7552a5aa, 0xb54aa9aa, 0xf542adaa, 0x357ab1ab, 0x7572b5ab, 0xb56ab9ab, 0xf562bdab, 
-    0x359ac1ac, 0x7592c5ac, 0xb58ac9ac, 0xf582cdac, 0x35bad1ad, 0x75b2d5ad, 0xb5aad9ad, 0xf5a2ddad, 
-    0x35dae1ae, 0x75d2e5ae, 0xb5cae9ae, 0xf5c2edae, 0x35faf1af, 0x75f2f5af, 0xb5eaf9af, 0xf5e2fdaf, 
-    0x361b01b0, 0x761305b0, 0xb60b09b0, 0xf6030db0, 0x363b11b1, 0x763315b1, 0xb62b19b1, 0xf6231db1, 
-    0x365b21b2, 0x765325b2, 0xb64b29b2, 0xf6432db2, 0x367b31b3, 0x767335b3, 0xb66b39b3, 0xf6633db3, 
-    0x369b41b4, 0x769345b4, 0xb68b49b4, 0xf6834db4, 0x36bb51b5, 0x76b355b5, 0xb6ab59b5, 0xf6a35db5, 
-    0x36db61b6, 0x76d365b6, 0xb6cb69b6, 0xf6c36db6, 0x36fb71b7, 0x76f375b7, 0xb6eb79b7, 0xf6e37db7, 
-    0x371b81b8, 0x771385b8, 0xb70b89b8, 0xf7038db8, 0x373b91b9, 0x773395b9, 0xb72b99b9, 0xf7239db9, 
-    0x375ba1ba, 0x7753a5ba, 0xb74ba9ba, 0xf743adba, 0x377bb1bb, 0x7773b5bb, 0xb76bb9bb, 0xf763bdbb, 
-    0x379bc1bc, 0x7793c5bc, 0xb78bc9bc, 0xf783cdbc, 0x37bbd1bd, 0x77b3d5bd, 0xb7abd9bd, 0xf7a3ddbd, 
-    0x37dbe1be, 0x77d3e5be, 0xb7cbe9be, 0xf7c3edbe, 0x37fbf1bf, 0x77f3f5bf, 0xb7ebf9bf, 0xf7e3fdbf, 
-    0x381c01c0, 0x781405c0, 0xb80c09c0, 0xf8040dc0, 0x383c11c1, 0x783415c1, 0xb82c19c1, 0xf8241dc1, 
-    0x385c21c2, 0x785425c2, 0xb84c29c2, 0xf8442dc2, 0x387c31c3, 0x787435c3, 0xb86c39c3, 0xf8643dc3, 
-    0x389c41c4, 0x789445c4, 0xb88c49c4, 0xf8844dc4, 0x38bc51c5, 0x78b455c5, 0xb8ac59c5, 0xf8a45dc5, 
-    0x38dc61c6, 0x78d465c6, 0xb8cc69c6, 0xf8c46dc6, 0x38fc71c7, 0x78f475c7, 0xb8ec79c7, 0xf8e47dc7, 
-    0x391c81c8, 0x791485c8, 0xb90c89c8, 0xf9048dc8, 0x393c91c9, 0x793495c9, 0xb92c99c9, 0xf9249dc9, 
-    0x395ca1ca, 0x7954a5ca, 0xb94ca9ca, 0xf944adca, 0x397cb1cb, 0x7974b5cb, 0xb96cb9cb, 0xf964bdcb, 
-    0x399cc1cc, 0x7994c5cc, 0xb98cc9cc, 0xf984cdcc, 0x39bcd1cd, 0x79b4d5cd, 0xb9acd9cd, 0xf9a4ddcd, 
-    0x39dce1ce, 0x79d4e5ce, 0xb9cce9ce, 0xf9c4edce, 0x39fcf1cf, 0x79f4f5cf, 0xb9ecf9cf, 0xf9e4fdcf, 
-    0x3a1d01d0, 0x7a1505d0, 0xba0d09d0, 0xfa050dd0, 0x3a3d11d1, 0x7a3515d1, 0xba2d19d1, 0xfa251dd1, 
-    0x3a5d21d2, 0x7a5525d2, 0xba4d29d2, 0xfa452dd2, 0x3a7d31d3, 0x7a7535d3, 0xba6d39d3, 0xfa653dd3, 
-    0x3a9d41d4, 0x7a9545d4, 0xba8d49d4, 0xfa854dd4, 0x3abd51d5, 0x7ab555d5, 0xbaad59d5, 0xfaa55dd5, 
-    0x3add61d6, 0x7ad565d6, 0xbacd69d6, 0xfac56dd6, 0x3afd71d7, 0x7af575d7, 0xbaed79d7, 0xfae57dd7, 
-    0x3b1d81d8, 0x7b1585d8, 0xbb0d89d8, 0xfb058dd8, 0x3b3d91d9, 0x7b3595d9, 0xbb2d99d9, 0xfb259dd9, 
-    0x3b5da1da, 0x7b55a5da, 0xbb4da9da, 0xfb45adda, 0x3b7db1db, 0x7b75b5db, 0xbb6db9db, 0xfb65bddb, 
-    0x3b9dc1dc, 0x7b95c5dc, 0xbb8dc9dc, 0xfb85cddc, 0x3bbdd1dd, 0x7bb5d5dd, 0xbbadd9dd, 0xfba5dddd, 
-    0x3bdde1de, 0x7bd5e5de, 0xbbcde9de, 0xfbc5edde, 0x3bfdf1df, 0x7bf5f5df, 0xbbedf9df, 0xfbe5fddf, 
-    0x3c1e01e0, 0x7c1605e0, 0xbc0e09e0, 0xfc060de0, 0x3c3e11e1, 0x7c3615e1, 0xbc2e19e1, 0xfc261de1, 
-    0x3c5e21e2, 0x7c5625e2, 0xbc4e29e2, 0xfc462de2, 0x3c7e31e3, 0x7c7635e3, 0xbc6e39e3, 0xfc663de3, 
-    0x3c9e41e4, 0x7c9645e4, 0xbc8e49e4, 0xfc864de4, 0x3cbe51e5, 0x7cb655e5, 0xbcae59e5, 0xfca65de5, 
-    0x3cde61e6, 0x7cd665e6, 0xbcce69e6, 0xfcc66de6, 0x3cfe71e7, 0x7cf675e7, 0xbcee79e7, 0xfce67de7, 
-    0x3d1e81e8, 0x7d1685e8, 0xbd0e89e8, 0xfd068de8, 0x3d3e91e9, 0x7d3695e9, 0xbd2e99e9, 0xfd269de9, 
-    0x3d5ea1ea, 0x7d56a5ea, 0xbd4ea9ea, 0xfd46adea, 0x3d7eb1eb, 0x7d76b5eb, 0xbd6eb9eb, 0xfd66bdeb, 
-    0x3d9ec1ec, 0x7d96c5ec, 0xbd8ec9ec, 0xfd86cdec, 0x3dbed1ed, 0x7db6d5ed, 0xbdaed9ed, 0xfda6dded, 
-    0x3ddee1ee, 0x7dd6e5ee, 0xbdcee9ee, 0xfdc6edee, 0x3dfef1ef, 0x7df6f5ef, 0xbdeef9ef, 0xfde6fdef, 
-    0x3e1f01f0, 0x7e1705f0, 0xbe0f09f0, 0xfe070df0, 0x3e3f11f1, 0x7e3715f1, 0xbe2f19f1, 0xfe271df1, 
-    0x3e5f21f2, 0x7e5725f2, 0xbe4f29f2, 0xfe472df2, 0x3e7f31f3, 0x7e7735f3, 0xbe6f39f3, 0xfe673df3, 
-    0x3e9f41f4, 0x7e9745f4, 0xbe8f49f4, 0xfe874df4, 0x3ebf51f5, 0x7eb755f5, 0xbeaf59f5, 0xfea75df5, 
-    0x3edf61f6, 0x7ed765f6, 0xbecf69f6, 0xfec76df6, 0x3eff71f7, 0x7ef775f7, 0xbeef79f7, 0xfee77df7, 
-    0x3f1f81f8, 0x7f1785f8, 0xbf0f89f8, 0xff078df8, 0x3f3f91f9, 0x7f3795f9, 0xbf2f99f9, 0xff279df9, 
-    0x3f5fa1fa, 0x7f57a5fa, 0xbf4fa9fa, 0xff47adfa, 0x3f7fb1fb, 0x7f77b5fb, 0xbf6fb9fb, 0xff67bdfb, 
-    0x3f9fc1fc, 0x7f97c5fc, 0xbf8fc9fc, 0xff87cdfc, 0x3fbfd1fd, 0x7fb7d5fd, 0xbfafd9fd, 0xffa7ddfd, 
-    0x3fdfe1fe, 0x7fd7e5fe, 0xbfcfe9fe, 0xffc7edfe, 0x3ffff1ff, 0x7ff7f5ff, 0xbfeff9ff, 0xffe7fdff, 
-    0x40200200, 0x00280600, 0xc0300a00, 0x80380e00, 0x40001201, 0x00081601, 0xc0101a01, 0x80181e01, 
-    0x40602202, 0x00682602, 0xc0702a02, 0x80782e02, 0x40403203, 0x00483603, 0xc0503a03, 0x80583e03, 
-    0x40a04204, 0x00a84604, 0xc0b04a04, 0x80b84e04, 0x40805205, 0x00885605, 0xc0905a05, 0x80985e05, 
-    0x40e06206, 0x00e86606, 0xc0f06a06, 0x80f86e06, 0x40c07207, 0x00c87607, 0xc0d07a07, 0x80d87e07, 
-    0x41208208, 0x01288608, 0xc1308a08, 0x81388e08, 0x41009209, 0x01089609, 0xc1109a09, 0x81189e09, 
-    0x4160a20a, 0x0168a60a, 0xc170aa0a, 0x8178ae0a, 0x4140b20b, 0x0148b60b, 0xc150ba0b, 0x8158be0b, 
-    0x41a0c20c, 0x01a8c60c, 0xc1b0ca0c, 0x81b8ce0c, 0x4180d20d, 0x0188d60d, 0xc190da0d, 0x8198de0d, 
-    0x41e0e20e, 0x01e8e60e, 0xc1f0ea0e, 0x81f8ee0e, 0x41c0f20f, 0x01c8f60f, 0xc1d0fa0f, 0x81d8fe0f, 
-    0x42210210, 0x02290610, 0xc2310a10, 0x82390e10, 0x42011211, 0x02091611, 0xc2111a11, 0x82191e11, 
-    0x42612212, 0x02692612, 0xc2712a12, 0x82792e12, 0x42413213, 0x02493613, 0xc2513a13, 0x82593e13, 
-    0x42a14214, 0x02a94614, 0xc2b14a14, 0x82b94e14, 0x42815215, 0x02895615, 0xc2915a15, 0x82995e15, 
-    0x42e16216, 0x02e96616, 0xc2f16a16, 0x82f96e16, 0x42c17217, 0x02c97617, 0xc2d17a17, 0x82d97e17, 
-    0x43218218, 0x03298618, 0xc3318a18, 0x83398e18, 0x43019219, 0x03099619, 0xc3119a19, 0x83199e19, 
-    0x4361a21a, 0x0369a61a, 0xc371aa1a, 0x8379ae1a, 0x4341b21b, 0x0349b61b, 0xc351ba1b, 0x8359be1b, 
-    0x43a1c21c, 0x03a9c61c, 0xc3b1ca1c, 0x83b9ce1c, 0x4381d21d, 0x0389d61d, 0xc391da1d, 0x8399de1d, 
-    0x43e1e21e, 0x03e9e61e, 0xc3f1ea1e, 0x83f9ee1e, 0x43c1f21f, 0x03c9f61f, 0xc3d1fa1f, 0x83d9fe1f, 
-    0x44220220, 0x042a0620, 0xc4320a20, 0x843a0e20, 0x44021221, 0x040a1621, 0xc4121a21, 0x841a1e21, 
-    0x44622222, 0x046a2622, 0xc4722a22, 0x847a2e22, 0x44423223, 0x044a3623, 0xc4523a23, 0x845a3e23, 
-    0x44a24224, 0x04aa4624, 0xc4b24a24, 0x84ba4e24, 0x44825225, 0x048a5625, 0xc4925a25, 0x849a5e25, 
-    0x44e26226, 0x04ea6626, 0xc4f26a26, 0x84fa6e26, 0x44c27227, 0x04ca7627, 0xc4d27a27, 0x84da7e27, 
-    0x45228228, 0x052a8628, 0xc5328a28, 0x853a8e28, 0x45029229, 0x050a9629, 0xc5129a29, 0x851a9e29, 
-    0x4562a22a, 0x056aa62a, 0xc572aa2a, 0x857aae2a, 0x4542b22b, 0x054ab62b, 0xc552ba2b, 0x855abe2b, 
-    0x45a2c22c, 0x05aac62c, 0xc5b2ca2c, 0x85bace2c, 0x4582d22d, 0x058ad62d, 0xc592da2d, 0x859ade2d, 
-    0x45e2e22e, 0x05eae62e, 0xc5f2ea2e, 0x85faee2e, 0x45c2f22f, 0x05caf62f, 0xc5d2fa2f, 0x85dafe2f, 
-    0x46230230, 0x062b0630, 0xc6330a30, 0x863b0e30, 0x46031231, 0x060b1631, 0xc6131a31, 0x861b1e31, 
-    0x46632232, 0x066b2632, 0xc6732a32, 0x867b2e32, 0x46433233, 0x064b3633, 0xc6533a33, 0x865b3e33, 
-    0x46a34234, 0x06ab4634, 0xc6b34a34, 0x86bb4e34, 0x46835235, 0x068b5635, 0xc6935a35, 0x869b5e35, 
-    0x46e36236, 0x06eb6636, 0xc6f36a36, 0x86fb6e36, 0x46c37237, 0x06cb7637, 0xc6d37a37, 0x86db7e37, 
-    0x47238238, 0x072b8638, 0xc7338a38, 0x873b8e38, 0x47039239, 0x070b9639, 0xc7139a39, 0x871b9e39, 
-    0x4763a23a, 0x076ba63a, 0xc773aa3a, 0x877bae3a, 0x4743b23b, 0x074bb63b, 0xc753ba3b, 0x875bbe3b, 
-    0x47a3c23c, 0x07abc63c, 0xc7b3ca3c, 0x87bbce3c, 0x4783d23d, 0x078bd63d, 0xc793da3d, 0x879bde3d, 
-    0x47e3e23e, 0x07ebe63e, 0xc7f3ea3e, 0x87fbee3e, 0x47c3f23f, 0x07cbf63f, 0xc7d3fa3f, 0x87dbfe3f, 
-    0x48240240, 0x082c0640, 0xc8340a40, 0x883c0e40, 0x48041241, 0x080c1641, 0xc8141a41, 0x881c1e41, 
-    0x48642242, 0x086c2642, 0xc8742a42, 0x887c2e42, 0x48443243, 0x084c3643, 0xc8543a43, 0x885c3e43, 
-    0x48a44244, 0x08ac4644, 0xc8b44a44, 0x88bc4e44, 0x48845245, 0x088c5645, 0xc8945a45, 0x889c5e45, 
-    0x48e46246, 0x08ec6646, 0xc8f46a46, 0x88fc6e46, 0x48c47247, 0x08cc7647, 0xc8d47a47, 0x88dc7e47, 
-    0x49248248, 0x092c8648, 0xc9348a48, 0x893c8e48, 0x49049249, 0x090c9649, 0xc9149a49, 0x891c9e49, 
-    0x4964a24a, 0x096ca64a, 0xc974aa4a, 0x897cae4a, 0x4944b24b, 0x094cb64b, 0xc954ba4b, 0x895cbe4b, 
-    0x49a4c24c, 0x09acc64c, 0xc9b4ca4c, 0x89bcce4c, 0x4984d24d, 0x098cd64d, 0xc994da4d, 0x899cde4d, 
-    0x49e4e24e, 0x09ece64e, 0xc9f4ea4e, 0x89fcee4e, 0x49c4f24f, 0x09ccf64f, 0xc9d4fa4f, 0x89dcfe4f, 
-    0x4a250250, 0x0a2d0650, 0xca350a50, 0x8a3d0e50, 0x4a051251, 0x0a0d1651, 0xca151a51, 0x8a1d1e51, 
-    0x4a652252, 0x0a6d2652, 0xca752a52, 0x8a7d2e52, 0x4a453253, 0x0a4d3653, 0xca553a53, 0x8a5d3e53, 
-    0x4aa54254, 0x0aad4654, 0xcab54a54, 0x8abd4e54, 0x4a855255, 0x0a8d5655, 0xca955a55, 0x8a9d5e55, 
-    0x4ae56256, 0x0aed6656, 0xcaf56a56, 0x8afd6e56, 0x4ac57257, 0x0acd7657, 0xcad57a57, 0x8add7e57, 
-    0x4b258258, 0x0b2d8658, 0xcb358a58, 0x8b3d8e58, 0x4b059259, 0x0b0d9659, 0xcb159a59, 0x8b1d9e59, 
-    0x4b65a25a, 0x0b6da65a, 0xcb75aa5a, 0x8b7dae5a, 0x4b45b25b, 0x0b4db65b, 0xcb55ba5b, 0x8b5dbe5b, 
-    0x4ba5c25c, 0x0badc65c, 0xcbb5ca5c, 0x8bbdce5c, 0x4b85d25d, 0x0b8dd65d, 0xcb95da5d, 0x8b9dde5d, 
-    0x4be5e25e, 0x0bede65e, 0xcbf5ea5e, 0x8bfdee5e, 0x4bc5f25f, 0x0bcdf65f, 0xcbd5fa5f, 0x8bddfe5f, 
-    0x4c260260, 0x0c2e0660, 0xcc360a60, 0x8c3e0e60, 0x4c061261, 0x0c0e1661, 0xcc161a61, 0x8c1e1e61, 
-    0x4c662262, 0x0c6e2662, 0xcc762a62, 0x8c7e2e62, 0x4c463263, 0x0c4e3663, 0xcc563a63, 0x8c5e3e63, 
-    0x4ca64264, 0x0cae4664, 0xccb64a64, 0x8cbe4e64, 0x4c865265, 0x0c8e5665, 0xcc965a65, 0x8c9e5e65, 
-    0x4ce66266, 0x0cee6666, 0xccf66a66, 0x8cfe6e66, 0x4cc67267, 0x0cce7667, 0xccd67a67, 0x8cde7e67, 
-    0x4d268268, 0x0d2e8668, 0xcd368a68, 0x8d3e8e68, 0x4d069269, 0x0d0e9669, 0xcd169a69, 0x8d1e9e69, 
-    0x4d66a26a, 0x0d6ea66a, 0xcd76aa6a, 0x8d7eae6a, 0x4d46b26b, 0x0d4eb66b, 0xcd56ba6b, 0x8d5ebe6b, 
-    0x4da6c26c, 0x0daec66c, 0xcdb6ca6c, 0x8dbece6c, 0x4d86d26d, 0x0d8ed66d, 0xcd96da6d, 0x8d9ede6d, 
-    0x4de6e26e, 0x0deee66e, 0xcdf6ea6e, 0x8dfeee6e, 0x4dc6f26f, 0x0dcef66f, 0xcdd6fa6f, 0x8ddefe6f, 
-    0x4e270270, 0x0e2f0670, 0xce370a70, 0x8e3f0e70, 0x4e071271, 0x0e0f1671, 0xce171a71, 0x8e1f1e71, 
-    0x4e672272, 0x0e6f2672, 0xce772a72, 0x8e7f2e72, 0x4e473273, 0x0e4f3673, 0xce573a73, 0x8e5f3e73, 
-    0x4ea74274, 0x0eaf4674, 0xceb74a74, 0x8ebf4e74, 0x4e875275, 0x0e8f5675, 0xce975a75, 0x8e9f5e75, 
-    0x4ee76276, 0x0eef6676, 0xcef76a76, 0x8eff6e76, 0x4ec77277, 0x0ecf7677, 0xced77a77, 0x8edf7e77, 
-    0x4f278278, 0x0f2f8678, 0xcf378a78, 0x8f3f8e78, 0x4f079279, 0x0f0f9679, 0xcf179a79, 0x8f1f9e79, 
-    0x4f67a27a, 0x0f6fa67a, 0xcf77aa7a, 0x8f7fae7a, 0x4f47b27b, 0x0f4fb67b, 0xcf57ba7b, 0x8f5fbe7b, 
-    0x4fa7c27c, 0x0fafc67c, 0xcfb7ca7c, 0x8fbfce7c, 0x4f87d27d, 0x0f8fd67d, 0xcf97da7d, 0x8f9fde7d, 
-    0x4fe7e27e, 0x0fefe67e, 0xcff7ea7e, 0x8fffee7e, 0x4fc7f27f, 0x0fcff67f, 0xcfd7fa7f, 0x8fdffe7f, 
-    0x50280280, 0x10200680, 0xd0380a80, 0x90300e80, 0x50081281, 0x10001681, 0xd0181a81, 0x90101e81, 
-    0x50682282, 0x10602682, 0xd0782a82, 0x90702e82, 0x50483283, 0x10403683, 0xd0583a83, 0x90503e83, 
-    0x50a84284, 0x10a04684, 0xd0b84a84, 0x90b04e84, 0x50885285, 0x10805685, 0xd0985a85, 0x90905e85, 
-    0x50e86286, 0x10e06686, 0xd0f86a86, 0x90f06e86, 0x50c87287, 0x10c07687, 0xd0d87a87, 0x90d07e87, 
-    0x51288288, 0x11208688, 0xd1388a88, 0x91308e88, 0x51089289, 0x11009689, 0xd1189a89, 0x91109e89, 
-    0x5168a28a, 0x1160a68a, 0xd178aa8a, 0x9170ae8a, 0x5148b28b, 0x1140b68b, 0xd158ba8b, 0x9150be8b, 
-    0x51a8c28c, 0x11a0c68c, 0xd1b8ca8c, 0x91b0ce8c, 0x5188d28d, 0x1180d68d, 0xd198da8d, 0x9190de8d, 
-    0x51e8e28e, 0x11e0e68e, 0xd1f8ea8e, 0x91f0ee8e, 0x51c8f28f, 0x11c0f68f, 0xd1d8fa8f, 0x91d0fe8f, 
-    0x52290290, 0x12210690, 0xd2390a90, 0x92310e90, 0x52091291, 0x12011691, 0xd2191a91, 0x92111e91, 
-    0x52692292, 0x12612692, 0xd2792a92, 0x92712e92, 0x52493293, 0x12413693, 0xd2593a93, 0x92513e93, 
-    0x52a94294, 0x12a14694, 0xd2b94a94, 0x92b14e94, 0x52895295, 0x12815695, 0xd2995a95, 0x92915e95, 
-    0x52e96296, 0x12e16696, 0xd2f96a96, 0x92f16e96, 0x52c97297, 0x12c17697, 0xd2d97a97, 0x92d17e97, 
-    0x53298298, 0x13218698, 0xd3398a98, 0x93318e98, 0x53099299, 0x13019699, 0xd3199a99, 0x93119e99, 
-    0x5369a29a, 0x1361a69a, 0xd379aa9a, 0x9371ae9a, 0x5349b29b, 0x1341b69b, 0xd359ba9b, 0x9351be9b, 
-    0x53a9c29c, 0x13a1c69c, 0xd3b9ca9c, 0x93b1ce9c, 0x5389d29d, 0x1381d69d, 0xd399da9d, 0x9391de9d, 
-    0x53e9e29e, 0x13e1e69e, 0xd3f9ea9e, 0x93f1ee9e, 0x53c9f29f, 0x13c1f69f, 0xd3d9fa9f, 0x93d1fe9f, 
-    0x542a02a0, 0x142206a0, 0xd43a0aa0, 0x94320ea0, 0x540a12a1, 0x140216a1, 0xd41a1aa1, 0x94121ea1, 
-    0x546a22a2, 0x146226a2, 0xd47a2aa2, 0x94722ea2, 0x544a32a3, 0x144236a3, 0xd45a3aa3, 0x94523ea3, 
-    0x54aa42a4, 0x14a246a4, 0xd4ba4aa4, 0x94b24ea4, 0x548a52a5, 0x148256a5, 0xd49a5aa5, 0x94925ea5, 
-    0x54ea62a6, 0x14e266a6, 0xd4fa6aa6, 0x94f26ea6, 0x54ca72a7, 0x14c276a7, 0xd4da7aa7, 0x94d27ea7, 
-    0x552a82a8, 0x152286a8, 0xd53a8aa8, 0x95328ea8, 0x550a92a9, 0x150296a9, 0xd51a9aa9, 0x95129ea9, 
-    0x556aa2aa, 0x1562a6aa, 0xd57aaaaa, 0x9572aeaa, 0x554ab2ab, 0x1542b6ab, 0xd55abaab, 0x9552beab, 
-    0x55aac2ac, 0x15a2c6ac, 0xd5bacaac, 0x95b2ceac, 0x558ad2ad, 0x1582d6ad, 0xd59adaad, 0x9592dead, 
-    0x55eae2ae, 0x15e2e6ae, 0xd5faeaae, 0x95f2eeae, 0x55caf2af, 0x15c2f6af, 0xd5dafaaf, 0x95d2feaf, 
-    0x562b02b0, 0x162306b0, 0xd63b0ab0, 0x96330eb0, 0x560b12b1, 0x160316b1, 0xd61b1ab1, 0x96131eb1, 
-    0x566b22b2, 0x166326b2, 0xd67b2ab2, 0x96732eb2, 0x564b32b3, 0x164336b3, 0xd65b3ab3, 0x96533eb3, 
-    0x56ab42b4, 0x16a346b4, 0xd6bb4ab4, 0x96b34eb4, 0x568b52b5, 0x168356b5, 0xd69b5ab5, 0x96935eb5, 
-    0x56eb62b6, 0x16e366b6, 0xd6fb6ab6, 0x96f36eb6, 0x56cb72b7, 0x16c376b7, 0xd6db7ab7, 0x96d37eb7, 
-    0x572b82b8, 0x172386b8, 0xd73b8ab8, 0x97338eb8, 0x570b92b9, 0x170396b9, 0xd71b9ab9, 0x97139eb9, 
-    0x576ba2ba, 0x1763a6ba, 0xd77baaba, 0x9773aeba, 0x574bb2bb, 0x1743b6bb, 0xd75bbabb, 0x9753bebb, 
-    0x57abc2bc, 0x17a3c6bc, 0xd7bbcabc, 0x97b3cebc, 0x578bd2bd, 0x1783d6bd, 0xd79bdabd, 0x9793debd, 
-    0x57ebe2be, 0x17e3e6be, 0xd7fbeabe, 0x97f3eebe, 0x57cbf2bf, 0x17c3f6bf, 0xd7dbfabf, 0x97d3febf, 
-    0x582c02c0, 0x182406c0, 0xd83c0ac0, 0x98340ec0, 0x580c12c1, 0x180416c1, 0xd81c1ac1, 0x98141ec1, 
-    0x586c22c2, 0x186426c2, 0xd87c2ac2, 0x98742ec2, 0x584c32c3, 0x184436c3, 0xd85c3ac3, 0x98543ec3, 
-    0x58ac42c4, 0x18a446c4, 0xd8bc4ac4, 0x98b44ec4, 0x588c52c5, 0x188456c5, 0xd89c5ac5, 0x98945ec5, 
-    0x58ec62c6, 0x18e466c6, 0xd8fc6ac6, 0x98f46ec6, 0x58cc72c7, 0x18c476c7, 0xd8dc7ac7, 0x98d47ec7, 
-    0x592c82c8, 0x192486c8, 0xd93c8ac8, 0x99348ec8, 0x590c92c9, 0x190496c9, 0xd91c9ac9, 0x99149ec9, 
-    0x596ca2ca, 0x1964a6ca, 0xd97caaca, 0x9974aeca, 0x594cb2cb, 0x1944b6cb, 0xd95cbacb, 0x9954becb, 
-    0x59acc2cc, 0x19a4c6cc, 0xd9bccacc, 0x99b4cecc, 0x598cd2cd, 0x1984d6cd, 0xd99cdacd, 0x9994decd, 
-    0x59ece2ce, 0x19e4e6ce, 0xd9fceace, 0x99f4eece, 0x59ccf2cf, 0x19c4f6cf, 0xd9dcfacf, 0x99d4fecf, 
-    0x5a2d02d0, 0x1a2506d0, 0xda3d0ad0, 0x9a350ed0, 0x5a0d12d1, 0x1a0516d1, 0xda1d1ad1, 0x9a151ed1, 
-    0x5a6d22d2, 0x1a6526d2, 0xda7d2ad2, 0x9a752ed2, 0x5a4d32d3, 0x1a4536d3, 0xda5d3ad3, 0x9a553ed3, 
-    0x5aad42d4, 0x1aa546d4, 0xdabd4ad4, 0x9ab54ed4, 0x5a8d52d5, 0x1a8556d5, 0xda9d5ad5, 0x9a955ed5, 
-    0x5aed62d6, 0x1ae566d6, 0xdafd6ad6, 0x9af56ed6, 0x5acd72d7, 0x1ac576d7, 0xdadd7ad7, 0x9ad57ed7, 
-    0x5b2d82d8, 0x1b2586d8, 0xdb3d8ad8, 0x9b358ed8, 0x5b0d92d9, 0x1b0596d9, 0xdb1d9ad9, 0x9b159ed9, 
-    0x5b6da2da, 0x1b65a6da, 0xdb7daada, 0x9b75aeda, 0x5b4db2db, 0x1b45b6db, 0xdb5dbadb, 0x9b55bedb, 
-    0x5badc2dc, 0x1ba5c6dc, 0xdbbdcadc, 0x9bb5cedc, 0x5b8dd2dd, 0x1b85d6dd, 0xdb9ddadd, 0x9b95dedd, 
-    0x5bede2de, 0x1be5e6de, 0xdbfdeade, 0x9bf5eede, 0x5bcdf2df, 0x1bc5f6df, 0xdbddfadf, 0x9bd5fedf, 
-    0x5c2e02e0, 0x1c2606e0, 0xdc3e0ae0, 0x9c360ee0, 0x5c0e12e1, 0x1c0616e1, 0xdc1e1ae1, 0x9c161ee1, 
-    0x5c6e22e2, 0x1c6626e2, 0xdc7e2ae2, 0x9c762ee2, 0x5c4e32e3, 0x1c4636e3, 0xdc5e3ae3, 0x9c563ee3, 
-    0x5cae42e4, 0x1ca646e4, 0xdcbe4ae4, 0x9cb64ee4, 0x5c8e52e5, 0x1c8656e5, 0xdc9e5ae5, 0x9c965ee5, 
-    0x5cee62e6, 0x1ce666e6, 0xdcfe6ae6, 0x9cf66ee6, 0x5cce72e7, 0x1cc676e7, 0xdcde7ae7, 0x9cd67ee7, 
-    0x5d2e82e8, 0x1d2686e8, 0xdd3e8ae8, 0x9d368ee8, 0x5d0e92e9, 0x1d0696e9, 0xdd1e9ae9, 0x9d169ee9, 
-    0x5d6ea2ea, 0x1d66a6ea, 0xdd7eaaea, 0x9d76aeea, 0x5d4eb2eb, 0x1d46b6eb, 0xdd5ebaeb, 0x9d56beeb, 
-    0x5daec2ec, 0x1da6c6ec, 0xddbecaec, 0x9db6ceec, 0x5d8ed2ed, 0x1d86d6ed, 0xdd9edaed, 0x9d96deed, 
-    0x5deee2ee, 0x1de6e6ee, 0xddfeeaee, 0x9df6eeee, 0x5dcef2ef, 0x1dc6f6ef, 0xdddefaef, 0x9dd6feef, 
-    0x5e2f02f0, 0x1e2706f0, 0xde3f0af0, 0x9e370ef0, 0x5e0f12f1, 0x1e0716f1, 0xde1f1af1, 0x9e171ef1, 
-    0x5e6f22f2, 0x1e6726f2, 0xde7f2af2, 0x9e772ef2, 0x5e4f32f3, 0x1e4736f3, 0xde5f3af3, 0x9e573ef3, 
-    0x5eaf42f4, 0x1ea746f4, 0xdebf4af4, 0x9eb74ef4, 0x5e8f52f5, 0x1e8756f5, 0xde9f5af5, 0x9e975ef5, 
-    0x5eef62f6, 0x1ee766f6, 0xdeff6af6, 0x9ef76ef6, 0x5ecf72f7, 0x1ec776f7, 0xdedf7af7, 0x9ed77ef7, 
-    0x5f2f82f8, 0x1f2786f8, 0xdf3f8af8, 0x9f378ef8, 0x5f0f92f9, 0x1f0796f9, 0xdf1f9af9, 0x9f179ef9, 
-    0x5f6fa2fa, 0x1f67a6fa, 0xdf7faafa, 0x9f77aefa, 0x5f4fb2fb, 0x1f47b6fb, 0xdf5fbafb, 0x9f57befb, 
-    0x5fafc2fc, 0x1fa7c6fc, 0xdfbfcafc, 0x9fb7cefc, 0x5f8fd2fd, 0x1f87d6fd, 0xdf9fdafd, 0x9f97defd, 
-    0x5fefe2fe, 0x1fe7e6fe, 0xdfffeafe, 0x9ff7eefe, 0x5fcff2ff, 0x1fc7f6ff, 0xdfdffaff, 0x9fd7feff, 
-    0x60300300, 0x20380700, 0xe0200b00, 0xa0280f00, 0x60101301, 0x20181701, 0xe0001b01, 0xa0081f01, 
-    0x60702302, 0x20782702, 0xe0602b02, 0xa0682f02, 0x60503303, 0x20583703, 0xe0403b03, 0xa0483f03, 
-    0x60b04304, 0x20b84704, 0xe0a04b04, 0xa0a84f04, 0x60905305, 0x20985705, 0xe0805b05, 0xa0885f05, 
-    0x60f06306, 0x20f86706, 0xe0e06b06, 0xa0e86f06, 0x60d07307, 0x20d87707, 0xe0c07b07, 0xa0c87f07, 
-    0x61308308, 0x21388708, 0xe1208b08, 0xa1288f08, 0x61109309, 0x21189709, 0xe1009b09, 0xa1089f09, 
-    0x6170a30a, 0x2178a70a, 0xe160ab0a, 0xa168af0a, 0x6150b30b, 0x2158b70b, 0xe140bb0b, 0xa148bf0b, 
-    0x61b0c30c, 0x21b8c70c, 0xe1a0cb0c, 0xa1a8cf0c, 0x6190d30d, 0x2198d70d, 0xe180db0d, 0xa188df0d, 
-    0x61f0e30e, 0x21f8e70e, 0xe1e0eb0e, 0xa1e8ef0e, 0x61d0f30f, 0x21d8f70f, 0xe1c0fb0f, 0xa1c8ff0f, 
-    0x62310310, 0x22390710, 0xe2210b10, 0xa2290f10, 0x62111311, 0x22191711, 0xe2011b11, 0xa2091f11, 
-    0x62712312, 0x22792712, 0xe2612b12, 0xa2692f12, 0x62513313, 0x22593713, 0xe2413b13, 0xa2493f13, 
-    0x62b14314, 0x22b94714, 0xe2a14b14, 0xa2a94f14, 0x62915315, 0x22995715, 0xe2815b15, 0xa2895f15, 
-    0x62f16316, 0x22f96716, 0xe2e16b16, 0xa2e96f16, 0x62d17317, 0x22d97717, 0xe2c17b17, 0xa2c97f17, 
-    0x63318318, 0x23398718, 0xe3218b18, 0xa3298f18, 0x63119319, 0x23199719, 0xe3019b19, 0xa3099f19, 
-    0x6371a31a, 0x2379a71a, 0xe361ab1a, 0xa369af1a, 0x6351b31b, 0x2359b71b, 0xe341bb1b, 0xa349bf1b, 
-    0x63b1c31c, 0x23b9c71c, 0xe3a1cb1c, 0xa3a9cf1c, 0x6391d31d, 0x2399d71d, 0xe381db1d, 0xa389df1d, 
-    0x63f1e31e, 0x23f9e71e, 0xe3e1eb1e, 0xa3e9ef1e, 0x63d1f31f, 0x23d9f71f, 0xe3c1fb1f, 0xa3c9ff1f, 
-    0x64320320, 0x243a0720, 0xe4220b20, 0xa42a0f20, 0x64121321, 0x241a1721, 0xe4021b21, 0xa40a1f21, 
-    0x64722322, 0x247a2722, 0xe4622b22, 0xa46a2f22, 0x64523323, 0x245a3723, 0xe4423b23, 0xa44a3f23, 
-    0x64b24324, 0x24ba4724, 0xe4a24b24, 0xa4aa4f24, 0x64925325, 0x249a5725, 0xe4825b25, 0xa48a5f25, 
-    0x64f26326, 0x24fa6726, 0xe4e26b26, 0xa4ea6f26, 0x64d27327, 0x24da7727, 0xe4c27b27, 0xa4ca7f27, 
-    0x65328328, 0x253a8728, 0xe5228b28, 0xa52a8f28, 0x65129329, 0x251a9729, 0xe5029b29, 0xa50a9f29, 
-    0x6572a32a, 0x257aa72a, 0xe562ab2a, 0xa56aaf2a, 0x6552b32b, 0x255ab72b, 0xe542bb2b, 0xa54abf2b, 
-    0x65b2c32c, 0x25bac72c, 0xe5a2cb2c, 0xa5aacf2c, 0x6592d32d, 0x259ad72d, 0xe582db2d, 0xa58adf2d, 
-    0x65f2e32e, 0x25fae72e, 0xe5e2eb2e, 0xa5eaef2e, 0x65d2f32f, 0x25daf72f, 0xe5c2fb2f, 0xa5caff2f, 
-    0x66330330, 0x263b0730, 0xe6230b30, 0xa62b0f30, 0x66131331, 0x261b1731, 0xe6031b31, 0xa60b1f31, 
-    0x66732332, 0x267b2732, 0xe6632b32, 0xa66b2f32, 0x66533333, 0x265b3733, 0xe6433b33, 0xa64b3f33, 
-    0x66b34334, 0x26bb4734, 0xe6a34b34, 0xa6ab4f34, 0x66935335, 0x269b5735, 0xe6835b35, 0xa68b5f35, 
-    0x66f36336, 0x26fb6736, 0xe6e36b36, 0xa6eb6f36, 0x66d37337, 0x26db7737, 0xe6c37b37, 0xa6cb7f37, 
-    0x67338338, 0x273b8738, 0xe7238b38, 0xa72b8f38, 0x67139339, 0x271b9739, 0xe7039b39, 0xa70b9f39, 
-    0x6773a33a, 0x277ba73a, 0xe763ab3a, 0xa76baf3a, 0x6753b33b, 0x275bb73b, 0xe743bb3b, 0xa74bbf3b, 
-    0x67b3c33c, 0x27bbc73c, 0xe7a3cb3c, 0xa7abcf3c, 0x6793d33d, 0x279bd73d, 0xe783db3d, 0xa78bdf3d, 
-    0x67f3e33e, 0x27fbe73e, 0xe7e3eb3e, 0xa7ebef3e, 0x67d3f33f, 0x27dbf73f, 0xe7c3fb3f, 0xa7cbff3f, 
-    0x68340340, 0x283c0740, 0xe8240b40, 0xa82c0f40, 0x68141341, 0x281c1741, 0xe8041b41, 0xa80c1f41, 
-    0x68742342, 0x287c2742, 0xe8642b42, 0xa86c2f42, 0x68543343, 0x285c3743, 0xe8443b43, 0xa84c3f43, 
-    0x68b44344, 0x28bc4744, 0xe8a44b44, 0xa8ac4f44, 0x68945345, 0x289c5745, 0xe8845b45, 0xa88c5f45, 
-    0x68f46346, 0x28fc6746, 0xe8e46b46, 0xa8ec6f46, 0x68d47347, 0x28dc7747, 0xe8c47b47, 0xa8cc7f47, 
-    0x69348348, 0x293c8748, 0xe9248b48, 0xa92c8f48, 0x69149349, 0x291c9749, 0xe9049b49, 0xa90c9f49, 
-    0x6974a34a, 0x297ca74a, 0xe964ab4a, 0xa96caf4a, 0x6954b34b, 0x295cb74b, 0xe944bb4b, 0xa94cbf4b, 
-    0x69b4c34c, 0x29bcc74c, 0xe9a4cb4c, 0xa9accf4c, 0x6994d34d, 0x299cd74d, 0xe984db4d, 0xa98cdf4d, 
-    0x69f4e34e, 0x29fce74e, 0xe9e4eb4e, 0xa9ecef4e, 0x69d4f34f, 0x29dcf74f, 0xe9c4fb4f, 0xa9ccff4f, 
-    0x6a350350, 0x2a3d0750, 0xea250b50, 0xaa2d0f50, 0x6a151351, 0x2a1d1751, 0xea051b51, 0xaa0d1f51, 
-    0x6a752352, 0x2a7d2752, 0xea652b52, 0xaa6d2f52, 0x6a553353, 0x2a5d3753, 0xea453b53, 0xaa4d3f53, 
-    0x6ab54354, 0x2abd4754, 0xeaa54b54, 0xaaad4f54, 0x6a955355, 0x2a9d5755, 0xea855b55, 0xaa8d5f55, 
-    0x6af56356, 0x2afd6756, 0xeae56b56, 0xaaed6f56, 0x6ad57357, 0x2add7757, 0xeac57b57, 0xaacd7f57, 
-    0x6b358358, 0x2b3d8758, 0xeb258b58, 0xab2d8f58, 0x6b159359, 0x2b1d9759, 0xeb059b59, 0xab0d9f59, 
-    0x6b75a35a, 0x2b7da75a, 0xeb65ab5a, 0xab6daf5a, 0x6b55b35b, 0x2b5db75b, 0xeb45bb5b, 0xab4dbf5b, 
-    0x6bb5c35c, 0x2bbdc75c, 0xeba5cb5c, 0xabadcf5c, 0x6b95d35d, 0x2b9dd75d, 0xeb85db5d, 0xab8ddf5d, 
-    0x6bf5e35e, 0x2bfde75e, 0xebe5eb5e, 0xabedef5e, 0x6bd5f35f, 0x2bddf75f, 0xebc5fb5f, 0xabcdff5f, 
-    0x6c360360, 0x2c3e0760, 0xec260b60, 0xac2e0f60, 0x6c161361, 0x2c1e1761, 0xec061b61, 0xac0e1f61, 
-    0x6c762362, 0x2c7e2762, 0xec662b62, 0xac6e2f62, 0x6c563363, 0x2c5e3763, 0xec463b63, 0xac4e3f63, 
-    0x6cb64364, 0x2cbe4764, 0xeca64b64, 0xacae4f64, 0x6c965365, 0x2c9e5765, 0xec865b65, 0xac8e5f65, 
-    0x6cf66366, 0x2cfe6766, 0xece66b66, 0xacee6f66, 0x6cd67367, 0x2cde7767, 0xecc67b67, 0xacce7f67, 
-    0x6d368368, 0x2d3e8768, 0xed268b68, 0xad2e8f68, 0x6d169369, 0x2d1e9769, 0xed069b69, 0xad0e9f69, 
-    0x6d76a36a, 0x2d7ea76a, 0xed66ab6a, 0xad6eaf6a, 0x6d56b36b, 0x2d5eb76b, 0xed46bb6b, 0xad4ebf6b, 
-    0x6db6c36c, 0x2dbec76c, 0xeda6cb6c, 0xadaecf6c, 0x6d96d36d, 0x2d9ed76d, 0xed86db6d, 0xad8edf6d, 
-    0x6df6e36e, 0x2dfee76e, 0xede6eb6e, 0xadeeef6e, 0x6dd6f36f, 0x2ddef76f, 0xedc6fb6f, 0xadceff6f, 
-    0x6e370370, 0x2e3f0770, 0xee270b70, 0xae2f0f70, 0x6e171371, 0x2e1f1771, 0xee071b71, 0xae0f1f71, 
-    0x6e772372, 0x2e7f2772, 0xee672b72, 0xae6f2f72, 0x6e573373, 0x2e5f3773, 0xee473b73, 0xae4f3f73, 
-    0x6eb74374, 0x2ebf4774, 0xeea74b74, 0xaeaf4f74, 0x6e975375, 0x2e9f5775, 0xee875b75, 0xae8f5f75, 
-    0x6ef76376, 0x2eff6776, 0xeee76b76, 0xaeef6f76, 0x6ed77377, 0x2edf7777, 0xeec77b77, 0xaecf7f77, 
-    0x6f378378, 0x2f3f8778, 0xef278b78, 0xaf2f8f78, 0x6f179379, 0x2f1f9779, 0xef079b79, 0xaf0f9f79, 
-    0x6f77a37a, 0x2f7fa77a, 0xef67ab7a, 0xaf6faf7a, 0x6f57b37b, 0x2f5fb77b, 0xef47bb7b, 0xaf4fbf7b, 
-    0x6fb7c37c, 0x2fbfc77c, 0xefa7cb7c, 0xafafcf7c, 0x6f97d37d, 0x2f9fd77d, 0xef87db7d, 0xaf8fdf7d, 
-    0x6ff7e37e, 0x2fffe77e, 0xefe7eb7e, 0xafefef7e, 0x6fd7f37f, 0x2fdff77f, 0xefc7fb7f, 0xafcfff7f, 
-    0x70380380, 0x30300780, 0xf0280b80, 0xb0200f80, 0x70181381, 0x30101781, 0xf0081b81, 0xb0001f81, 
-    0x70782382, 0x30702782, 0xf0682b82, 0xb0602f82, 0x70583383, 0x30503783, 0xf0483b83, 0xb0403f83, 
-    0x70b84384, 0x30b04784, 0xf0a84b84, 0xb0a04f84, 0x70985385, 0x30905785, 0xf0885b85, 0xb0805f85, 
-    0x70f86386, 0x30f06786, 0xf0e86b86, 0xb0e06f86, 0x70d87387, 0x30d07787, 0xf0c87b87, 0xb0c07f87, 
-    0x71388388, 0x31308788, 0xf1288b88, 0xb1208f88, 0x71189389, 0x31109789, 0xf1089b89, 0xb1009f89, 
-    0x7178a38a, 0x3170a78a, 0xf168ab8a, 0xb160af8a, 0x7158b38b, 0x3150b78b, 0xf148bb8b, 0xb140bf8b, 
-    0x71b8c38c, 0x31b0c78c, 0xf1a8cb8c, 0xb1a0cf8c, 0x7198d38d, 0x3190d78d, 0xf188db8d, 0xb180df8d, 
-    0x71f8e38e, 0x31f0e78e, 0xf1e8eb8e, 0xb1e0ef8e, 0x71d8f38f, 0x31d0f78f, 0xf1c8fb8f, 0xb1c0ff8f, 
-    0x72390390, 0x32310790, 0xf2290b90, 0xb2210f90, 0x72191391, 0x32111791, 0xf2091b91, 0xb2011f91, 
-    0x72792392, 0x32712792, 0xf2692b92, 0xb2612f92, 0x72593393, 0x32513793, 0xf2493b93, 0xb2413f93, 
-    0x72b94394, 0x32b14794, 0xf2a94b94, 0xb2a14f94, 0x72995395, 0x32915795, 0xf2895b95, 0xb2815f95, 
-    0x72f96396, 0x32f16796, 0xf2e96b96, 0xb2e16f96, 0x72d97397, 0x32d17797, 0xf2c97b97, 0xb2c17f97, 
-    0x73398398, 0x33318798, 0xf3298b98, 0xb3218f98, 0x73199399, 0x33119799, 0xf3099b99, 0xb3019f99, 
-    0x7379a39a, 0x3371a79a, 0xf369ab9a, 0xb361af9a, 0x7359b39b, 0x3351b79b, 0xf349bb9b, 0xb341bf9b, 
-    0x73b9c39c, 0x33b1c79c, 0xf3a9cb9c, 0xb3a1cf9c, 0x7399d39d, 0x3391d79d, 0xf389db9d, 0xb381df9d, 
-    0x73f9e39e, 0x33f1e79e, 0xf3e9eb9e, 0xb3e1ef9e, 0x73d9f39f, 0x33d1f79f, 0xf3c9fb9f, 0xb3c1ff9f, 
-    0x743a03a0, 0x343207a0, 0xf42a0ba0, 0xb4220fa0, 0x741a13a1, 0x341217a1, 0xf40a1ba1, 0xb4021fa1, 
-    0x747a23a2, 0x347227a2, 0xf46a2ba2, 0xb4622fa2, 0x745a33a3, 0x345237a3, 0xf44a3ba3, 0xb4423fa3, 
-    0x74ba43a4, 0x34b247a4, 0xf4aa4ba4, 0xb4a24fa4, 0x749a53a5, 0x349257a5, 0xf48a5ba5, 0xb4825fa5, 
-    0x74fa63a6, 0x34f267a6, 0xf4ea6ba6, 0xb4e26fa6, 0x74da73a7, 0x34d277a7, 0xf4ca7ba7, 0xb4c27fa7, 
-    0x753a83a8, 0x353287a8, 0xf52a8ba8, 0xb5228fa8, 0x751a93a9, 0x351297a9, 0xf50a9ba9, 0xb5029fa9, 
-    0x757aa3aa, 0x3572a7aa, 0xf56aabaa, 0xb562afaa, 0x755ab3ab, 0x3552b7ab, 0xf54abbab, 0xb542bfab, 
-    0x75bac3ac, 0x35b2c7ac, 0xf5aacbac, 0xb5a2cfac, 0x759ad3ad, 0x3592d7ad, 0xf58adbad, 0xb582dfad, 
-    0x75fae3ae, 0x35f2e7ae, 0xf5eaebae, 0xb5e2efae, 0x75daf3af, 0x35d2f7af, 0xf5cafbaf, 0xb5c2ffaf, 
-    0x763b03b0, 0x363307b0, 0xf62b0bb0, 0xb6230fb0, 0x761b13b1, 0x361317b1, 0xf60b1bb1, 0xb6031fb1, 
-    0x767b23b2, 0x367327b2, 0xf66b2bb2, 0xb6632fb2, 0x765b33b3, 0x365337b3, 0xf64b3bb3, 0xb6433fb3, 
-    0x76bb43b4, 0x36b347b4, 0xf6ab4bb4, 0xb6a34fb4, 0x769b53b5, 0x369357b5, 0xf68b5bb5, 0xb6835fb5, 
-    0x76fb63b6, 0x36f367b6, 0xf6eb6bb6, 0xb6e36fb6, 0x76db73b7, 0x36d377b7, 0xf6cb7bb7, 0xb6c37fb7, 
-    0x773b83b8, 0x373387b8, 0xf72b8bb8, 0xb7238fb8, 0x771b93b9, 0x371397b9, 0xf70b9bb9, 0xb7039fb9, 
-    0x777ba3ba, 0x3773a7ba, 0xf76babba, 0xb763afba, 0x775bb3bb, 0x3753b7bb, 0xf74bbbbb, 0xb743bfbb, 
-    0x77bbc3bc, 0x37b3c7bc, 0xf7abcbbc, 0xb7a3cfbc, 0x779bd3bd, 0x3793d7bd, 0xf78bdbbd, 0xb783dfbd, 
-    0x77fbe3be, 0x37f3e7be, 0xf7ebebbe, 0xb7e3efbe, 0x77dbf3bf, 0x37d3f7bf, 0xf7cbfbbf, 0xb7c3ffbf, 
-    0x783c03c0, 0x383407c0, 0xf82c0bc0, 0xb8240fc0, 0x781c13c1, 0x381417c1, 0xf80c1bc1, 0xb8041fc1, 
-    0x787c23c2, 0x387427c2, 0xf86c2bc2, 0xb8642fc2, 0x785c33c3, 0x385437c3, 0xf84c3bc3, 0xb8443fc3, 
-    0x78bc43c4, 0x38b447c4, 0xf8ac4bc4, 0xb8a44fc4, 0x789c53c5, 0x389457c5, 0xf88c5bc5, 0xb8845fc5, 
-    0x78fc63c6, 0x38f467c6, 0xf8ec6bc6, 0xb8e46fc6, 0x78dc73c7, 0x38d477c7, 0xf8cc7bc7, 0xb8c47fc7, 
-    0x793c83c8, 0x393487c8, 0xf92c8bc8, 0xb9248fc8, 0x791c93c9, 0x391497c9, 0xf90c9bc9, 0xb9049fc9, 
-    0x797ca3ca, 0x3974a7ca, 0xf96cabca, 0xb964afca, 0x795cb3cb, 0x3954b7cb, 0xf94cbbcb, 0xb944bfcb, 
-    0x79bcc3cc, 0x39b4c7cc, 0xf9accbcc, 0xb9a4cfcc, 0x799cd3cd, 0x3994d7cd, 0xf98cdbcd, 0xb984dfcd, 
-    0x79fce3ce, 0x39f4e7ce, 0xf9ecebce, 0xb9e4efce, 0x79dcf3cf, 0x39d4f7cf, 0xf9ccfbcf, 0xb9c4ffcf, 
-    0x7a3d03d0, 0x3a3507d0, 0xfa2d0bd0, 0xba250fd0, 0x7a1d13d1, 0x3a1517d1, 0xfa0d1bd1, 0xba051fd1, 
-    0x7a7d23d2, 0x3a7527d2, 0xfa6d2bd2, 0xba652fd2, 0x7a5d33d3, 0x3a5537d3, 0xfa4d3bd3, 0xba453fd3, 
-    0x7abd43d4, 0x3ab547d4, 0xfaad4bd4, 0xbaa54fd4, 0x7a9d53d5, 0x3a9557d5, 0xfa8d5bd5, 0xba855fd5, 
-    0x7afd63d6, 0x3af567d6, 0xfaed6bd6, 0xbae56fd6, 0x7add73d7, 0x3ad577d7, 0xfacd7bd7, 0xbac57fd7, 
-    0x7b3d83d8, 0x3b3587d8, 0xfb2d8bd8, 0xbb258fd8, 0x7b1d93d9, 0x3b1597d9, 0xfb0d9bd9, 0xbb059fd9, 
-    0x7b7da3da, 0x3b75a7da, 0xfb6dabda, 0xbb65afda, 0x7b5db3db, 0x3b55b7db, 0xfb4dbbdb, 0xbb45bfdb, 
-    0x7bbdc3dc, 0x3bb5c7dc, 0xfbadcbdc, 0xbba5cfdc, 0x7b9dd3dd, 0x3b95d7dd, 0xfb8ddbdd, 0xbb85dfdd, 
-    0x7bfde3de, 0x3bf5e7de, 0xfbedebde, 0xbbe5efde, 0x7bddf3df, 0x3bd5f7df, 0xfbcdfbdf, 0xbbc5ffdf, 
-    0x7c3e03e0, 0x3c3607e0, 0xfc2e0be0, 0xbc260fe0, 0x7c1e13e1, 0x3c1617e1, 0xfc0e1be1, 0xbc061fe1, 
-    0x7c7e23e2, 0x3c7627e2, 0xfc6e2be2, 0xbc662fe2, 0x7c5e33e3, 0x3c5637e3, 0xfc4e3be3, 0xbc463fe3, 
-    0x7cbe43e4, 0x3cb647e4, 0xfcae4be4, 0xbca64fe4, 0x7c9e53e5, 0x3c9657e5, 0xfc8e5be5, 0xbc865fe5, 
-    0x7cfe63e6, 0x3cf667e6, 0xfcee6be6, 0xbce66fe6, 0x7cde73e7, 0x3cd677e7, 0xfcce7be7, 0xbcc67fe7, 
-    0x7d3e83e8, 0x3d3687e8, 0xfd2e8be8, 0xbd268fe8, 0x7d1e93e9, 0x3d1697e9, 0xfd0e9be9, 0xbd069fe9, 
-    0x7d7ea3ea, 0x3d76a7ea, 0xfd6eabea, 0xbd66afea, 0x7d5eb3eb, 0x3d56b7eb, 0xfd4ebbeb, 0xbd46bfeb, 
-    0x7dbec3ec, 0x3db6c7ec, 0xfdaecbec, 0xbda6cfec, 0x7d9ed3ed, 0x3d96d7ed, 0xfd8edbed, 0xbd86dfed, 
-    0x7dfee3ee, 0x3df6e7ee, 0xfdeeebee, 0xbde6efee, 0x7ddef3ef, 0x3dd6f7ef, 0xfdcefbef, 0xbdc6ffef, 
-    0x7e3f03f0, 0x3e3707f0, 0xfe2f0bf0, 0xbe270ff0, 0x7e1f13f1, 0x3e1717f1, 0xfe0f1bf1, 0xbe071ff1, 
-    0x7e7f23f2, 0x3e7727f2, 0xfe6f2bf2, 0xbe672ff2, 0x7e5f33f3, 0x3e5737f3, 0xfe4f3bf3, 0xbe473ff3, 
-    0x7ebf43f4, 0x3eb747f4, 0xfeaf4bf4, 0xbea74ff4, 0x7e9f53f5, 0x3e9757f5, 0xfe8f5bf5, 0xbe875ff5, 
-    0x7eff63f6, 0x3ef767f6, 0xfeef6bf6, 0xbee76ff6, 0x7edf73f7, 0x3ed777f7, 0xfecf7bf7, 0xbec77ff7, 
-    0x7f3f83f8, 0x3f3787f8, 0xff2f8bf8, 0xbf278ff8, 0x7f1f93f9, 0x3f1797f9, 0xff0f9bf9, 0xbf079ff9, 
-    0x7f7fa3fa, 0x3f77a7fa, 0xff6fabfa, 0xbf67affa, 0x7f5fb3fb, 0x3f57b7fb, 0xff4fbbfb, 0xbf47bffb, 
-    0x7fbfc3fc, 0x3fb7c7fc, 0xffafcbfc, 0xbfa7cffc, 0x7f9fd3fd, 0x3f97d7fd, 0xff8fdbfd, 0xbf87dffd, 
-    0x7fffe3fe, 0x3ff7e7fe, 0xffefebfe, 0xbfe7effe, 0x7fdff3ff, 0x3fd7f7ff, 0xffcffbff, 0xbfc7ffff 
-};
@@ -1,514 +0,0 @@
-constant uint BSIG1_LUT[4096] = {
-    0x00000000, 0x04200080, 0x08400100, 0x0c600180, 0x10800200, 0x14a00280, 0x18c00300, 0x1ce00380, 
-    0x21000400, 0x25200480, 0x29400500, 0x2d600580, 0x31800600, 0x35a00680, 0x39c00700, 0x3de00780, 
-    0x42000800, 0x46200880, 0x4a400900, 0x4e600980, 0x52800a00, 0x56a00a80, 0x5ac00b00, 0x5ee00b80, 
-    0x63000c00, 0x67200c80, 0x6b400d00, 0x6f600d80, 0x73800e00, 0x77a00e80, 0x7bc00f00, 0x7fe00f80, 
-    0x84001000, 0x80201080, 0x8c401100, 0x88601180, 0x94801200, 0x90a01280, 0x9cc01300, 0x98e01380, 
-    0xa5001400, 0xa1201480, 0xad401500, 0xa9601580, 0xb5801600, 0xb1a01680, 0xbdc01700, 0xb9e01780, 
-    0xc6001800, 0xc2201880, 0xce401900, 0xca601980, 0xd6801a00, 0xd2a01a80, 0xdec01b00, 0xdae01b80, 
-    0xe7001c00, 0xe3201c80, 0xef401d00, 0xeb601d80, 0xf7801e00, 0xf3a01e80, 0xffc01f00, 0xfbe01f80, 
-    0x08002001, 0x0c202081, 0x00402101, 0x04602181, 0x18802201, 0x1ca02281, 0x10c02301, 0x14e02381, 
-    0x29002401, 0x2d202481, 0x21402501, 0x25602581, 0x39802601, 0x3da02681, 0x31c02701, 0x35e02781, 
-    0x4a002801, 0x4e202881, 0x42402901, 0x46602981, 0x5a802a01, 0x5ea02a81, 0x52c02b01, 0x56e02b81, 
-    0x6b002c01, 0x6f202c81, 0x63402d01, 0x67602d81, 0x7b802e01, 0x7fa02e81, 0x73c02f01, 0x77e02f81, 
-    0x8c003001, 0x88203081, 0x84403101, 0x80603181, 0x9c803201, 0x98a03281, 0x94c03301, 0x90e03381, 
-    0xad003401, 0xa9203481, 0xa5403501, 0xa1603581, 0xbd803601, 0xb9a03681, 0xb5c03701, 0xb1e03781, 
-    0xce003801, 0xca203881, 0xc6403901, 0xc2603981, 0xde803a01, 0xdaa03a81, 0xd6c03b01, 0xd2e03b81, 
-    0xef003c01, 0xeb203c81, 0xe7403d01, 0xe3603d81, 0xff803e01, 0xfba03e81, 0xf7c03f01, 0xf3e03f81, 
-    0x10004002, 0x14204082, 0x18404102, 0x1c604182, 0x00804202, 0x04a04282, 0x08c04302, 0x0ce04382, 
-    0x31004402, 0x35204482, 0x39404502, 0x3d604582, 0x21804602, 0x25a04682, 0x29c04702, 0x2de04782, 
-    0x52004802, 0x56204882, 0x5a404902, 0x5e604982, 0x42804a02, 0x46a04a82, 0x4ac04b02, 0x4ee04b82, 
-    0x73004c02, 0x77204c82, 0x7b404d02, 0x7f604d82, 0x63804e02, 0x67a04e82, 0x6bc04f02, 0x6fe04f82, 
-    0x94005002, 0x90205082, 0x9c405102, 0x98605182, 0x84805202, 0x80a05282, 0x8cc05302, 0x88e05382, 
-    0xb5005402, 0xb1205482, 0xbd405502, 0xb9605582, 0xa5805602, 0xa1a05682, 0xadc05702, 0xa9e05782, 
-    0xd6005802, 0xd2205882, 0xde405902, 0xda605982, 0xc6805a02, 0xc2a05a82, 0xcec05b02, 0xcae05b82, 
-    0xf7005c02, 0xf3205c82, 0xff405d02, 0xfb605d82, 0xe7805e02, 0xe3a05e82, 0xefc05f02, 0xebe05f82, 
-    0x18006003, 0x1c206083, 0x10406103, 0x14606183, 0x08806203, 0x0ca06283, 0x00c06303, 0x04e06383, 
-    0x39006403, 0x3d206483, 0x31406503, 0x35606583, 0x29806603, 0x2da06683, 0x21c06703, 0x25e06783, 
-    0x5a006803, 0x5e206883, 0x52406903, 0x56606983, 0x4a806a03, 0x4ea06a83, 0x42c06b03, 0x46e06b83, 
-    0x7b006c03, 0x7f206c83, 0x73406d03, 0x77606d83, 0x6b806e03, 0x6fa06e83, 0x63c06f03, 0x67e06f83, 
-    0x9c007003, 0x98207083, 0x94407103, 0x90607183, 0x8c807203, 0x88a07283, 0x84c07303, 0x80e07383, 
-    0xbd007403, 0xb9207483, 0xb5407503, 0xb1607583, 0xad807603, 0xa9a07683, 0xa5c07703, 0xa1e07783, 
-    0xde007803, 0xda207883, 0xd6407903, 0xd2607983, 0xce807a03, 0xcaa07a83, 0xc6c07b03, 0xc2e07b83, 
-    0xff007c03, 0xfb207c83, 0xf7407d03, 0xf3607d83, 0xef807e03, 0xeba07e83, 0xe7c07f03, 0xe3e07f83, 
-    0x20008004, 0x24208084, 0x28408104, 0x2c608184, 0x30808204, 0x34a08284, 0x38c08304, 0x3ce08384, 
-    0x01008404, 0x05208484, 0x09408504, 0x0d608584, 0x11808604, 0x15a08684, 0x19c08704, 0x1de08784, 
-    0x62008804, 0x66208884, 0x6a408904, 0x6e608984, 0x72808a04, 0x76a08a84, 0x7ac08b04, 0x7ee08b84, 
-    0x43008c04, 0x47208c84, 0x4b408d04, 0x4f608d84, 0x53808e04, 0x57a08e84, 0x5bc08f04, 0x5fe08f84, 
-    0xa4009004, 0xa0209084, 0xac409104, 0xa8609184, 0xb4809204, 0xb0a09284, 0xbcc09304, 0xb8e09384, 
-    0x85009404, 0x81209484, 0x8d409504, 0x89609584, 0x95809604, 0x91a09684, 0x9dc09704, 0x99e09784, 
-    0xe6009804, 0xe2209884, 0xee409904, 0xea609984, 0xf6809a04, 0xf2a09a84, 0xfec09b04, 0xfae09b84, 
-    0xc7009c04, 0xc3209c84, 0xcf409d04, 0xcb609d84, 0xd7809e04, 0xd3a09e84, 0xdfc09f04, 0xdbe09f84, 
-    0x2800a005, 0x2c20a085, 0x2040a105, 0x2460a185, 0x3880a205, 0x3ca0a285, 0x30c0a305, 0x34e0a385, 
-    0x0900a405, 0x0d20a485, 0x0140a505, 0x0560a585, 0x1980a605, 0x1da0a685, 0x11c0a705, 0x15e0a785, 
-    0x6a00a805, 0x6e20a885, 0x6240a905, 0x6660a985, 0x7a80aa05, 0x7ea0aa85, 0x72c0ab05, 0x76e0ab85, 
-    0x4b00ac05, 0x4f20ac85, 0x4340ad05, 0x4760ad85, 0x5b80ae05, 0x5fa0ae85, 0x53c0af05, 0x57e0af85, 
-    0xac00b005, 0xa820b085, 0xa440b105, 0xa060b185, 0xbc80b205, 0xb8a0b285, 0xb4c0b305, 0xb0e0b385, 
-    0x8d00b405, 0x8920b485, 0x8540b505, 0x8160b585, 0x9d80b605, 0x99a0b685, 0x95c0b705, 0x91e0b785, 
-    0xee00b805, 0xea20b885, 0xe640b905, 0xe260b985, 0xfe80ba05, 0xfaa0ba85, 0xf6c0bb05, 0xf2e0bb85, 
-    0xcf00bc05, 0xcb20bc85, 0xc740bd05, 0xc360bd85, 0xdf80be05, 0xdba0be85, 0xd7c0bf05, 0xd3e0bf85, 
-    0x3000c006, 0x3420c086, 0x3840c106, 0x3c60c186, 0x2080c206, 0x24a0c286, 0x28c0c306, 0x2ce0c386, 
-    0x1100c406, 0x1520c486, 0x1940c506, 0x1d60c586, 0x0180c606, 0x05a0c686, 0x09c0c706, 0x0de0c786, 
-    0x7200c806, 0x7620c886, 0x7a40c906, 0x7e60c986, 0x6280ca06, 0x66a0ca86, 0x6ac0cb06, 0x6ee0cb86, 
-    0x5300cc06, 0x5720cc86, 0x5b40cd06, 0x5f60cd86, 0x4380ce06, 0x47a0ce86, 0x4bc0cf06, 0x4fe0cf86, 
-    0xb400d006, 0xb020d086, 0xbc40d106, 0xb860d186, 0xa480d206, 0xa0a0d286, 0xacc0d306, 0xa8e0d386, 
-    0x9500d406, 0x9120d486, 0x9d40d506, 0x9960d586, 0x8580d606, 0x81a0d686, 0x8dc0d706, 0x89e0d786, 
-    0xf600d806, 0xf220d886, 0xfe40d906, 0xfa60d986, 0xe680da06, 0xe2a0da86, 0xeec0db06, 0xeae0db86, 
-    0xd700dc06, 0xd320dc86, 0xdf40dd06, 0xdb60dd86, 0xc780de06, 0xc3a0de86, 0xcfc0df06, 0xcbe0df86, 
-    0x3800e007, 0x3c20e087, 0x3040e107, 0x3460e187, 0x2880e207, 0x2ca0e287, 0x20c0e307, 0x24e0e387, 
-    0x1900e407, 0x1d20e487, 0x1140e507, 0x1560e587, 0x0980e607, 0x0da0e687, 0x01c0e707, 0x05e0e787, 
-    0x7a00e807, 0x7e20e887, 0x7240e907, 0x7660e987, 0x6a80ea07, 0x6ea0ea87, 0x62c0eb07, 0x66e0eb87, 
-    0x5b00ec07, 0x5f20ec87, 0x5340ed07, 0x5760ed87, 0x4b80ee07, 0x4fa0ee87, 0x43c0ef07, 0x47e0ef87, 
-    0xbc00f007, 0xb820f087, 0xb440f107, 0xb060f187, 0xac80f207, 0xa8a0f287, 0xa4c0f307, 0xa0e0f387, 
-    0x9d00f407, 0x9920f487, 0x9540f507, 0x9160f587, 0x8d80f607, 0x89a0f687, 0x85c0f707, 0x81e0f787, 
-    0xfe00f807, 0xfa20f887, 0xf640f907, 0xf260f987, 0xee80fa07, 0xeaa0fa87, 0xe6c0fb07, 0xe2e0fb87, 
-    0xdf00fc07, 0xdb20fc87, 0xd740fd07, 0xd360fd87, 0xcf80fe07, 0xcba0fe87, 0xc7c0ff07, 0xc3e0ff87, 
-    0x40010008, 0x44210088, 0x48410108, 0x4c610188, 0x50810208, 0x54a10288, 0x58c10308, 0x5ce10388, 
-    0x61010408, 0x65210488, 0x69410508, 0x6d610588, 0x71810608, 0x75a10688, 0x79c10708, 0x7de10788, 
-    0x02010808, 0x06210888, 0x0a410908, 0x0e610988, 0x12810a08, 0x16a10a88, 0x1ac10b08, 0x1ee10b88, 
-    0x23010c08, 0x27210c88, 0x2b410d08, 0x2f610d88, 0x33810e08, 0x37a10e88, 0x3bc10f08, 0x3fe10f88, 
-    0xc4011008, 0xc0211088, 0xcc411108, 0xc8611188, 0xd4811208, 0xd0a11288, 0xdcc11308, 0xd8e11388, 
-    0xe5011408, 0xe1211488, 0xed411508, 0xe9611588, 0xf5811608, 0xf1a11688, 0xfdc11708, 0xf9e11788, 
-    0x86011808, 0x82211888, 0x8e411908, 0x8a611988, 0x96811a08, 0x92a11a88, 0x9ec11b08, 0x9ae11b88, 
-    0xa7011c08, 0xa3211c88, 0xaf411d08, 0xab611d88, 0xb7811e08, 0xb3a11e88, 0xbfc11f08, 0xbbe11f88, 
-    0x48012009, 0x4c212089, 0x40412109, 0x44612189, 0x58812209, 0x5ca12289, 0x50c12309, 0x54e12389, 
-    0x69012409, 0x6d212489, 0x61412509, 0x65612589, 0x79812609, 0x7da12689, 0x71c12709, 0x75e12789, 
-    0x0a012809, 0x0e212889, 0x02412909, 0x06612989, 0x1a812a09, 0x1ea12a89, 0x12c12b09, 0x16e12b89, 
-    0x2b012c09, 0x2f212c89, 0x23412d09, 0x27612d89, 0x3b812e09, 0x3fa12e89, 0x33c12f09, 0x37e12f89, 
-    0xcc013009, 0xc8213089, 0xc4413109, 0xc0613189, 0xdc813209, 0xd8a13289, 0xd4c13309, 0xd0e13389, 
-    0xed013409, 0xe9213489, 0xe5413509, 0xe1613589, 0xfd813609, 0xf9a13689, 0xf5c13709, 0xf1e13789, 
-    0x8e013809, 0x8a213889, 0x86413909, 0x82613989, 0x9e813a09, 0x9aa13a89, 0x96c13b09, 0x92e13b89, 
-    0xaf013c09, 0xab213c89, 0xa7413d09, 0xa3613d89, 0xbf813e09, 0xbba13e89, 0xb7c13f09, 0xb3e13f89, 
-    0x5001400a, 0x5421408a, 0x5841410a, 0x5c61418a, 0x4081420a, 0x44a1428a, 0x48c1430a, 0x4ce1438a, 
-    0x7101440a, 0x7521448a, 0x7941450a, 0x7d61458a, 0x6181460a, 0x65a1468a, 0x69c1470a, 0x6de1478a, 
-    0x1201480a, 0x1621488a, 0x1a41490a, 0x1e61498a, 0x02814a0a, 0x06a14a8a, 0x0ac14b0a, 0x0ee14b8a, 
-    0x33014c0a, 0x37214c8a, 0x3b414d0a, 0x3f614d8a, 0x23814e0a, 0x27a14e8a, 0x2bc14f0a, 0x2fe14f8a, 
-    0xd401500a, 0xd021508a, 0xdc41510a, 0xd861518a, 0xc481520a, 0xc0a1528a, 0xccc1530a, 0xc8e1538a, 
-    0xf501540a, 0xf121548a, 0xfd41550a, 0xf961558a, 0xe581560a, 0xe1a1568a, 0xedc1570a, 0xe9e1578a, 
-    0x9601580a, 0x9221588a, 0x9e41590a, 0x9a61598a, 0x86815a0a, 0x82a15a8a, 0x8ec15b0a, 0x8ae15b8a, 
-    0xb7015c0a, 0xb3215c8a, 0xbf415d0a, 0xbb615d8a, 0xa7815e0a, 0xa3a15e8a, 0xafc15f0a, 0xabe15f8a, 
-    0x5801600b, 0x5c21608b, 0x5041610b, 0x5461618b, 0x4881620b, 0x4ca1628b, 0x40c1630b, 0x44e1638b, 
-    0x7901640b, 0x7d21648b, 0x7141650b, 0x7561658b, 0x6981660b, 0x6da1668b, 0x61c1670b, 0x65e1678b, 
-    0x1a01680b, 0x1e21688b, 0x1241690b, 0x1661698b, 0x0a816a0b, 0x0ea16a8b, 0x02c16b0b, 0x06e16b8b, 
-    0x3b016c0b, 0x3f216c8b, 0x33416d0b, 0x37616d8b, 0x2b816e0b, 0x2fa16e8b, 0x23c16f0b, 0x27e16f8b, 
-    0xdc01700b, 0xd821708b, 0xd441710b, 0xd061718b, 0xcc81720b, 0xc8a1728b, 0xc4c1730b, 0xc0e1738b, 
-    0xfd01740b, 0xf921748b, 0xf541750b, 0xf161758b, 0xed81760b, 0xe9a1768b, 0xe5c1770b, 0xe1e1778b, 
-    0x9e01780b, 0x9a21788b, 0x9641790b, 0x9261798b, 0x8e817a0b, 0x8aa17a8b, 0x86c17b0b, 0x82e17b8b, 
-    0xbf017c0b, 0xbb217c8b, 0xb7417d0b, 0xb3617d8b, 0xaf817e0b, 0xaba17e8b, 0xa7c17f0b, 0xa3e17f8b, 
-    0x6001800c, 0x6421808c, 0x6841810c, 0x6c61818c, 0x7081820c, 0x74a1828c, 0x78c1830c, 0x7ce1838c, 
-    0x4101840c, 0x4521848c, 0x4941850c, 0x4d61858c, 0x5181860c, 0x55a1868c, 0x59c1870c, 0x5de1878c, 
-    0x2201880c, 0x2621888c, 0x2a41890c, 0x2e61898c, 0x32818a0c, 0x36a18a8c, 0x3ac18b0c, 0x3ee18b8c, 
-    0x03018c0c, 0x07218c8c, 0x0b418d0c, 0x0f618d8c, 0x13818e0c, 0x17a18e8c, 0x1bc18f0c, 0x1fe18f8c, 
-    0xe401900c, 0xe021908c, 0xec41910c, 0xe861918c, 0xf481920c, 0xf0a1928c, 0xfcc1930c, 0xf8e1938c, 
-    0xc501940c, 0xc121948c, 0xcd41950c, 0xc961958c, 0xd581960c, 0xd1a1968c, 0xddc1970c, 0xd9e1978c, 
-    0xa601980c, 0xa221988c, 0xae41990c, 0xaa61998c, 0xb6819a0c, 0xb2a19a8c, 0xbec19b0c, 0xbae19b8c, 
-    0x87019c0c, 0x83219c8c, 0x8f419d0c, 0x8b619d8c, 0x97819e0c, 0x93a19e8c, 0x9fc19f0c, 0x9be19f8c, 
-    0x6801a00d, 0x6c21a08d, 0x6041a10d, 0x6461a18d, 0x7881a20d, 0x7ca1a28d, 0x70c1a30d, 0x74e1a38d, 
-    0x4901a40d, 0x4d21a48d, 0x4141a50d, 0x4561a58d, 0x5981a60d, 0x5da1a68d, 0x51c1a70d, 0x55e1a78d, 
-    0x2a01a80d, 0x2e21a88d, 0x2241a90d, 0x2661a98d, 0x3a81aa0d, 0x3ea1aa8d, 0x32c1ab0d, 0x36e1ab8d, 
-    0x0b01ac0d, 0x0f21ac8d, 0x0341ad0d, 0x0761ad8d, 0x1b81ae0d, 0x1fa1ae8d, 0x13c1af0d, 0x17e1af8d, 
-    0xec01b00d, 0xe821b08d, 0xe441b10d, 0xe061b18d, 0xfc81b20d, 0xf8a1b28d, 0xf4c1b30d, 0xf0e1b38d, 
-    0xcd01b40d, 0xc921b48d, 0xc541b50d, 0xc161b58d, 0xdd81b60d, 0xd9a1b68d, 0xd5c1b70d, 0xd1e1b78d, 
-    0xae01b80d, 0xaa21b88d, 0xa641b90d, 0xa261b98d, 0xbe81ba0d, 0xbaa1ba8d, 0xb6c1bb0d, 0xb2e1bb8d, 
-    0x8f01bc0d, 0x8b21bc8d, 0x8741bd0d, 0x8361bd8d, 0x9f81be0d, 0x9ba1be8d, 0x97c1bf0d, 0x93e1bf8d, 
-    0x7001c00e, 0x7421c08e, 0x7841c10e, 0x7c61c18e, 0x6081c20e, 0x64a1c28e, 0x68c1c30e, 0x6ce1c38e, 
-    0x5101c40e, 0x5521c48e, 0x5941c50e, 0x5d61c58e, 0x4181c60e, 0x45a1c68e, 0x49c1c70e, 0x4de1c78e, 
-    0x3201c80e, 0x3621c88e, 0x3a41c90e, 0x3e61c98e, 0x2281ca0e, 0x26a1ca8e, 0x2ac1cb0e, 0x2ee1cb8e, 
-    0x1301cc0e, 0x1721cc8e, 0x1b41cd0e, 0x1f61cd8e, 0x0381ce0e, 0x07a1ce8e, 0x0bc1cf0e, 0x0fe1cf8e, 
-    0xf401d00e, 0xf021d08e, 0xfc41d10e, 0xf861d18e, 0xe481d20e, 0xe0a1d28e, 0xecc1d30e, 0xe8e1d38e, 
-    0xd501d40e, 0xd121d48e, 0xdd41d50e, 0xd961d58e, 0xc581d60e, 0xc1a1d68e, 0xcdc1d70e, 0xc9e1d78e, 
-    0xb601d80e, 0xb221d88e, 0xbe41d90e, 0xba61d98e, 0xa681da0e, 0xa2a1da8e, 0xaec1db0e, 0xaae1db8e, 
-    0x9701dc0e, 0x9321dc8e, 0x9f41dd0e, 0x9b61dd8e, 0x8781de0e, 0x83a1de8e, 0x8fc1df0e, 0x8be1df8e, 
-    0x7801e00f, 0x7c21e08f, 0x7041e10f, 0x7461e18f, 0x6881e20f, 0x6ca1e28f, 0x60c1e30f, 0x64e1e38f, 
-    0x5901e40f, 0x5d21e48f, 0x5141e50f, 0x5561e58f, 0x4981e60f, 0x4da1e68f, 0x41c1e70f, 0x45e1e78f, 
-    0x3a01e80f, 0x3e21e88f, 0x3241e90f, 0x3661e98f, 0x2a81ea0f, 0x2ea1ea8f, 0x22c1eb0f, 0x26e1eb8f, 
-    0x1b01ec0f, 0x1f21ec8f, 0x1341ed0f, 0x1761ed8f, 0x0b81ee0f, 0x0fa1ee8f, 0x03c1ef0f, 0x07e1ef8f, 
-    0xfc01f00f, 0xf821f08f, 0xf441f10f, 0xf061f18f, 0xec81f20f, 0xe8a1f28f, 0xe4c1f30f, 0xe0e1f38f, 
-    0xdd01f40f, 0xd921f48f, 0xd541f50f, 0xd161f58f, 0xcd81f60f, 0xc9a1f68f, 0xc5c1f70f, 0xc1e1f78f, 
-    0xbe01f80f, 0xba21f88f, 0xb641f90f, 0xb261f98f, 0xae81fa0f, 0xaaa1fa8f, 0xa6c1fb0f, 0xa2e1fb8f, 
-    0x9f01fc0f, 0x9b21fc8f, 0x9741fd0f, 0x9361fd8f, 0x8f81fe0f, 0x8ba1fe8f, 0x87c1ff0f, 0x83e1ff8f, 
-    0x80020010, 0x84220090, 0x88420110, 0x8c620190, 0x90820210, 0x94a20290, 0x98c20310, 0x9ce20390, 
-    0xa1020410, 0xa5220490, 0xa9420510, 0xad620590, 0xb1820610, 0xb5a20690, 0xb9c20710, 0xbde20790, 
-    0xc2020810, 0xc6220890, 0xca420910, 0xce620990, 0xd2820a10, 0xd6a20a90, 0xdac20b10, 0xdee20b90, 
-    0xe3020c10, 0xe7220c90, 0xeb420d10, 0xef620d90, 0xf3820e10, 0xf7a20e90, 0xfbc20f10, 0xffe20f90, 
-    0x04021010, 0x00221090, 0x0c421110, 0x08621190, 0x14821210, 0x10a21290, 0x1cc21310, 0x18e21390, 
-    0x25021410, 0x21221490, 0x2d421510, 0x29621590, 0x35821610, 0x31a21690, 0x3dc21710, 0x39e21790, 
-    0x46021810, 0x42221890, 0x4e421910, 0x4a621990, 0x56821a10, 0x52a21a90, 0x5ec21b10, 0x5ae21b90, 
-    0x67021c10, 0x63221c90, 0x6f421d10, 0x6b621d90, 0x77821e10, 0x73a21e90, 0x7fc21f10, 0x7be21f90, 
-    0x88022011, 0x8c222091, 0x80422111, 0x84622191, 0x98822211, 0x9ca22291, 0x90c22311, 0x94e22391, 
-    0xa9022411, 0xad222491, 0xa1422511, 0xa5622591, 0xb9822611, 0xbda22691, 0xb1c22711, 0xb5e22791, 
-    0xca022811, 0xce222891, 0xc2422911, 0xc6622991, 0xda822a11, 0xdea22a91, 0xd2c22b11, 0xd6e22b91, 
-    0xeb022c11, 0xef222c91, 0xe3422d11, 0xe7622d91, 0xfb822e11, 0xffa22e91, 0xf3c22f11, 0xf7e22f91, 
-    0x0c023011, 0x08223091, 0x04423111, 0x00623191, 0x1c823211, 0x18a23291, 0x14c23311, 0x10e23391, 
-    0x2d023411, 0x29223491, 0x25423511, 0x21623591, 0x3d823611, 0x39a23691, 0x35c23711, 0x31e23791, 
-    0x4e023811, 0x4a223891, 0x46423911, 0x42623991, 0x5e823a11, 0x5aa23a91, 0x56c23b11, 0x52e23b91, 
-    0x6f023c11, 0x6b223c91, 0x67423d11, 0x63623d91, 0x7f823e11, 0x7ba23e91, 0x77c23f11, 0x73e23f91, 
-    0x90024012, 0x94224092, 0x98424112, 0x9c624192, 0x80824212, 0x84a24292, 0x88c24312, 0x8ce24392, 
-    0xb1024412, 0xb5224492, 0xb9424512, 0xbd624592, 0xa1824612, 0xa5a24692, 0xa9c24712, 0xade24792, 
-    0xd2024812, 0xd6224892, 0xda424912, 0xde624992, 0xc2824a12, 0xc6a24a92, 0xcac24b12, 0xcee24b92, 
-    0xf3024c12, 0xf7224c92, 0xfb424d12, 0xff624d92, 0xe3824e12, 0xe7a24e92, 0xebc24f12, 0xefe24f92, 
-    0x14025012, 0x10225092, 0x1c425112, 0x18625192, 0x04825212, 0x00a25292, 0x0cc25312, 0x08e25392, 
-    0x35025412, 0x31225492, 0x3d425512, 0x39625592, 0x25825612, 0x21a25692, 0x2dc25712, 0x29e25792, 
-    0x56025812, 0x52225892, 0x5e425912, 0x5a625992, 0x46825a12, 0x42a25a92, 0x4ec25b12, 0x4ae25b92, 
-    0x77025c12, 0x73225c92, 0x7f425d12, 0x7b625d92, 0x67825e12, 0x63a25e92, 0x6fc25f12, 0x6be25f92, 
-    0x98026013, 0x9c226093, 0x90426113, 0x94626193, 0x88826213, 0x8ca26293, 0x80c26313, 0x84e26393, 
-    0xb9026413, 0xbd226493, 0xb1426513, 0xb5626593, 0xa9826613, 0xada26693, 0xa1c26713, 0xa5e26793, 
-    0xda026813, 0xde226893, 0xd2426913, 0xd6626993, 0xca826a13, 0xcea26a93, 0xc2c26b13, 0xc6e26b93, 
-    0xfb026c13, 0xff226c93, 0xf3426d13, 0xf7626d93, 0xeb826e13, 0xefa26e93, 0xe3c26f13, 0xe7e26f93, 
-    0x1c027013, 0x18227093, 0x14427113, 0x10627193, 0x0c827213, 0x08a27293, 0x04c27313, 0x00e27393, 
-    0x3d027413, 0x39227493, 0x35427513, 0x31627593, 0x2d827613, 0x29a27693, 0x25c27713, 0x21e27793, 
-    0x5e027813, 0x5a227893, 0x56427913, 0x52627993, 0x4e827a13, 0x4aa27a93, 0x46c27b13, 0x42e27b93, 
-    0x7f027c13, 0x7b227c93, 0x77427d13, 0x73627d93, 0x6f827e13, 0x6ba27e93, 0x67c27f13, 0x63e27f93, 
-    0xa0028014, 0xa4228094, 0xa8428114, 0xac628194, 0xb0828214, 0xb4a28294, 0xb8c28314, 0xbce28394, 
-    0x81028414, 0x85228494, 0x89428514, 0x8d628594, 0x91828614, 0x95a28694, 0x99c28714, 0x9de28794, 
-    0xe2028814, 0xe6228894, 0xea428914, 0xee628994, 0xf2828a14, 0xf6a28a94, 0xfac28b14, 0xfee28b94, 
-    0xc3028c14, 0xc7228c94, 0xcb428d14, 0xcf628d94, 0xd3828e14, 0xd7a28e94, 0xdbc28f14, 0xdfe28f94, 
-    0x24029014, 0x20229094, 0x2c429114, 0x28629194, 0x34829214, 0x30a29294, 0x3cc29314, 0x38e29394, 
-    0x05029414, 0x01229494, 0x0d429514, 0x09629594, 0x15829614, 0x11a29694, 0x1dc29714, 0x19e29794, 
-    0x66029814, 0x62229894, 0x6e429914, 0x6a629994, 0x76829a14, 0x72a29a94, 0x7ec29b14, 0x7ae29b94, 
-    0x47029c14, 0x43229c94, 0x4f429d14, 0x4b629d94, 0x57829e14, 0x53a29e94, 0x5fc29f14, 0x5be29f94, 
-    0xa802a015, 0xac22a095, 0xa042a115, 0xa462a195, 0xb882a215, 0xbca2a295, 0xb0c2a315, 0xb4e2a395, 
-    0x8902a415, 0x8d22a495, 0x8142a515, 0x8562a595, 0x9982a615, 0x9da2a695, 0x91c2a715, 0x95e2a795, 
-    0xea02a815, 0xee22a895, 0xe242a915, 0xe662a995, 0xfa82aa15, 0xfea2aa95, 0xf2c2ab15, 0xf6e2ab95, 
-    0xcb02ac15, 0xcf22ac95, 0xc342ad15, 0xc762ad95, 0xdb82ae15, 0xdfa2ae95, 0xd3c2af15, 0xd7e2af95, 
-    0x2c02b015, 0x2822b095, 0x2442b115, 0x2062b195, 0x3c82b215, 0x38a2b295, 0x34c2b315, 0x30e2b395, 
-    0x0d02b415, 0x0922b495, 0x0542b515, 0x0162b595, 0x1d82b615, 0x19a2b695, 0x15c2b715, 0x11e2b795, 
-    0x6e02b815, 0x6a22b895, 0x6642b915, 0x6262b995, 0x7e82ba15, 0x7aa2ba95, 0x76c2bb15, 0x72e2bb95, 
-    0x4f02bc15, 0x4b22bc95, 0x4742bd15, 0x4362bd95, 0x5f82be15, 0x5ba2be95, 0x57c2bf15, 0x53e2bf95, 
-    0xb002c016, 0xb422c096, 0xb842c116, 0xbc62c196, 0xa082c216, 0xa4a2c296, 0xa8c2c316, 0xace2c396, 
-    0x9102c416, 0x9522c496, 0x9942c516, 0x9d62c596, 0x8182c616, 0x85a2c696, 0x89c2c716, 0x8de2c796, 
-    0xf202c816, 0xf622c896, 0xfa42c916, 0xfe62c996, 0xe282ca16, 0xe6a2ca96, 0xeac2cb16, 0xeee2cb96, 
-    0xd302cc16, 0xd722cc96, 0xdb42cd16, 0xdf62cd96, 0xc382ce16, 0xc7a2ce96, 0xcbc2cf16, 0xcfe2cf96, 
-    0x3402d016, 0x3022d096, 0x3c42d116, 0x3862d196, 0x2482d216, 0x20a2d296, 0x2cc2d316, 0x28e2d396, 
-    0x1502d416, 0x1122d496, 0x1d42d516, 0x1962d596, 0x0582d616, 0x01a2d696, 0x0dc2d716, 0x09e2d796, 
-    0x7602d816, 0x7222d896, 0x7e42d916, 0x7a62d996, 0x6682da16, 0x62a2da96, 0x6ec2db16, 0x6ae2db96, 
-    0x5702dc16, 0x5322dc96, 0x5f42dd16, 0x5b62dd96, 0x4782de16, 0x43a2de96, 0x4fc2df16, 0x4be2df96, 
-    0xb802e017, 0xbc22e097, 0xb042e117, 0xb462e197, 0xa882e217, 0xaca2e297, 0xa0c2e317, 0xa4e2e397, 
-    0x9902e417, 0x9d22e497, 0x9142e517, 0x9562e597, 0x8982e617, 0x8da2e697, 0x81c2e717, 0x85e2e797, 
-    0xfa02e817, 0xfe22e897, 0xf242e917, 0xf662e997, 0xea82ea17, 0xeea2ea97, 0xe2c2eb17, 0xe6e2eb97, 
-    0xdb02ec17, 0xdf22ec97, 0xd342ed17, 0xd762ed97, 0xcb82ee17, 0xcfa2ee97, 0xc3c2ef17, 0xc7e2ef97, 
-    0x3c02f017, 0x3822f097, 0x3442f117, 0x3062f197, 0x2c82f217, 0x28a2f297, 0x24c2f317, 0x20e2f397, 
-    0x1d02f417, 0x1922f497, 0x1542f517, 0x1162f597, 0x0d82f617, 0x09a2f697, 0x05c2f717, 0x01e2f797, 
-    0x7e02f817, 0x7a22f897, 0x7642f917, 0x7262f997, 0x6e82fa17, 0x6aa2fa97, 0x66c2fb17, 0x62e2fb97, 
-    0x5f02fc17, 0x5b22fc97, 0x5742fd17, 0x5362fd97, 0x4f82fe17, 0x4ba2fe97, 0x47c2ff17, 0x43e2ff97, 
-    0xc0030018, 0xc4230098, 0xc8430118, 0xcc630198, 0xd0830218, 0xd4a30298, 0xd8c30318, 0xdce30398, 
-    0xe1030418, 0xe5230498, 0xe9430518, 0xed630598, 0xf1830618, 0xf5a30698, 0xf9c30718, 0xfde30798, 
-    0x82030818, 0x86230898, 0x8a430918, 0x8e630998, 0x92830a18, 0x96a30a98, 0x9ac30b18, 0x9ee30b98, 
-    0xa3030c18, 0xa7230c98, 0xab430d18, 0xaf630d98, 0xb3830e18, 0xb7a30e98, 0xbbc30f18, 0xbfe30f98, 
-    0x44031018, 0x40231098, 0x4c431118, 0x48631198, 0x54831218, 0x50a31298, 0x5cc31318, 0x58e31398, 
-    0x65031418, 0x61231498, 0x6d431518, 0x69631598, 0x75831618, 0x71a31698, 0x7dc31718, 0x79e31798, 
-    0x06031818, 0x02231898, 0x0e431918, 0x0a631998, 0x16831a18, 0x12a31a98, 0x1ec31b18, 0x1ae31b98, 
-    0x27031c18, 0x23231c98, 0x2f431d18, 0x2b631d98, 0x37831e18, 0x33a31e98, 0x3fc31f18, 0x3be31f98, 
-    0xc8032019, 0xcc232099, 0xc0432119, 0xc4632199, 0xd8832219, 0xdca32299, 0xd0c32319, 0xd4e32399, 
-    0xe9032419, 0xed232499, 0xe1432519, 0xe5632599, 0xf9832619, 0xfda32699, 0xf1c32719, 0xf5e32799, 
-    0x8a032819, 0x8e232899, 0x82432919, 0x86632999, 0x9a832a19, 0x9ea32a99, 0x92c32b19, 0x96e32b99, 
-    0xab032c19, 0xaf232c99, 0xa3432d19, 0xa7632d99, 0xbb832e19, 0xbfa32e99, 0xb3c32f19, 0xb7e32f99, 
-    0x4c033019, 0x48233099, 0x44433119, 0x40633199, 0x5c833219, 0x58a33299, 0x54c33319, 0x50e33399, 
-    0x6d033419, 0x69233499, 0x65433519, 0x61633599, 0x7d833619, 0x79a33699, 0x75c33719, 0x71e33799, 
-    0x0e033819, 0x0a233899, 0x06433919, 0x02633999, 0x1e833a19, 0x1aa33a99, 0x16c33b19, 0x12e33b99, 
-    0x2f033c19, 0x2b233c99, 0x27433d19, 0x23633d99, 0x3f833e19, 0x3ba33e99, 0x37c33f19, 0x33e33f99, 
-    0xd003401a, 0xd423409a, 0xd843411a, 0xdc63419a, 0xc083421a, 0xc4a3429a, 0xc8c3431a, 0xcce3439a, 
-    0xf103441a, 0xf523449a, 0xf943451a, 0xfd63459a, 0xe183461a, 0xe5a3469a, 0xe9c3471a, 0xede3479a, 
-    0x9203481a, 0x9623489a, 0x9a43491a, 0x9e63499a, 0x82834a1a, 0x86a34a9a, 0x8ac34b1a, 0x8ee34b9a, 
-    0xb3034c1a, 0xb7234c9a, 0xbb434d1a, 0xbf634d9a, 0xa3834e1a, 0xa7a34e9a, 0xabc34f1a, 0xafe34f9a, 
-    0x5403501a, 0x5023509a, 0x5c43511a, 0x5863519a, 0x4483521a, 0x40a3529a, 0x4cc3531a, 0x48e3539a, 
-    0x7503541a, 0x7123549a, 0x7d43551a, 0x7963559a, 0x6583561a, 0x61a3569a, 0x6dc3571a, 0x69e3579a, 
-    0x1603581a, 0x1223589a, 0x1e43591a, 0x1a63599a, 0x06835a1a, 0x02a35a9a, 0x0ec35b1a, 0x0ae35b9a, 
-    0x37035c1a, 0x33235c9a, 0x3f435d1a, 0x3b635d9a, 0x27835e1a, 0x23a35e9a, 0x2fc35f1a, 0x2be35f9a, 
-    0xd803601b, 0xdc23609b, 0xd043611b, 0xd463619b, 0xc883621b, 0xcca3629b, 0xc0c3631b, 0xc4e3639b, 
-    0xf903641b, 0xfd23649b, 0xf143651b, 0xf563659b, 0xe983661b, 0xeda3669b, 0xe1c3671b, 0xe5e3679b, 
-    0x9a03681b, 0x9e23689b, 0x9243691b, 0x9663699b, 0x8a836a1b, 0x8ea36a9b, 0x82c36b1b, 0x86e36b9b, 
-    0xbb036c1b, 0xbf236c9b, 0xb3436d1b, 0xb7636d9b, 0xab836e1b, 0xafa36e9b, 0xa3c36f1b, 0xa7e36f9b, 
-    0x5c03701b, 0x5823709b, 0x5443711b, 0x5063719b, 0x4c83721b, 0x48a3729b, 0x44c3731b, 0x40e3739b, 
-    0x7d03741b, 0x7923749b, 0x7543751b, 0x7163759b, 0x6d83761b, 0x69a3769b, 0x65c3771b, 0x61e3779b, 
-    0x1e03781b, 0x1a23789b, 0x1643791b, 0x1263799b, 0x0e837a1b, 0x0aa37a9b, 0x06c37b1b, 0x02e37b9b, 
-    0x3f037c1b, 0x3b237c9b, 0x37437d1b, 0x33637d9b, 0x2f837e1b, 0x2ba37e9b, 0x27c37f1b, 0x23e37f9b, 
-    0xe003801c, 0xe423809c, 0xe843811c, 0xec63819c, 0xf083821c, 0xf4a3829c, 0xf8c3831c, 0xfce3839c, 
-    0xc103841c, 0xc523849c, 0xc943851c, 0xcd63859c, 0xd183861c, 0xd5a3869c, 0xd9c3871c, 0xdde3879c, 
-    0xa203881c, 0xa623889c, 0xaa43891c, 0xae63899c, 0xb2838a1c, 0xb6a38a9c, 0xbac38b1c, 0xbee38b9c, 
-    0x83038c1c, 0x87238c9c, 0x8b438d1c, 0x8f638d9c, 0x93838e1c, 0x97a38e9c, 0x9bc38f1c, 0x9fe38f9c, 
-    0x6403901c, 0x6023909c, 0x6c43911c, 0x6863919c, 0x7483921c, 0x70a3929c, 0x7cc3931c, 0x78e3939c, 
-    0x4503941c, 0x4123949c, 0x4d43951c, 0x4963959c, 0x5583961c, 0x51a3969c, 0x5dc3971c, 0x59e3979c, 
-    0x2603981c, 0x2223989c, 0x2e43991c, 0x2a63999c, 0x36839a1c, 0x32a39a9c, 0x3ec39b1c, 0x3ae39b9c, 
-    0x07039c1c, 0x03239c9c, 0x0f439d1c, 0x0b639d9c, 0x17839e1c, 0x13a39e9c, 0x1fc39f1c, 0x1be39f9c, 
-    0xe803a01d, 0xec23a09d, 0xe043a11d, 0xe463a19d, 0xf883a21d, 0xfca3a29d, 0xf0c3a31d, 0xf4e3a39d, 
-    0xc903a41d, 0xcd23a49d, 0xc143a51d, 0xc563a59d, 0xd983a61d, 0xdda3a69d, 0xd1c3a71d, 0xd5e3a79d, 
-    0xaa03a81d, 0xae23a89d, 0xa243a91d, 0xa663a99d, 0xba83aa1d, 0xbea3aa9d, 0xb2c3ab1d, 0xb6e3ab9d, 
-    0x8b03ac1d, 0x8f23ac9d, 0x8343ad1d, 0x8763ad9d, 0x9b83ae1d, 0x9fa3ae9d, 0x93c3af1d, 0x97e3af9d, 
-    0x6c03b01d, 0x6823b09d, 0x6443b11d, 0x6063b19d, 0x7c83b21d, 0x78a3b29d, 0x74c3b31d, 0x70e3b39d, 
-    0x4d03b41d, 0x4923b49d, 0x4543b51d, 0x4163b59d, 0x5d83b61d, 0x59a3b69d, 0x55c3b71d, 0x51e3b79d, 
-    0x2e03b81d, 0x2a23b89d, 0x2643b91d, 0x2263b99d, 0x3e83ba1d, 0x3aa3ba9d, 0x36c3bb1d, 0x32e3bb9d, 
-    0x0f03bc1d, 0x0b23bc9d, 0x0743bd1d, 0x0363bd9d, 0x1f83be1d, 0x1ba3be9d, 0x17c3bf1d, 0x13e3bf9d, 
-    0xf003c01e, 0xf423c09e, 0xf843c11e, 0xfc63c19e, 0xe083c21e, 0xe4a3c29e, 0xe8c3c31e, 0xece3c39e, 
-    0xd103c41e, 0xd523c49e, 0xd943c51e, 0xdd63c59e, 0xc183c61e, 0xc5a3c69e, 0xc9c3c71e, 0xcde3c79e, 
-    0xb203c81e, 0xb623c89e, 0xba43c91e, 0xbe63c99e, 0xa283ca1e, 0xa6a3ca9e, 0xaac3cb1e, 0xaee3cb9e, 
-    0x9303cc1e, 0x9723cc9e, 0x9b43cd1e, 0x9f63cd9e, 0x8383ce1e, 0x87a3ce9e, 0x8bc3cf1e, 0x8fe3cf9e, 
-    0x7403d01e, 0x7023d09e, 0x7c43d11e, 0x7863d19e, 0x6483d21e, 0x60a3d29e, 0x6cc3d31e, 0x68e3d39e, 
-    0x5503d41e, 0x5123d49e, 0x5d43d51e, 0x5963d59e, 0x4583d61e, 0x41a3d69e, 0x4dc3d71e, 0x49e3d79e, 
-    0x3603d81e, 0x3223d89e, 0x3e43d91e, 0x3a63d99e, 0x2683da1e, 0x22a3da9e, 0x2ec3db1e, 0x2ae3db9e, 
-    0x1703dc1e, 0x1323dc9e, 0x1f43dd1e, 0x1b63dd9e, 0x0783de1e, 0x03a3de9e, 0x0fc3df1e, 0x0be3df9e, 
-    0xf803e01f, 0xfc23e09f, 0xf043e11f, 0xf463e19f, 0xe883e21f, 0xeca3e29f, 0xe0c3e31f, 0xe4e3e39f, 
-    0xd903e41f, 0xdd23e49f, 0xd143e51f, 0xd563e59f, 0xc983e61f, 0xcda3e69f, 0xc1c3e71f, 0xc5e3e79f, 
-    0xba03e81f, 0xbe23e89f, 0xb243e91f, 0xb663e99f, 0xaa83ea1f, 0xaea3ea9f, 0xa2c3eb1f, 0xa6e3eb9f, 
-    0x9b03ec1f, 0x9f23ec9f, 0x9343ed1f, 0x9763ed9f, 0x8b83ee1f, 0x8fa3ee9f, 0x83c3ef1f, 0x87e3ef9f, 
-    0x7c03f01f, 0x7823f09f, 0x7443f11f, 0x7063f19f, 0x6c83f21f, 0x68a3f29f, 0x64c3f31f, 0x60e3f39f, 
-    0x5d03f41f, 0x5923f49f, 0x5543f51f, 0x5163f59f, 0x4d83f61f, 0x49a3f69f, 0x45c3f71f, 0x41e3f79f, 
-    0x3e03f81f, 0x3a23f89f, 0x3643f91f, 0x3263f99f, 0x2e83fa1f, 0x2aa3fa9f, 0x26c3fb1f, 0x22e3fb9f, 
-    0x1f03fc1f, 0x1b23fc9f, 0x1743fd1f, 0x1363fd9f, 0x0f83fe1f, 0x0ba3fe9f, 0x07c3ff1f, 0x03e3ff9f, 
-    0x00040021, 0x042400a1, 0x08440121, 0x0c6401a1, 0x10840221, 0x14a402a1, 0x18c40321, 0x1ce403a1, 
-    0x21040421, 0x252404a1, 0x29440521, 0x2d6405a1, 0x31840621, 0x35a406a1, 0x39c40721, 0x3de407a1, 
-    0x42040821, 0x462408a1, 0x4a440921, 0x4e6409a1, 0x52840a21, 0x56a40aa1, 0x5ac40b21, 0x5ee40ba1, 
-    0x63040c21, 0x67240ca1, 0x6b440d21, 0x6f640da1, 0x73840e21, 0x77a40ea1, 0x7bc40f21, 0x7fe40fa1, 
-    0x84041021, 0x802410a1, 0x8c441121, 0x886411a1, 0x94841221, 0x90a412a1, 0x9cc41321, 0x98e413a1, 
-    0xa5041421, 0xa12414a1, 0xad441521, 0xa96415a1, 0xb5841621, 0xb1a416a1, 0xbdc41721, 0xb9e417a1, 
-    0xc6041821, 0xc22418a1, 0xce441921, 0xca6419a1, 0xd6841a21, 0xd2a41aa1, 0xdec41b21, 0xdae41ba1, 
-    0xe7041c21, 0xe3241ca1, 0xef441d21, 0xeb641da1, 0xf7841e21, 0xf3a41ea1, 0xffc41f21, 0xfbe41fa1, 
-    0x08042020, 0x0c2420a0, 0x00442120, 0x046421a0, 0x18842220, 0x1ca422a0, 0x10c42320, 0x14e423a0, 
-    0x29042420, 0x2d2424a0, 0x21442520, 0x256425a0, 0x39842620, 0x3da426a0, 0x31c42720, 0x35e427a0, 
-    0x4a042820, 0x4e2428a0, 0x42442920, 0x466429a0, 0x5a842a20, 0x5ea42aa0, 0x52c42b20, 0x56e42ba0, 
-    0x6b042c20, 0x6f242ca0, 0x63442d20, 0x67642da0, 0x7b842e20, 0x7fa42ea0, 0x73c42f20, 0x77e42fa0, 
-    0x8c043020, 0x882430a0, 0x84443120, 0x806431a0, 0x9c843220, 0x98a432a0, 0x94c43320, 0x90e433a0, 
-    0xad043420, 0xa92434a0, 0xa5443520, 0xa16435a0, 0xbd843620, 0xb9a436a0, 0xb5c43720, 0xb1e437a0, 
-    0xce043820, 0xca2438a0, 0xc6443920, 0xc26439a0, 0xde843a20, 0xdaa43aa0, 0xd6c43b20, 0xd2e43ba0, 
-    0xef043c20, 0xeb243ca0, 0xe7443d20, 0xe3643da0, 0xff843e20, 0xfba43ea0, 0xf7c43f20, 0xf3e43fa0, 
-    0x10044023, 0x142440a3, 0x18444123, 0x1c6441a3, 0x00844223, 0x04a442a3, 0x08c44323, 0x0ce443a3, 
-    0x31044423, 0x352444a3, 0x39444523, 0x3d6445a3, 0x21844623, 0x25a446a3, 0x29c44723, 0x2de447a3, 
-    0x52044823, 0x562448a3, 0x5a444923, 0x5e6449a3, 0x42844a23, 0x46a44aa3, 0x4ac44b23, 0x4ee44ba3, 
-    0x73044c23, 0x77244ca3, 0x7b444d23, 0x7f644da3, 0x63844e23, 0x67a44ea3, 0x6bc44f23, 0x6fe44fa3, 
-    0x94045023, 0x902450a3, 0x9c445123, 0x986451a3, 0x84845223, 0x80a452a3, 0x8cc45323, 0x88e453a3, 
-    0xb5045423, 0xb12454a3, 0xbd445523, 0xb96455a3, 0xa5845623, 0xa1a456a3, 0xadc45723, 0xa9e457a3, 
-    0xd6045823, 0xd22458a3, 0xde445923, 0xda6459a3, 0xc6845a23, 0xc2a45aa3, 0xcec45b23, 0xcae45ba3, 
-    0xf7045c23, 0xf3245ca3, 0xff445d23, 0xfb645da3, 0xe7845e23, 0xe3a45ea3, 0xefc45f23, 0xebe45fa3, 
-    0x18046022, 0x1c2460a2, 0x10446122, 0x146461a2, 0x08846222, 0x0ca462a2, 0x00c46322, 0x04e463a2, 
-    0x39046422, 0x3d2464a2, 0x31446522, 0x356465a2, 0x29846622, 0x2da466a2, 0x21c46722, 0x25e467a2, 
-    0x5a046822, 0x5e2468a2, 0x52446922, 0x566469a2, 0x4a846a22, 0x4ea46aa2, 0x42c46b22, 0x46e46ba2, 
-    0x7b046c22, 0x7f246ca2, 0x73446d22, 0x77646da2, 0x6b846e22, 0x6fa46ea2, 0x63c46f22, 0x67e46fa2, 
-    0x9c047022, 0x982470a2, 0x94447122, 0x906471a2, 0x8c847222, 0x88a472a2, 0x84c47322, 0x80e473a2, 
-    0xbd047422, 0xb92474a2, 0xb5447522, 0xb16475a2, 0xad847622, 0xa9a476a2, 0xa5c47722, 0xa1e477a2, 
-    0xde047822, 0xda2478a2, 0xd6447922, 0xd26479a2, 0xce847a22, 0xcaa47aa2, 0xc6c47b22, 0xc2e47ba2, 
-    0xff047c22, 0xfb247ca2, 0xf7447d22, 0xf3647da2, 0xef847e22, 0xeba47ea2, 0xe7c47f22, 0xe3e47fa2, 
-    0x20048025, 0x242480a5, 0x28448125, 0x2c6481a5, 0x30848225, 0x34a482a5, 0x38c48325, 0x3ce483a5, 
-    0x01048425, 0x052484a5, 0x09448525, 0x0d6485a5, 0x11848625, 0x15a486a5, 0x19c48725, 0x1de487a5, 
-    0x62048825, 0x662488a5, 0x6a448925, 0x6e6489a5, 0x72848a25, 0x76a48aa5, 0x7ac48b25, 0x7ee48ba5, 
-    0x43048c25, 0x47248ca5, 0x4b448d25, 0x4f648da5, 0x53848e25, 0x57a48ea5, 0x5bc48f25, 0x5fe48fa5, 
-    0xa4049025, 0xa02490a5, 0xac449125, 0xa86491a5, 0xb4849225, 0xb0a492a5, 0xbcc49325, 0xb8e493a5, 
-    0x85049425, 0x812494a5, 0x8d449525, 0x896495a5, 0x95849625, 0x91a496a5, 0x9dc49725, 0x99e497a5, 
-    0xe6049825, 0xe22498a5, 0xee449925, 0xea6499a5, 0xf6849a25, 0xf2a49aa5, 0xfec49b25, 0xfae49ba5, 
-    0xc7049c25, 0xc3249ca5, 0xcf449d25, 0xcb649da5, 0xd7849e25, 0xd3a49ea5, 0xdfc49f25, 0xdbe49fa5, 
-    0x2804a024, 0x2c24a0a4, 0x2044a124, 0x2464a1a4, 0x3884a224, 0x3ca4a2a4, 0x30c4a324, 0x34e4a3a4, 
-    0x0904a424, 0x0d24a4a4, 0x0144a524, 0x0564a5a4, 0x1984a624, 0x1da4a6a4, 0x11c4a724, 0x15e4a7a4, 
-    0x6a04a824, 0x6e24a8a4, 0x6244a924, 0x6664a9a4, 0x7a84aa24, 0x7ea4aaa4, 0x72c4ab24, 0x76e4aba4, 
-    0x4b04ac24, 0x4f24aca4, 0x4344ad24, 0x4764ada4, 0x5b84ae24, 0x5fa4aea4, 0x53c4af24, 0x57e4afa4, 
-    0xac04b024, 0xa824b0a4, 0xa444b124, 0xa064b1a4, 0xbc84b224, 0xb8a4b2a4, 0xb4c4b324, 0xb0e4b3a4, 
-    0x8d04b424, 0x8924b4a4, 0x8544b524, 0x8164b5a4, 0x9d84b624, 0x99a4b6a4, 0x95c4b724, 0x91e4b7a4, 
-    0xee04b824, 0xea24b8a4, 0xe644b924, 0xe264b9a4, 0xfe84ba24, 0xfaa4baa4, 0xf6c4bb24, 0xf2e4bba4, 
-    0xcf04bc24, 0xcb24bca4, 0xc744bd24, 0xc364bda4, 0xdf84be24, 0xdba4bea4, 0xd7c4bf24, 0xd3e4bfa4, 
-    0x3004c027, 0x3424c0a7, 0x3844c127, 0x3c64c1a7, 0x2084c227, 0x24a4c2a7, 0x28c4c327, 0x2ce4c3a7, 
-    0x1104c427, 0x1524c4a7, 0x1944c527, 0x1d64c5a7, 0x0184c627, 0x05a4c6a7, 0x09c4c727, 0x0de4c7a7, 
-    0x7204c827, 0x7624c8a7, 0x7a44c927, 0x7e64c9a7, 0x6284ca27, 0x66a4caa7, 0x6ac4cb27, 0x6ee4cba7, 
-    0x5304cc27, 0x5724cca7, 0x5b44cd27, 0x5f64cda7, 0x4384ce27, 0x47a4cea7, 0x4bc4cf27, 0x4fe4cfa7, 
-    0xb404d027, 0xb024d0a7, 0xbc44d127, 0xb864d1a7, 0xa484d227, 0xa0a4d2a7, 0xacc4d327, 0xa8e4d3a7, 
-    0x9504d427, 0x9124d4a7, 0x9d44d527, 0x9964d5a7, 0x8584d627, 0x81a4d6a7, 0x8dc4d727, 0x89e4d7a7, 
-    0xf604d827, 0xf224d8a7, 0xfe44d927, 0xfa64d9a7, 0xe684da27, 0xe2a4daa7, 0xeec4db27, 0xeae4dba7, 
-    0xd704dc27, 0xd324dca7, 0xdf44dd27, 0xdb64dda7, 0xc784de27, 0xc3a4dea7, 0xcfc4df27, 0xcbe4dfa7, 
-    0x3804e026, 0x3c24e0a6, 0x3044e126, 0x3464e1a6, 0x2884e226, 0x2ca4e2a6, 0x20c4e326, 0x24e4e3a6, 
-    0x1904e426, 0x1d24e4a6, 0x1144e526, 0x1564e5a6, 0x0984e626, 0x0da4e6a6, 0x01c4e726, 0x05e4e7a6, 
-    0x7a04e826, 0x7e24e8a6, 0x7244e926, 0x7664e9a6, 0x6a84ea26, 0x6ea4eaa6, 0x62c4eb26, 0x66e4eba6, 
-    0x5b04ec26, 0x5f24eca6, 0x5344ed26, 0x5764eda6, 0x4b84ee26, 0x4fa4eea6, 0x43c4ef26, 0x47e4efa6, 
-    0xbc04f026, 0xb824f0a6, 0xb444f126, 0xb064f1a6, 0xac84f226, 0xa8a4f2a6, 0xa4c4f326, 0xa0e4f3a6, 
-    0x9d04f426, 0x9924f4a6, 0x9544f526, 0x9164f5a6, 0x8d84f626, 0x89a4f6a6, 0x85c4f726, 0x81e4f7a6, 
-    0xfe04f826, 0xfa24f8a6, 0xf644f926, 0xf264f9a6, 0xee84fa26, 0xeaa4faa6, 0xe6c4fb26, 0xe2e4fba6, 
-    0xdf04fc26, 0xdb24fca6, 0xd744fd26, 0xd364fda6, 0xcf84fe26, 0xcba4fea6, 0xc7c4ff26, 0xc3e4ffa6, 
-    0x40050029, 0x442500a9, 0x48450129, 0x4c6501a9, 0x50850229, 0x54a502a9, 0x58c50329, 0x5ce503a9, 
-    0x61050429, 0x652504a9, 0x69450529, 0x6d6505a9, 0x71850629, 0x75a506a9, 0x79c50729, 0x7de507a9, 
-    0x02050829, 0x062508a9, 0x0a450929, 0x0e6509a9, 0x12850a29, 0x16a50aa9, 0x1ac50b29, 0x1ee50ba9, 
-    0x23050c29, 0x27250ca9, 0x2b450d29, 0x2f650da9, 0x33850e29, 0x37a50ea9, 0x3bc50f29, 0x3fe50fa9, 
-    0xc4051029, 0xc02510a9, 0xcc451129, 0xc86511a9, 0xd4851229, 0xd0a512a9, 0xdcc51329, 0xd8e513a9, 
-    0xe5051429, 0xe12514a9, 0xed451529, 0xe96515a9, 0xf5851629, 0xf1a516a9, 0xfdc51729, 0xf9e517a9, 
-    0x86051829, 0x822518a9, 0x8e451929, 0x8a6519a9, 0x96851a29, 0x92a51aa9, 0x9ec51b29, 0x9ae51ba9, 
-    0xa7051c29, 0xa3251ca9, 0xaf451d29, 0xab651da9, 0xb7851e29, 0xb3a51ea9, 0xbfc51f29, 0xbbe51fa9, 
-    0x48052028, 0x4c2520a8, 0x40452128, 0x446521a8, 0x58852228, 0x5ca522a8, 0x50c52328, 0x54e523a8, 
-    0x69052428, 0x6d2524a8, 0x61452528, 0x656525a8, 0x79852628, 0x7da526a8, 0x71c52728, 0x75e527a8, 
-    0x0a052828, 0x0e2528a8, 0x02452928, 0x066529a8, 0x1a852a28, 0x1ea52aa8, 0x12c52b28, 0x16e52ba8, 
-    0x2b052c28, 0x2f252ca8, 0x23452d28, 0x27652da8, 0x3b852e28, 0x3fa52ea8, 0x33c52f28, 0x37e52fa8, 
-    0xcc053028, 0xc82530a8, 0xc4453128, 0xc06531a8, 0xdc853228, 0xd8a532a8, 0xd4c53328, 0xd0e533a8, 
-    0xed053428, 0xe92534a8, 0xe5453528, 0xe16535a8, 0xfd853628, 0xf9a536a8, 0xf5c53728, 0xf1e537a8, 
-    0x8e053828, 0x8a2538a8, 0x86453928, 0x826539a8, 0x9e853a28, 0x9aa53aa8, 0x96c53b28, 0x92e53ba8, 
-    0xaf053c28, 0xab253ca8, 0xa7453d28, 0xa3653da8, 0xbf853e28, 0xbba53ea8, 0xb7c53f28, 0xb3e53fa8, 
-    0x5005402b, 0x542540ab, 0x5845412b, 0x5c6541ab, 0x4085422b, 0x44a542ab, 0x48c5432b, 0x4ce543ab, 
-    0x7105442b, 0x752544ab, 0x7945452b, 0x7d6545ab, 0x6185462b, 0x65a546ab, 0x69c5472b, 0x6de547ab, 
-    0x1205482b, 0x162548ab, 0x1a45492b, 0x1e6549ab, 0x02854a2b, 0x06a54aab, 0x0ac54b2b, 0x0ee54bab, 
-    0x33054c2b, 0x37254cab, 0x3b454d2b, 0x3f654dab, 0x23854e2b, 0x27a54eab, 0x2bc54f2b, 0x2fe54fab, 
-    0xd405502b, 0xd02550ab, 0xdc45512b, 0xd86551ab, 0xc485522b, 0xc0a552ab, 0xccc5532b, 0xc8e553ab, 
-    0xf505542b, 0xf12554ab, 0xfd45552b, 0xf96555ab, 0xe585562b, 0xe1a556ab, 0xedc5572b, 0xe9e557ab, 
-    0x9605582b, 0x922558ab, 0x9e45592b, 0x9a6559ab, 0x86855a2b, 0x82a55aab, 0x8ec55b2b, 0x8ae55bab, 
-    0xb7055c2b, 0xb3255cab, 0xbf455d2b, 0xbb655dab, 0xa7855e2b, 0xa3a55eab, 0xafc55f2b, 0xabe55fab, 
-    0x5805602a, 0x5c2560aa, 0x5045612a, 0x546561aa, 0x4885622a, 0x4ca562aa, 0x40c5632a, 0x44e563aa, 
-    0x7905642a, 0x7d2564aa, 0x7145652a, 0x756565aa, 0x6985662a, 0x6da566aa, 0x61c5672a, 0x65e567aa, 
-    0x1a05682a, 0x1e2568aa, 0x1245692a, 0x166569aa, 0x0a856a2a, 0x0ea56aaa, 0x02c56b2a, 0x06e56baa, 
-    0x3b056c2a, 0x3f256caa, 0x33456d2a, 0x37656daa, 0x2b856e2a, 0x2fa56eaa, 0x23c56f2a, 0x27e56faa, 
-    0xdc05702a, 0xd82570aa, 0xd445712a, 0xd06571aa, 0xcc85722a, 0xc8a572aa, 0xc4c5732a, 0xc0e573aa, 
-    0xfd05742a, 0xf92574aa, 0xf545752a, 0xf16575aa, 0xed85762a, 0xe9a576aa, 0xe5c5772a, 0xe1e577aa, 
-    0x9e05782a, 0x9a2578aa, 0x9645792a, 0x926579aa, 0x8e857a2a, 0x8aa57aaa, 0x86c57b2a, 0x82e57baa, 
-    0xbf057c2a, 0xbb257caa, 0xb7457d2a, 0xb3657daa, 0xaf857e2a, 0xaba57eaa, 0xa7c57f2a, 0xa3e57faa, 
-    0x6005802d, 0x642580ad, 0x6845812d, 0x6c6581ad, 0x7085822d, 0x74a582ad, 0x78c5832d, 0x7ce583ad, 
-    0x4105842d, 0x452584ad, 0x4945852d, 0x4d6585ad, 0x5185862d, 0x55a586ad, 0x59c5872d, 0x5de587ad, 
-    0x2205882d, 0x262588ad, 0x2a45892d, 0x2e6589ad, 0x32858a2d, 0x36a58aad, 0x3ac58b2d, 0x3ee58bad, 
-    0x03058c2d, 0x07258cad, 0x0b458d2d, 0x0f658dad, 0x13858e2d, 0x17a58ead, 0x1bc58f2d, 0x1fe58fad, 
-    0xe405902d, 0xe02590ad, 0xec45912d, 0xe86591ad, 0xf485922d, 0xf0a592ad, 0xfcc5932d, 0xf8e593ad, 
-    0xc505942d, 0xc12594ad, 0xcd45952d, 0xc96595ad, 0xd585962d, 0xd1a596ad, 0xddc5972d, 0xd9e597ad, 
-    0xa605982d, 0xa22598ad, 0xae45992d, 0xaa6599ad, 0xb6859a2d, 0xb2a59aad, 0xbec59b2d, 0xbae59bad, 
-    0x87059c2d, 0x83259cad, 0x8f459d2d, 0x8b659dad, 0x97859e2d, 0x93a59ead, 0x9fc59f2d, 0x9be59fad, 
-    0x6805a02c, 0x6c25a0ac, 0x6045a12c, 0x6465a1ac, 0x7885a22c, 0x7ca5a2ac, 0x70c5a32c, 0x74e5a3ac, 
-    0x4905a42c, 0x4d25a4ac, 0x4145a52c, 0x4565a5ac, 0x5985a62c, 0x5da5a6ac, 0x51c5a72c, 0x55e5a7ac, 
-    0x2a05a82c, 0x2e25a8ac, 0x2245a92c, 0x2665a9ac, 0x3a85aa2c, 0x3ea5aaac, 0x32c5ab2c, 0x36e5abac, 
-    0x0b05ac2c, 0x0f25acac, 0x0345ad2c, 0x0765adac, 0x1b85ae2c, 0x1fa5aeac, 0x13c5af2c, 0x17e5afac, 
-    0xec05b02c, 0xe825b0ac, 0xe445b12c, 0xe065b1ac, 0xfc85b22c, 0xf8a5b2ac, 0xf4c5b32c, 0xf0e5b3ac, 
-    0xcd05b42c, 0xc925b4ac, 0xc545b52c, 0xc165b5ac, 0xdd85b62c, 0xd9a5b6ac, 0xd5c5b72c, 0xd1e5b7ac, 
-    0xae05b82c, 0xaa25b8ac, 0xa645b92c, 0xa265b9ac, 0xbe85ba2c, 0xbaa5baac, 0xb6c5bb2c, 0xb2e5bbac, 
-    0x8f05bc2c, 0x8b25bcac, 0x8745bd2c, 0x8365bdac, 0x9f85be2c, 0x9ba5beac, 0x97c5bf2c, 0x93e5bfac, 
-    0x7005c02f, 0x7425c0af, 0x7845c12f, 0x7c65c1af, 0x6085c22f, 0x64a5c2af, 0x68c5c32f, 0x6ce5c3af, 
-    0x5105c42f, 0x5525c4af, 0x5945c52f, 0x5d65c5af, 0x4185c62f, 0x45a5c6af, 0x49c5c72f, 0x4de5c7af, 
-    0x3205c82f, 0x3625c8af, 0x3a45c92f, 0x3e65c9af, 0x2285ca2f, 0x26a5caaf, 0x2ac5cb2f, 0x2ee5cbaf, 
-    0x1305cc2f, 0x1725ccaf, 0x1b45cd2f, 0x1f65cdaf, 0x0385ce2f, 0x07a5ceaf, 0x0bc5cf2f, 0x0fe5cfaf, 
-    0xf405d02f, 0xf025d0af, 0xfc45d12f, 0xf865d1af, 0xe485d22f, 0xe0a5d2af, 0xecc5d32f, 0xe8e5d3af, 
-    0xd505d42f, 0xd125d4af, 0xdd45d52f, 0xd965d5af, 0xc585d62f, 0xc1a5d6af, 0xcdc5d72f, 0xc9e5d7af, 
-    0xb605d82f, 0xb225d8af, 0xbe45d92f, 0xba65d9af, 0xa685da2f, 0xa2a5daaf, 0xaec5db2f, 0xaae5dbaf, 
-    0x9705dc2f, 0x9325dcaf, 0x9f45dd2f, 0x9b65ddaf, 0x8785de2f, 0x83a5deaf, 0x8fc5df2f, 0x8be5dfaf, 
-    0x7805e02e, 0x7c25e0ae, 0x7045e12e, 0x7465e1ae, 0x6885e22e, 0x6ca5e2ae, 0x60c5e32e, 0x64e5e3ae, 
-    0x5905e42e, 0x5d25e4ae, 0x5145e52e, 0x5565e5ae, 0x4985e62e, 0x4da5e6ae, 0x41c5e72e, 0x45e5e7ae, 
-    0x3a05e82e, 0x3e25e8ae, 0x3245e92e, 0x3665e9ae, 0x2a85ea2e, 0x2ea5eaae, 0x22c5eb2e, 0x26e5ebae, 
-    0x1b05ec2e, 0x1f25ecae, 0x1345ed2e, 0x1765edae, 0x0b85ee2e, 0x0fa5eeae, 0x03c5ef2e, 0x07e5efae, 
-    0xfc05f02e, 0xf825f0ae, 0xf445f12e, 0xf065f1ae, 0xec85f22e, 0xe8a5f2ae, 0xe4c5f32e, 0xe0e5f3ae, 
-    0xdd05f42e, 0xd925f4ae, 0xd545f52e, 0xd165f5ae, 0xcd85f62e, 0xc9a5f6ae, 0xc5c5f72e, 0xc1e5f7ae, 
-    0xbe05f82e, 0xba25f8ae, 0xb645f92e, 0xb265f9ae, 0xae85fa2e, 0xaaa5faae, 0xa6c5fb2e, 0xa2e5fbae, 
-    0x9f05fc2e, 0x9b25fcae, 0x9745fd2e, 0x9365fdae, 0x8f85fe2e, 0x8ba5feae, 0x87c5ff2e, 0x83e5ffae, 
-    0x80060031, 0x842600b1, 0x88460131, 0x8c6601b1, 0x90860231, 0x94a602b1, 0x98c60331, 0x9ce603b1, 
-    0xa1060431, 0xa52604b1, 0xa9460531, 0xad6605b1, 0xb1860631, 0xb5a606b1, 0xb9c60731, 0xbde607b1, 
-    0xc2060831, 0xc62608b1, 0xca460931, 0xce6609b1, 0xd2860a31, 0xd6a60ab1, 0xdac60b31, 0xdee60bb1, 
-    0xe3060c31, 0xe7260cb1, 0xeb460d31, 0xef660db1, 0xf3860e31, 0xf7a60eb1, 0xfbc60f31, 0xffe60fb1, 
-    0x04061031, 0x002610b1, 0x0c461131, 0x086611b1, 0x14861231, 0x10a612b1, 0x1cc61331, 0x18e613b1, 
-    0x25061431, 0x212614b1, 0x2d461531, 0x296615b1, 0x35861631, 0x31a616b1, 0x3dc61731, 0x39e617b1, 
-    0x46061831, 0x422618b1, 0x4e461931, 0x4a6619b1, 0x56861a31, 0x52a61ab1, 0x5ec61b31, 0x5ae61bb1, 
-    0x67061c31, 0x63261cb1, 0x6f461d31, 0x6b661db1, 0x77861e31, 0x73a61eb1, 0x7fc61f31, 0x7be61fb1, 
-    0x88062030, 0x8c2620b0, 0x80462130, 0x846621b0, 0x98862230, 0x9ca622b0, 0x90c62330, 0x94e623b0, 
-    0xa9062430, 0xad2624b0, 0xa1462530, 0xa56625b0, 0xb9862630, 0xbda626b0, 0xb1c62730, 0xb5e627b0, 
-    0xca062830, 0xce2628b0, 0xc2462930, 0xc66629b0, 0xda862a30, 0xdea62ab0, 0xd2c62b30, 0xd6e62bb0, 
-    0xeb062c30, 0xef262cb0, 0xe3462d30, 0xe7662db0, 0xfb862e30, 0xffa62eb0, 0xf3c62f30, 0xf7e62fb0, 
-    0x0c063030, 0x082630b0, 0x04463130, 0x006631b0, 0x1c863230, 0x18a632b0, 0x14c63330, 0x10e633b0, 
-    0x2d063430, 0x292634b0, 0x25463530, 0x216635b0, 0x3d863630, 0x39a636b0, 0x35c63730, 0x31e637b0, 
-    0x4e063830, 0x4a2638b0, 0x46463930, 0x426639b0, 0x5e863a30, 0x5aa63ab0, 0x56c63b30, 0x52e63bb0, 
-    0x6f063c30, 0x6b263cb0, 0x67463d30, 0x63663db0, 0x7f863e30, 0x7ba63eb0, 0x77c63f30, 0x73e63fb0, 
-    0x90064033, 0x942640b3, 0x98464133, 0x9c6641b3, 0x80864233, 0x84a642b3, 0x88c64333, 0x8ce643b3, 
-    0xb1064433, 0xb52644b3, 0xb9464533, 0xbd6645b3, 0xa1864633, 0xa5a646b3, 0xa9c64733, 0xade647b3, 
-    0xd2064833, 0xd62648b3, 0xda464933, 0xde6649b3, 0xc2864a33, 0xc6a64ab3, 0xcac64b33, 0xcee64bb3, 
-    0xf3064c33, 0xf7264cb3, 0xfb464d33, 0xff664db3, 0xe3864e33, 0xe7a64eb3, 0xebc64f33, 0xefe64fb3, 
-    0x14065033, 0x102650b3, 0x1c465133, 0x186651b3, 0x04865233, 0x00a652b3, 0x0cc65333, 0x08e653b3, 
-    0x35065433, 0x312654b3, 0x3d465533, 0x396655b3, 0x25865633, 0x21a656b3, 0x2dc65733, 0x29e657b3, 
-    0x56065833, 0x522658b3, 0x5e465933, 0x5a6659b3, 0x46865a33, 0x42a65ab3, 0x4ec65b33, 0x4ae65bb3, 
-    0x77065c33, 0x73265cb3, 0x7f465d33, 0x7b665db3, 0x67865e33, 0x63a65eb3, 0x6fc65f33, 0x6be65fb3, 
-    0x98066032, 0x9c2660b2, 0x90466132, 0x946661b2, 0x88866232, 0x8ca662b2, 0x80c66332, 0x84e663b2, 
-    0xb9066432, 0xbd2664b2, 0xb1466532, 0xb56665b2, 0xa9866632, 0xada666b2, 0xa1c66732, 0xa5e667b2, 
-    0xda066832, 0xde2668b2, 0xd2466932, 0xd66669b2, 0xca866a32, 0xcea66ab2, 0xc2c66b32, 0xc6e66bb2, 
-    0xfb066c32, 0xff266cb2, 0xf3466d32, 0xf7666db2, 0xeb866e32, 0xefa66eb2, 0xe3c66f32, 0xe7e66fb2, 
-    0x1c067032, 0x182670b2, 0x14467132, 0x106671b2, 0x0c867232, 0x08a672b2, 0x04c67332, 0x00e673b2, 
-    0x3d067432, 0x392674b2, 0x35467532, 0x316675b2, 0x2d867632, 0x29a676b2, 0x25c67732, 0x21e677b2, 
-    0x5e067832, 0x5a2678b2, 0x56467932, 0x526679b2, 0x4e867a32, 0x4aa67ab2, 0x46c67b32, 0x42e67bb2, 
-    0x7f067c32, 0x7b267cb2, 0x77467d32, 0x73667db2, 0x6f867e32, 0x6ba67eb2, 0x67c67f32, 0x63e67fb2, 
-    0xa0068035, 0xa42680b5, 0xa8468135, 0xac6681b5, 0xb0868235, 0xb4a682b5, 0xb8c68335, 0xbce683b5, 
-    0x81068435, 0x852684b5, 0x89468535, 0x8d6685b5, 0x91868635, 0x95a686b5, 0x99c68735, 0x9de687b5, 
-    0xe2068835, 0xe62688b5, 0xea468935, 0xee6689b5, 0xf2868a35, 0xf6a68ab5, 0xfac68b35, 0xfee68bb5, 
-    0xc3068c35, 0xc7268cb5, 0xcb468d35, 0xcf668db5, 0xd3868e35, 0xd7a68eb5, 0xdbc68f35, 0xdfe68fb5, 
-    0x24069035, 0x202690b5, 0x2c469135, 0x286691b5, 0x34869235, 0x30a692b5, 0x3cc69335, 0x38e693b5, 
-    0x05069435, 0x012694b5, 0x0d469535, 0x096695b5, 0x15869635, 0x11a696b5, 0x1dc69735, 0x19e697b5, 
-    0x66069835, 0x622698b5, 0x6e469935, 0x6a6699b5, 0x76869a35, 0x72a69ab5, 0x7ec69b35, 0x7ae69bb5, 
-    0x47069c35, 0x43269cb5, 0x4f469d35, 0x4b669db5, 0x57869e35, 0x53a69eb5, 0x5fc69f35, 0x5be69fb5, 
-    0xa806a034, 0xac26a0b4, 0xa046a134, 0xa466a1b4, 0xb886a234, 0xbca6a2b4, 0xb0c6a334, 0xb4e6a3b4, 
-    0x8906a434, 0x8d26a4b4, 0x8146a534, 0x8566a5b4, 0x9986a634, 0x9da6a6b4, 0x91c6a734, 0x95e6a7b4, 
-    0xea06a834, 0xee26a8b4, 0xe246a934, 0xe666a9b4, 0xfa86aa34, 0xfea6aab4, 0xf2c6ab34, 0xf6e6abb4, 
-    0xcb06ac34, 0xcf26acb4, 0xc346ad34, 0xc766adb4, 0xdb86ae34, 0xdfa6aeb4, 0xd3c6af34, 0xd7e6afb4, 
-    0x2c06b034, 0x2826b0b4, 0x2446b134, 0x2066b1b4, 0x3c86b234, 0x38a6b2b4, 0x34c6b334, 0x30e6b3b4, 
-    0x0d06b434, 0x0926b4b4, 0x0546b534, 0x0166b5b4, 0x1d86b634, 0x19a6b6b4, 0x15c6b734, 0x11e6b7b4, 
-    0x6e06b834, 0x6a26b8b4, 0x6646b934, 0x6266b9b4, 0x7e86ba34, 0x7aa6bab4, 0x76c6bb34, 0x72e6bbb4, 
-    0x4f06bc34, 0x4b26bcb4, 0x4746bd34, 0x4366bdb4, 0x5f86be34, 0x5ba6beb4, 0x57c6bf34, 0x53e6bfb4, 
-    0xb006c037, 0xb426c0b7, 0xb846c137, 0xbc66c1b7, 0xa086c237, 0xa4a6c2b7, 0xa8c6c337, 0xace6c3b7, 
-    0x9106c437, 0x9526c4b7, 0x9946c537, 0x9d66c5b7, 0x8186c637, 0x85a6c6b7, 0x89c6c737, 0x8de6c7b7, 
-    0xf206c837, 0xf626c8b7, 0xfa46c937, 0xfe66c9b7, 0xe286ca37, 0xe6a6cab7, 0xeac6cb37, 0xeee6cbb7, 
-    0xd306cc37, 0xd726ccb7, 0xdb46cd37, 0xdf66cdb7, 0xc386ce37, 0xc7a6ceb7, 0xcbc6cf37, 0xcfe6cfb7, 
-    0x3406d037, 0x3026d0b7, 0x3c46d137, 0x3866d1b7, 0x2486d237, 0x20a6d2b7, 0x2cc6d337, 0x28e6d3b7, 
-    0x1506d437, 0x1126d4b7, 0x1d46d537, 0x1966d5b7, 0x0586d637, 0x01a6d6b7, 0x0dc6d737, 0x09e6d7b7, 
-    0x7606d837, 0x7226d8b7, 0x7e46d937, 0x7a66d9b7, 0x6686da37, 0x62a6dab7, 0x6ec6db37, 0x6ae6dbb7, 
-    0x5706dc37, 0x5326dcb7, 0x5f46dd37, 0x5b66ddb7, 0x4786de37, 0x43a6deb7, 0x4fc6df37, 0x4be6dfb7, 
-    0xb806e036, 0xbc26e0b6, 0xb046e136, 0xb466e1b6, 0xa886e236, 0xaca6e2b6, 0xa0c6e336, 0xa4e6e3b6, 
-    0x9906e436, 0x9d26e4b6, 0x9146e536, 0x9566e5b6, 0x8986e636, 0x8da6e6b6, 0x81c6e736, 0x85e6e7b6, 
-    0xfa06e836, 0xfe26e8b6, 0xf246e936, 0xf666e9b6, 0xea86ea36, 0xeea6eab6, 0xe2c6eb36, 0xe6e6ebb6, 
-    0xdb06ec36, 0xdf26ecb6, 0xd346ed36, 0xd766edb6, 0xcb86ee36, 0xcfa6eeb6, 0xc3c6ef36, 0xc7e6efb6, 
-    0x3c06f036, 0x3826f0b6, 0x3446f136, 0x3066f1b6, 0x2c86f236, 0x28a6f2b6, 0x24c6f336, 0x20e6f3b6, 
-    0x1d06f436, 0x1926f4b6, 0x1546f536, 0x1166f5b6, 0x0d86f636, 0x09a6f6b6, 0x05c6f736, 0x01e6f7b6, 
-    0x7e06f836, 0x7a26f8b6, 0x7646f936, 0x7266f9b6, 0x6e86fa36, 0x6aa6fab6, 0x66c6fb36, 0x62e6fbb6, 
-    0x5f06fc36, 0x5b26fcb6, 0x5746fd36, 0x5366fdb6, 0x4f86fe36, 0x4ba6feb6, 0x47c6ff36, 0x43e6ffb6, 
-    0xc0070039, 0xc42700b9, 0xc8470139, 0xcc6701b9, 0xd0870239, 0xd4a702b9, 0xd8c70339, 0xdce703b9, 
-    0xe1070439, 0xe52704b9, 0xe9470539, 0xed6705b9, 0xf1870639, 0xf5a706b9, 0xf9c70739, 0xfde707b9, 
-    0x82070839, 0x862708b9, 0x8a470939, 0x8e6709b9, 0x92870a39, 0x96a70ab9, 0x9ac70b39, 0x9ee70bb9, 
-    0xa3070c39, 0xa7270cb9, 0xab470d39, 0xaf670db9, 0xb3870e39, 0xb7a70eb9, 0xbbc70f39, 0xbfe70fb9, 
-    0x44071039, 0x402710b9, 0x4c471139, 0x486711b9, 0x54871239, 0x50a712b9, 0x5cc71339, 0x58e713b9, 
-    0x65071439, 0x612714b9, 0x6d471539, 0x696715b9, 0x75871639, 0x71a716b9, 0x7dc71739, 0x79e717b9, 
-    0x06071839, 0x022718b9, 0x0e471939, 0x0a6719b9, 0x16871a39, 0x12a71ab9, 0x1ec71b39, 0x1ae71bb9, 
-    0x27071c39, 0x23271cb9, 0x2f471d39, 0x2b671db9, 0x37871e39, 0x33a71eb9, 0x3fc71f39, 0x3be71fb9, 
-    0xc8072038, 0xcc2720b8, 0xc0472138, 0xc46721b8, 0xd8872238, 0xdca722b8, 0xd0c72338, 0xd4e723b8, 
-    0xe9072438, 0xed2724b8, 0xe1472538, 0xe56725b8, 0xf9872638, 0xfda726b8, 0xf1c72738, 0xf5e727b8, 
-    0x8a072838, 0x8e2728b8, 0x82472938, 0x866729b8, 0x9a872a38, 0x9ea72ab8, 0x92c72b38, 0x96e72bb8, 
-    0xab072c38, 0xaf272cb8, 0xa3472d38, 0xa7672db8, 0xbb872e38, 0xbfa72eb8, 0xb3c72f38, 0xb7e72fb8, 
-    0x4c073038, 0x482730b8, 0x44473138, 0x406731b8, 0x5c873238, 0x58a732b8, 0x54c73338, 0x50e733b8, 
-    0x6d073438, 0x692734b8, 0x65473538, 0x616735b8, 0x7d873638, 0x79a736b8, 0x75c73738, 0x71e737b8, 
-    0x0e073838, 0x0a2738b8, 0x06473938, 0x026739b8, 0x1e873a38, 0x1aa73ab8, 0x16c73b38, 0x12e73bb8, 
-    0x2f073c38, 0x2b273cb8, 0x27473d38, 0x23673db8, 0x3f873e38, 0x3ba73eb8, 0x37c73f38, 0x33e73fb8, 
-    0xd007403b, 0xd42740bb, 0xd847413b, 0xdc6741bb, 0xc087423b, 0xc4a742bb, 0xc8c7433b, 0xcce743bb, 
-    0xf107443b, 0xf52744bb, 0xf947453b, 0xfd6745bb, 0xe187463b, 0xe5a746bb, 0xe9c7473b, 0xede747bb, 
-    0x9207483b, 0x962748bb, 0x9a47493b, 0x9e6749bb, 0x82874a3b, 0x86a74abb, 0x8ac74b3b, 0x8ee74bbb, 
-    0xb3074c3b, 0xb7274cbb, 0xbb474d3b, 0xbf674dbb, 0xa3874e3b, 0xa7a74ebb, 0xabc74f3b, 0xafe74fbb, 
-    0x5407503b, 0x502750bb, 0x5c47513b, 0x586751bb, 0x4487523b, 0x40a752bb, 0x4cc7533b, 0x48e753bb, 
-    0x7507543b, 0x712754bb, 0x7d47553b, 0x796755bb, 0x6587563b, 0x61a756bb, 0x6dc7573b, 0x69e757bb, 
-    0x1607583b, 0x122758bb, 0x1e47593b, 0x1a6759bb, 0x06875a3b, 0x02a75abb, 0x0ec75b3b, 0x0ae75bbb, 
-    0x37075c3b, 0x33275cbb, 0x3f475d3b, 0x3b675dbb, 0x27875e3b, 0x23a75ebb, 0x2fc75f3b, 0x2be75fbb, 
-    0xd807603a, 0xdc2760ba, 0xd047613a, 0xd46761ba, 0xc887623a, 0xcca762ba, 0xc0c7633a, 0xc4e763ba, 
-    0xf907643a, 0xfd2764ba, 0xf147653a, 0xf56765ba, 0xe987663a, 0xeda766ba, 0xe1c7673a, 0xe5e767ba, 
-    0x9a07683a, 0x9e2768ba, 0x9247693a, 0x966769ba, 0x8a876a3a, 0x8ea76aba, 0x82c76b3a, 0x86e76bba, 
-    0xbb076c3a, 0xbf276cba, 0xb3476d3a, 0xb7676dba, 0xab876e3a, 0xafa76eba, 0xa3c76f3a, 0xa7e76fba, 
-    0x5c07703a, 0x582770ba, 0x5447713a, 0x506771ba, 0x4c87723a, 0x48a772ba, 0x44c7733a, 0x40e773ba, 
-    0x7d07743a, 0x792774ba, 0x7547753a, 0x716775ba, 0x6d87763a, 0x69a776ba, 0x65c7773a, 0x61e777ba, 
-    0x1e07783a, 0x1a2778ba, 0x1647793a, 0x126779ba, 0x0e877a3a, 0x0aa77aba, 0x06c77b3a, 0x02e77bba, 
-    0x3f077c3a, 0x3b277cba, 0x37477d3a, 0x33677dba, 0x2f877e3a, 0x2ba77eba, 0x27c77f3a, 0x23e77fba, 
-    0xe007803d, 0xe42780bd, 0xe847813d, 0xec6781bd, 0xf087823d, 0xf4a782bd, 0xf8c7833d, 0xfce783bd, 
-    0xc107843d, 0xc52784bd, 0xc947853d, 0xcd6785bd, 0xd187863d, 0xd5a786bd, 0xd9c7873d, 0xdde787bd, 
-    0xa207883d, 0xa62788bd, 0xaa47893d, 0xae6789bd, 0xb2878a3d, 0xb6a78abd, 0xbac78b3d, 0xbee78bbd, 
-    0x83078c3d, 0x87278cbd, 0x8b478d3d, 0x8f678dbd, 0x93878e3d, 0x97a78ebd, 0x9bc78f3d, 0x9fe78fbd, 
-    0x6407903d, 0x602790bd, 0x6c47913d, 0x686791bd, 0x7487923d, 0x70a792bd, 0x7cc7933d, 0x78e793bd, 
-    0x4507943d, 0x412794bd, 0x4d47953d, 0x496795bd, 0x5587963d, 0x51a796bd, 0x5dc7973d, 0x59e797bd, 
-    0x2607983d, 0x222798bd, 0x2e47993d, 0x2a6799bd, 0x36879a3d, 0x32a79abd, 0x3ec79b3d, 0x3ae79bbd, 
-    0x07079c3d, 0x03279cbd, 0x0f479d3d, 0x0b679dbd, 0x17879e3d, 0x13a79ebd, 0x1fc79f3d, 0x1be79fbd, 
-    0xe807a03c, 0xec27a0bc, 0xe047a13c, 0xe467a1bc, 0xf887a23c, 0xfca7a2bc, 0xf0c7a33c, 0xf4e7a3bc, 
-    0xc907a43c, 0xcd27a4bc, 0xc147a53c, 0xc567a5bc, 0xd987a63c, 0xdda7a6bc, 0xd1c7a73c, 0xd5e7a7bc, 
-    0xaa07a83c, 0xae27a8bc, 0xa247a93c, 0xa667a9bc, 0xba87aa3c, 0xbea7aabc, 0xb2c7ab3c, 0xb6e7abbc, 
-    0x8b07ac3c, 0x8f27acbc, 0x8347ad3c, 0x8767adbc, 0x9b87ae3c, 0x9fa7aebc, 0x93c7af3c, 0x97e7afbc, 
-    0x6c07b03c, 0x6827b0bc, 0x6447b13c, 0x6067b1bc, 0x7c87b23c, 0x78a7b2bc, 0x74c7b33c, 0x70e7b3bc, 
-    0x4d07b43c, 0x4927b4bc, 0x4547b53c, 0x4167b5bc, 0x5d87b63c, 0x59a7b6bc, 0x55c7b73c, 0x51e7b7bc, 
-    0x2e07b83c, 0x2a27b8bc, 0x2647b93c, 0x2267b9bc, 0x3e87ba3c, 0x3aa7babc, 0x36c7bb3c, 0x32e7bbbc, 
-    0x0f07bc3c, 0x0b27bcbc, 0x0747bd3c, 0x0367bdbc, 0x1f87be3c, 0x1ba7bebc, 0x17c7bf3c, 0x13e7bfbc, 
-    0xf007c03f, 0xf427c0bf, 0xf847c13f, 0xfc67c1bf, 0xe087c23f, 0xe4a7c2bf, 0xe8c7c33f, 0xece7c3bf, 
-    0xd107c43f, 0xd527c4bf, 0xd947c53f, 0xdd67c5bf, 0xc187c63f, 0xc5a7c6bf, 0xc9c7c73f, 0xcde7c7bf, 
-    0xb207c83f, 0xb627c8bf, 0xba47c93f, 0xbe67c9bf, 0xa287ca3f, 0xa6a7cabf, 0xaac7cb3f, 0xaee7cbbf, 
-    0x9307cc3f, 0x9727ccbf, 0x9b47cd3f, 0x9f67cdbf, 0x8387ce3f, 0x87a7cebf, 0x8bc7cf3f, 0x8fe7cfbf, 
-    0x7407d03f, 0x7027d0bf, 0x7c47d13f, 0x7867d1bf, 0x6487d23f, 0x60a7d2bf, 0x6cc7d33f, 0x68e7d3bf, 
-    0x5507d43f, 0x5127d4bf, 0x5d47d53f, 0x5967d5bf, 0x4587d63f, 0x41a7d6bf, 0x4dc7d73f, 0x49e7d7bf, 
-    0x3607d83f, 0x3227d8bf, 0x3e47d93f, 0x3a67d9bf, 0x2687da3f, 0x22a7dabf, 0x2ec7db3f, 0x2ae7dbbf, 
-    0x1707dc3f, 0x1327dcbf, 0x1f47dd3f, 0x1b67ddbf, 0x0787de3f, 0x03a7debf, 0x0fc7df3f, 0x0be7dfbf, 
-    0xf807e03e, 0xfc27e0be, 0xf047e13e, 0xf467e1be, 0xe887e23e, 0xeca7e2be, 0xe0c7e33e, 0xe4e7e3be, 
-    0xd907e43e, 0xdd27e4be, 0xd147e53e, 0xd567e5be, 0xc987e63e, 0xcda7e6be, 0xc1c7e73e, 0xc5e7e7be, 
-    0xba07e83e, 0xbe27e8be, 0xb247e93e, 0xb667e9be, 0xaa87ea3e, 0xaea7eabe, 0xa2c7eb3e, 0xa6e7ebbe, 
-    0x9b07ec3e, 0x9f27ecbe, 0x9347ed3e, 0x9767edbe, 0x8b87ee3e, 0x8fa7eebe, 0x83c7ef3e, 0x87e7efbe, 
-    0x7c07f03e, 0x7827f0be, 0x7447f13e, 0x7067f1be, 0x6c87f23e, 0x68a7f2be, 0x64c7f33e, 0x60e7f3be, 
-    0x5d07f43e, 0x5927f4be, 0x5547f53e, 0x5167f5be, 0x4d87f63e, 0x49a7f6be, 0x45c7f73e, 0x41e7f7be, 
-    0x3e07f83e, 0x3a27f8be, 0x3647f93e, 0x3267f9be, 0x2e87fa3e, 0x2aa7fabe, 0x26c7fb3e, 0x22e7fbbe, 
-    0x1f07fc3e, 0x1b27fcbe, 0x1747fd3e, 0x1367fdbe, 0x0f87fe3e, 0x0ba7febe, 0x07c7ff3e, 0x03e7ffbe 
-};
@@ -5,20 +5,32 @@ echo "🛠️  Cleaning previous build..."
 rm -rf build
 mkdir -p build
 
-echo "🚧 Compiling Metal shader..."
-xcrun -sdk macosx metal -o mineKernel.metallib mineKernel.metal
-echo "✅ Metal shader compiled successfully."
+# macOS builds the Metal backend; elsewhere the miner runs on cpu_miner.cpp alone
+OS=$(uname -s)
+if [ "$OS" = "Darwin" ]; then
+  echo "🚧 Compiling Metal shader..."
+  xcrun -sdk macosx metal -o mineKernel.metallib mineKernel.metal
+  echo "✅ Metal shader compiled successfully."
+fi
 
 OPENSSL_PREFIX=$(brew --prefix openssl@3 2>/dev/null || echo "")
 BOOST_PREFIX="/usr/local"
 BITCOIN_PREFIX=$(brew --prefix libbitcoin-system 2>/dev/null || echo "/usr/local")
 CURL_PREFIX=$(brew --prefix curl 2>/dev/null || echo "")
 
-SDK_PATH=$(xcrun --sdk macosx --show-sdk-path)
-
-CXX=clang++
-
-BASE_CXXFLAGS="-std=c++20 -Wall -Wextra -g -isysroot $SDK_PATH \
+if [ "$OS" = "Darwin" ]; then
+  SDK_PATH=$(xcrun --sdk macosx --show-sdk-path)
+  CXX=clang++
+  PLATFORM_CXXFLAGS="-isysroot $SDK_PATH"
+  PLATFORM_LDFLAGS="-lbitcoin-system -lboost_system -lboost_thread \
+    -framework Metal -framework Foundation -framework OpenCL"
+else
+  CXX=${CXX:-c++}
+  PLATFORM_CXXFLAGS=""
+  PLATFORM_LDFLAGS=""
+fi
+
+BASE_CXXFLAGS="-std=c++20 -Wall -Wextra -g $PLATFORM_CXXFLAGS \
   -I. \
   ${OPENSSL_PREFIX:+-I${OPENSSL_PREFIX}/include} \
   ${BOOST_PREFIX:+-I${BOOST_PREFIX}/include} \
@@ -29,13 +41,30 @@ BASE_LDFLAGS="${OPENSSL_PREFIX:+-L${OPENSSL_PREFIX}/lib} \
   ${BOOST_PREFIX:+-L${BOOST_PREFIX}/lib} \
   ${BITCOIN_PREFIX:+-L${BITCOIN_PREFIX}/lib} \
   ${CURL_PREFIX:+-L${CURL_PREFIX}/lib} \
-  -lcrypto -lssl \
-  -lbitcoin-system \
-  -lboost_system -lboost_thread -lpthread \
+  -lcrypto -lssl -lpthread \
   -lcurl -lncurses \
-  -framework Metal -framework Foundation"
-
-OPT_FLAGS="-O3 -march=native"
+  $PLATFORM_LDFLAGS"
+
+# No -march=native: one binary runs on the whole fleet. Wider ISAs are confined to
+# the kernel files below and picked at runtime by cpu_dispatch.cpp.
+OPT_FLAGS="-O3"
+
+# Per-kernel ISA flags; the x86 SIMD kernels fall back to scalar elsewhere
+ARCH=$(uname -m)
+AVX2_FLAGS=""
+AVX512_FLAGS=""
+SHANI_FLAGS=""
+if [ "$ARCH" = "x86_64" ]; then
+  AVX2_FLAGS="-mavx2"
+  AVX512_FLAGS="-mavx512f -mavx512vl"
+  SHANI_FLAGS="-msha -msse4.1"
+fi
+# The ILP kernel must stay scalar: its interleaved streams are the point
+if $CXX --version 2>/dev/null | grep -q clang; then
+  ILP_FLAGS="-fno-vectorize -fno-slp-vectorize"
+else
+  ILP_FLAGS="-fno-tree-vectorize"
+fi
 
 echo "🔧 Compiling source files..."
 
@@ -50,13 +79,111 @@ $CXX $BASE_CXXFLAGS -c sha256_wrapper.cpp -o build/sha256_wrapper.o
 $CXX $BASE_CXXFLAGS $OPT_FLAGS -c sha256_compress.cpp -o build/sha256_compress.o
 $CXX $BASE_CXXFLAGS $OPT_FLAGS -c midstate_utils.cpp -o build/midstate_utils.o
 
-$CXX $BASE_CXXFLAGS -c rpc.cpp -o build/rpc.o
-$CXX $BASE_CXXFLAGS -c metal_miner.mm -o build/metal_miner.o
+# Template ingest: in-place transaction parsing and multi-buffer txid/wtxid hashing
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c sha256_multibuffer.cpp -o build/sha256_multibuffer.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c transaction.cpp -o build/transaction.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c worker_pool.cpp -o build/worker_pool.o
+
+# CPU nonce scan kernels and the runtime dispatcher
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c cpu_dispatch.cpp -o build/cpu_dispatch.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c nonce_scan.cpp -o build/nonce_scan.o
+# The 8- and 16-lane portable kernels use vectors wider than the baseline ISA.
+# GCC's ABI warnings for them come from helpers it emits at the end of the file,
+# past any diagnostic pragma, so they are disabled for this file only.
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -Wno-psabi -c sha256_simd.cpp -o build/sha256_simd.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $ILP_FLAGS -c sha256_ilp.cpp -o build/sha256_ilp.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $AVX2_FLAGS -c sha256_avx2.cpp -o build/sha256_avx2.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $AVX512_FLAGS -c sha256_avx512.cpp -o build/sha256_avx512.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $SHANI_FLAGS -c sha256_shani.cpp -o build/sha256_shani.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $AVX2_FLAGS -c sha256_bitslice_avx2.cpp -o build/sha256_bitslice_avx2.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $AVX512_FLAGS -c sha256_bitslice_avx512.cpp -o build/sha256_bitslice_avx512.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c sha256_jit.cpp -o build/sha256_jit.o
 
-$CXX ${BASE_CXXFLAGS} $OPT_FLAGS -c main.cpp -o build/main.o
+$CXX $BASE_CXXFLAGS -c rpc.cpp -o build/rpc.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c gpu_job.cpp -o build/gpu_job.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c cpu_miner.cpp -o build/cpu_miner.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c nonce_scheduler.cpp -o build/nonce_scheduler.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c job_factory.cpp -o build/job_factory.o
+if [ "$OS" = "Darwin" ]; then
+  $CXX $BASE_CXXFLAGS -c metal_miner.mm -o build/metal_miner.o
+fi
+
+# The OpenCL backend (MINER_BACKEND=...,opencl) is built in wherever OpenCL is
+# installed; it lives in build/opencl, so it is linked explicitly. It reads
+# mineKernel.cl from the working directory.
+OPENCL_OBJS=""
+OPENCL_LDFLAGS=""
+OPENCL_CXXFLAGS=""
+if [ "$OS" = "Darwin" ] || [ -f /usr/include/CL/cl.h ]; then
+  [ "$OS" = "Darwin" ] || OPENCL_LDFLAGS="-lOpenCL"
+  mkdir -p build/opencl
+  $CXX $BASE_CXXFLAGS $OPT_FLAGS -c opencl_miner.cpp -o build/opencl/opencl_miner.o
+  OPENCL_OBJS="build/opencl/opencl_miner.o"
+  OPENCL_CXXFLAGS="-DMINER_OPENCL"
+fi
+
+# The Vulkan backend (MINER_BACKEND=...,vulkan) likewise, wherever glslangValidator
+# and the Vulkan headers are: the LunarG SDK (MoltenVK on macOS) via VULKAN_SDK,
+# or the distribution's packages, whose loader also finds Mesa's lavapipe. It
+# reads mineKernel.spv from the working directory.
+VULKAN_OBJS=""
+VULKAN_LDFLAGS=""
+VULKAN_CXXFLAGS=""
+if command -v glslangValidator >/dev/null 2>&1 && { [ -n "$VULKAN_SDK" ] || [ -f /usr/include/vulkan/vulkan.h ]; }; then
+  echo "🚧 Compiling Vulkan shader..."
+  glslangValidator -V mineKernel.comp -o mineKernel.spv
+  mkdir -p build/vulkan
+  $CXX $BASE_CXXFLAGS $OPT_FLAGS ${VULKAN_SDK:+-I"$VULKAN_SDK/include"} -c vulkan_miner.cpp -o build/vulkan/vulkan_miner.o
+  VULKAN_OBJS="build/vulkan/vulkan_miner.o"
+  VULKAN_LDFLAGS="${VULKAN_SDK:+-L$VULKAN_SDK/lib} -lvulkan"
+  VULKAN_CXXFLAGS="-DMINER_VULKAN"
+fi
+
+$CXX ${BASE_CXXFLAGS} $OPT_FLAGS $OPENCL_CXXFLAGS $VULKAN_CXXFLAGS -c main.cpp -o build/main.o
 $CXX ${BASE_CXXFLAGS} -c metal_ui.cpp -o build/metal_ui.o
 
 echo "🧩 Linking..."
-$CXX build/*.o $BASE_LDFLAGS -o build/quantum_miner
+$CXX build/*.o $OPENCL_OBJS $VULKAN_OBJS $BASE_LDFLAGS $OPENCL_LDFLAGS $VULKAN_LDFLAGS -o build/quantum_miner
+
+# Standalone kernel benchmark, linked against the scan kernels only
+KERNEL_OBJS="build/nonce_scan.o build/sha256_simd.o build/sha256_ilp.o build/sha256_avx2.o build/sha256_avx512.o \
+  build/sha256_shani.o build/sha256_bitslice_avx2.o build/sha256_bitslice_avx512.o build/sha256_jit.o \
+  build/sha256_compress.o build/midstate_utils.o build/cpu_dispatch.o build/sha256_wrapper.o"
+$CXX $BASE_CXXFLAGS $OPT_FLAGS bench_kernels.cpp $KERNEL_OBJS $BASE_LDFLAGS -o build/bench_kernels
+
+# Rotate vs table-lookup sigma on the compile-time unrolled transform; header-only
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $AVX2_FLAGS bench_sigma.cpp -o build/bench_sigma
+
+# Metal kernels run on the CPU through metal_shim.hpp, to validate shader changes
+# without a GPU; kept out of build/*.o so they stay out of the miner
+mkdir -p build/metal_cpu
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -c metal_cpu.cpp -o build/metal_cpu/metal_cpu.o
+# GCC can't silence the kernels' `#pragma unroll` from inside the shim: unknown
+# pragmas are reported before any diagnostic pragma takes effect
+$CXX $BASE_CXXFLAGS $OPT_FLAGS -Wno-unknown-pragmas -Imetal_shim -c metal_cpu_kernels.cpp -o build/metal_cpu/metal_cpu_kernels.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS bench_metal_cpu.cpp build/metal_cpu/*.o build/gpu_job.o $KERNEL_OBJS $BASE_LDFLAGS -o build/bench_metal_cpu
+
+# OpenCL backend check
+if [ -n "$OPENCL_OBJS" ]; then
+  $CXX $BASE_CXXFLAGS $OPT_FLAGS bench_gpu.cpp $OPENCL_OBJS build/gpu_job.o $KERNEL_OBJS \
+    $BASE_LDFLAGS $OPENCL_LDFLAGS -o build/bench_opencl
+fi
+
+# Vulkan backend check, e.g. on lavapipe: VK_ICD_FILENAMES=.../lvp_icd.x86_64.json build/bench_vulkan
+if [ -n "$VULKAN_OBJS" ]; then
+  $CXX $BASE_CXXFLAGS $OPT_FLAGS -DBENCH_VULKAN bench_gpu.cpp $VULKAN_OBJS build/gpu_job.o $KERNEL_OBJS \
+    $BASE_LDFLAGS $VULKAN_LDFLAGS -o build/bench_vulkan
+fi
+
+# Unit tests: Boost.Test's header-only runner in test_main.cpp, linked against
+# every miner object but main.o
+echo "🧪 Running unit tests..."
+mkdir -p build/tests
+TEST_SOURCES="test_transaction.cpp test_worker_pool.cpp test_job_factory.cpp test_cpu_miner.cpp \
+  test_nonce_scheduler.cpp test_scan_kernels.cpp"
+TEST_OBJS=$(ls build/*.o | grep -v '^build/main\.o$')
+$CXX $BASE_CXXFLAGS -c test_main.cpp -o build/tests/test_main.o
+$CXX $BASE_CXXFLAGS $OPT_FLAGS $TEST_SOURCES build/tests/test_main.o $TEST_OBJS $BASE_LDFLAGS -o build/tests/unit_tests
+build/tests/unit_tests
 
 echo "✅ Build complete."
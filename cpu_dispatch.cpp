@@ -0,0 +1,261 @@
+#include "cpu_dispatch.hpp"
+#include "sha256_avx2.hpp"
+#include "sha256_avx512.hpp"
+#include "sha256_bitslice.hpp"
+#include "sha256_jit.hpp"
+#include "sha256_shani.hpp"
+#include "sha256_simd.hpp"
+#include "sha256_wrapper.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+
+static uint64_t readXcr0() {
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (uint64_t(hi) << 32) | lo;
+}
+
+static CpuFeatures detectCpuFeatures() {
+    CpuFeatures f;
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return f;
+    f.ssse3 = ecx & (1u << 9);
+    f.sse41 = ecx & (1u << 19);
+    bool osxsave = ecx & (1u << 27);
+
+    // The OS must save YMM (and for AVX-512, opmask and ZMM) state across switches
+    uint64_t xcr0 = osxsave ? readXcr0() : 0;
+    bool ymmState = (xcr0 & 0x6) == 0x6;
+    bool zmmState = (xcr0 & 0xe6) == 0xe6;
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return f;
+    f.sha = ebx & (1u << 29);
+    f.avx2 = ymmState && (ebx & (1u << 5));
+    f.avx512f = zmmState && (ebx & (1u << 16));
+    f.avx512vl = zmmState && (ebx & (1u << 31));
+    return f;
+}
+
+#else
+
+static CpuFeatures detectCpuFeatures() {
+    return CpuFeatures();
+}
+
+#endif
+
+const CpuFeatures& cpuFeatures() {
+    static const CpuFeatures features = detectCpuFeatures();
+    return features;
+}
+
+struct ScanKernelEntry {
+    const char* name;
+    ScanNoncesFn fn;
+    bool (*supported)(const CpuFeatures&);
+};
+
+struct HashKernelEntry {
+    const char* name;
+    Sha256dFn fn;
+    bool (*supported)(const CpuFeatures&);
+};
+
+static void sha256dOpenSSL(const uint8_t* data, size_t len, uint8_t* out) {
+    uint8_t first[32];
+    sha256(data, len, first);
+    sha256(first, 32, out);
+}
+
+static const ScanKernelEntry scanKernels[] = {
+    {"scalar", scanNoncesScalar, [](const CpuFeatures&) { return true; }},
+    {"simd4", scanNoncesSIMD<4>, [](const CpuFeatures&) { return true; }},
+    {"simd8", scanNoncesSIMD<8>, [](const CpuFeatures&) { return true; }},
+    {"simd16", scanNoncesSIMD<16>, [](const CpuFeatures&) { return true; }},
+    {"shani", scanNoncesSHANI, [](const CpuFeatures& f) { return f.sha && f.ssse3 && f.sse41; }},
+    {"avx2", scanNoncesAVX2, [](const CpuFeatures& f) { return f.avx2; }},
+    {"avx512", scanNoncesAVX512, [](const CpuFeatures& f) { return f.avx512f && f.avx512vl; }},
+    {"bitslice256", scanNoncesBitslice256, [](const CpuFeatures& f) { return f.avx2; }},
+    {"bitslice512", scanNoncesBitslice512, [](const CpuFeatures& f) { return f.avx512f && f.avx512vl; }},
+    {"jit", scanNoncesJIT, [](const CpuFeatures&) { return jitAvailable(); }},
+};
+
+// In preference order: runHashDispatch takes the first that passes
+static const HashKernelEntry hashKernels[] = {
+    {"shani", sha256d_shani, [](const CpuFeatures&) { return shaniAvailable(); }},
+    {"openssl", sha256dOpenSSL, [](const CpuFeatures&) { return true; }},
+};
+
+std::array<uint8_t, 76> genesisHeaderPrefix() {
+    static const char* headerHex =
+        "0100000000000000000000000000000000000000000000000000000000000000"
+        "000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa"
+        "4b1e5e4a29ab5f49ffff001d";
+
+    std::array<uint8_t, 76> header;
+    for (size_t i = 0; i < header.size(); ++i) {
+        char byteHex[3] = {headerHex[i * 2], headerHex[i * 2 + 1], 0};
+        header[i] = (uint8_t)std::strtoul(byteHex, nullptr, 16);
+    }
+    return header;
+}
+
+ScanJob genesisScanJob(uint32_t topTargetLimb) {
+    std::array<uint8_t, 76> header = genesisHeaderPrefix();
+
+    std::array<uint32_t, 8> midstate = sha256Midstate(std::span<const uint8_t, 64>(header.data(), 64));
+
+    // Little-endian target: difficulty 1 (bits 0x1d00ffff) below the top limb
+    std::vector<uint8_t> target(32, 0);
+    target[26] = 0xff;
+    target[27] = 0xff;
+    for (int i = 0; i < 4; ++i)
+        target[28 + i] = (topTargetLimb >> (8 * i)) & 0xff;
+
+    return makeScanJob(midstate, std::vector<uint8_t>(header.begin() + 64, header.end()), target);
+}
+
+// Known answers: the genesis nonce must be the only hit around it at difficulty 1
+// (early-exit path), and with a loose target (full compare path) a kernel must
+// agree with the reference hash on a range with unaligned ends.
+static bool selfTestScan(ScanNoncesFn fn) {
+    const uint32_t genesisNonce = 2083236893u;
+    std::vector<uint32_t> hits;
+    if (fn(genesisScanJob(0), genesisNonce - 2047, 4096, hits) != 4096) return false;
+    if (hits != std::vector<uint32_t>{genesisNonce}) return false;
+
+    ScanJob loose = genesisScanJob(0x00ffffff);
+    const uint32_t start = 1000, count = 3000;
+    std::vector<uint32_t> expected;
+    std::array<uint32_t, 8> hash;
+    for (uint32_t nonce = start; nonce < start + count; ++nonce) {
+        hashHeaderNonce(loose, nonce, hash);
+        if (meetsTarget(hash, loose.target)) expected.push_back(nonce);
+    }
+    hits.clear();
+    if (fn(loose, start, count, hits) != count) return false;
+    return hits == expected;
+}
+
+static bool selfTestHash(Sha256dFn fn) {
+    struct Vector { const char* message; uint8_t digest[32]; };
+    static const Vector vectors[] = {
+        {"abc",
+         {0x4f, 0x8b, 0x42, 0xc2, 0x2d, 0xd3, 0x72, 0x9b, 0x51, 0x9b, 0xa6, 0xf6, 0x8d, 0x2d, 0xa7, 0xcc,
+          0x5b, 0x2d, 0x60, 0x6d, 0x05, 0xda, 0xed, 0x5a, 0xd5, 0x12, 0x8c, 0xc0, 0x3e, 0x6c, 0x63, 0x58}},
+        // 56 bytes: the length no longer fits, so padding spills into a second block
+        {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+         {0x0c, 0xff, 0xe1, 0x7f, 0x68, 0x95, 0x4d, 0xac, 0x3a, 0x84, 0xfb, 0x14, 0x58, 0xbd, 0x5e, 0xc9,
+          0x92, 0x09, 0x44, 0x97, 0x49, 0xb2, 0xb3, 0x08, 0xb7, 0xcb, 0x55, 0x81, 0x2f, 0x95, 0x63, 0xaf}},
+    };
+    for (const Vector& v : vectors) {
+        uint8_t out[32];
+        fn((const uint8_t*)v.message, strlen(v.message), out);
+        if (memcmp(out, v.digest, 32) != 0) return false;
+    }
+    return true;
+}
+
+// Short calibration windows: long enough to reach steady clocks, short enough for startup
+static const double calibrationSeconds = 0.05;
+
+// Timed on the shape CpuSession scans: the job's own target, whose top limb is zero
+// at any real difficulty, so the kernels run their H7 early exit
+static double calibrateScan(ScanNoncesFn fn) {
+    ScanJob job = genesisScanJob(0);
+    std::vector<uint32_t> hits;
+    uint64_t hashes = 0;
+    uint32_t nonce = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0;
+    do {
+        hashes += fn(job, nonce, 16384, hits);
+        nonce += 16384;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < calibrationSeconds);
+    return hashes / elapsed / 1e6;
+}
+
+// Fill `report` for every entry and return the index of the chosen one, or -1.
+// Without `calibrate`, the first entry that passes is chosen.
+template <class Entry, class Fn>
+static int pickKernel(const Entry* entries, size_t n, const char* overrideVar,
+                      bool (*selfTest)(Fn), double (*calibrate)(std::type_identity_t<Fn>),
+                      std::vector<KernelStatus>& report) {
+    const CpuFeatures& features = cpuFeatures();
+    const char* forced = std::getenv(overrideVar);
+    int best = -1;
+    for (size_t i = 0; i < n; ++i) {
+        KernelStatus status;
+        status.name = entries[i].name;
+        status.supported = entries[i].supported(features);
+        if (status.supported) status.passed = selfTest(entries[i].fn);
+        if (status.passed && !forced && calibrate) status.rate = calibrate(entries[i].fn);
+        report.push_back(status);
+
+        if (!status.passed) continue;
+        if (forced ? status.name == forced : best < 0 || status.rate > report[best].rate)
+            best = (int)i;
+    }
+    if (best < 0 && forced)
+        throw std::runtime_error(std::string(overrideVar) + "=" + forced + " is not a working kernel here");
+    return best;
+}
+
+static CpuDispatch runCpuDispatch() {
+    CpuDispatch dispatch;
+    int scan = pickKernel(scanKernels, sizeof(scanKernels) / sizeof(scanKernels[0]),
+                          "MINER_SCAN_KERNEL", selfTestScan, calibrateScan, dispatch.scanReport);
+    if (scan < 0) throw std::runtime_error("No nonce scan kernel passed its self-test");
+    dispatch.scanKernel = scanKernels[scan].name;
+    dispatch.scanNonces = scanKernels[scan].fn;
+    return dispatch;
+}
+
+static HashDispatch runHashDispatch() {
+    HashDispatch dispatch;
+    int hash = pickKernel(hashKernels, sizeof(hashKernels) / sizeof(hashKernels[0]),
+                          "MINER_HASH_KERNEL", selfTestHash, nullptr, dispatch.hashReport);
+    if (hash < 0) throw std::runtime_error("No SHA-256d kernel passed its self-test");
+    dispatch.hashKernel = hashKernels[hash].name;
+    dispatch.sha256d = hashKernels[hash].fn;
+    return dispatch;
+}
+
+const CpuDispatch& cpuDispatch() {
+    static const CpuDispatch dispatch = runCpuDispatch();
+    return dispatch;
+}
+
+const HashDispatch& hashDispatch() {
+    static const HashDispatch dispatch = runHashDispatch();
+    return dispatch;
+}
+
+void printCpuDispatch(const CpuDispatch& dispatch, const HashDispatch& hashes, std::ostream& os) {
+    const CpuFeatures& f = cpuFeatures();
+    os << "CPU features:" << (f.ssse3 ? " ssse3" : "") << (f.sse41 ? " sse4.1" : "")
+       << (f.sha ? " sha" : "") << (f.avx2 ? " avx2" : "")
+       << (f.avx512f ? " avx512f" : "") << (f.avx512vl ? " avx512vl" : "") << "\n";
+
+    auto printReport = [&](const std::vector<KernelStatus>& report, const char* unit) {
+        for (const KernelStatus& k : report) {
+            os << "  " << std::left << std::setw(12) << k.name << std::right;
+            if (!k.supported) os << "unsupported\n";
+            else if (!k.passed) os << "FAILED self-test\n";
+            else if (k.rate == 0) os << "ok\n";
+            else os << std::fixed << std::setprecision(2) << std::setw(9) << k.rate << " " << unit << "\n";
+        }
+    };
+    os << "Nonce scan kernels (using " << dispatch.scanKernel << "):\n";
+    printReport(dispatch.scanReport, "MH/s");
+    os << "SHA-256d kernels (using " << hashes.hashKernel << "):\n";
+    printReport(hashes.hashReport, "");
+}
@@ -0,0 +1,71 @@
+#ifndef CPU_DISPATCH_HPP
+#define CPU_DISPATCH_HPP
+
+#include "nonce_scan.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// x86 features relevant to the SHA-256 kernels, including OS support for the
+// wider register state (XGETBV). All false on other architectures.
+struct CpuFeatures {
+    bool ssse3 = false;
+    bool sse41 = false;
+    bool sha = false;
+    bool avx2 = false;
+    bool avx512f = false;
+    bool avx512vl = false;
+};
+
+const CpuFeatures& cpuFeatures();
+
+typedef uint64_t (*ScanNoncesFn)(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                                 std::vector<uint32_t>& hits);
+typedef void (*Sha256dFn)(const uint8_t* data, size_t len, uint8_t* out);
+
+struct KernelStatus {
+    std::string name;
+    bool supported = false;   // the CPU has the instructions it needs
+    bool passed = false;      // known-answer self-test
+    double rate = 0;          // calibration, MH/s; hash kernels aren't timed
+};
+
+// Nonce scan kernel picked for this machine. Every compiled kernel the CPU supports
+// is run against known-answer vectors and timed for a short window; the fastest
+// correct one wins. MINER_SCAN_KERNEL forces a kernel by name.
+struct CpuDispatch {
+    std::string scanKernel;
+    ScanNoncesFn scanNonces = nullptr;
+    std::vector<KernelStatus> scanReport;
+};
+
+// Runs detection, self-test and calibration on first use (thread-safe);
+// later calls return the cached result. Throws if no scan kernel passes.
+const CpuDispatch& cpuDispatch();
+
+// SHA-256d kernel for message hashing (merkle trees, utils.hpp), picked apart from
+// the scan kernels so hashing never waits on their self-tests, calibration or JIT:
+// the first supported kernel, in preference order, that passes its known-answer
+// test. MINER_HASH_KERNEL forces a kernel by name.
+struct HashDispatch {
+    std::string hashKernel;
+    Sha256dFn sha256d = nullptr;
+    std::vector<KernelStatus> hashReport;
+};
+
+// Selected on first use (thread-safe). Throws if no kernel passes.
+const HashDispatch& hashDispatch();
+
+// Bitcoin genesis header bytes 0..75 (everything but the nonce)
+std::array<uint8_t, 76> genesisHeaderPrefix();
+
+// Bitcoin genesis header (without its nonce) as a scan job with a difficulty-1
+// target whose top limb is replaced by `topTargetLimb`. Used by the self-test and bench.
+ScanJob genesisScanJob(uint32_t topTargetLimb);
+
+void printCpuDispatch(const CpuDispatch& dispatch, const HashDispatch& hashes, std::ostream& os);
+
+#endif // CPU_DISPATCH_HPP
@@ -0,0 +1,134 @@
+#include "cpu_miner.hpp"
+#include "cpu_dispatch.hpp"
+#include "gpu_job.hpp"
+#include "worker_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+// Slices meet on absolute multiples of this, the widest (bitsliced, 512-lane)
+// kernel's batch, so kernels only fall back to scalar code at the range's own edges
+static const uint32_t sliceAlign = 512;
+
+// Nonces a thread scans between job epoch checks: well under a millisecond
+static const uint32_t epochCheckStride = sliceAlign * 32;
+
+// Nonces hashed on the host at the start of each slice for the range's sample hash
+static const uint32_t bestSeedNonces = 64;
+
+namespace {
+
+unsigned workerCount() {
+    if (const char* forced = std::getenv("MINER_CPU_THREADS")) {
+        unsigned n = (unsigned)std::strtoul(forced, nullptr, 10);
+        if (n > 0) return n;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+class CpuSession : public MiningSession {
+public:
+    explicit CpuSession(unsigned threads)
+        : dispatch(cpuDispatch()), pool(threads ? threads : workerCount()), workers(pool.size()) {}
+
+    std::string describe() const override {
+        return "cpu (" + std::to_string(pool.size()) + " threads, " + dispatch.scanKernel + " kernel)";
+    }
+
+    void loadJob(const GpuJob& prepared) override { job = prepared; }
+
+    void watchEpoch(const std::atomic<uint64_t>* current, uint64_t jobEpoch) override {
+        epoch = current;
+        epochValue = jobEpoch;
+    }
+
+    MiningResult mine(uint32_t nonceBase, uint32_t count) override {
+        // Worker i scans [bound(i), bound(i + 1)): ceil(count / threads) each, the
+        // inner bounds rounded down to sliceAlign. In 64 bits so a range may run
+        // past 2^32 (the nonces wrap) and counts near 2^32 can't overflow.
+        uint64_t rangeStart = nonceBase, rangeEnd = rangeStart + count;
+        uint64_t perThread = (uint64_t(count) + pool.size() - 1) / pool.size();
+        auto bound = [&](uint64_t i) {
+            if (i == 0) return rangeStart;
+            if (i >= pool.size()) return rangeEnd;
+            uint64_t at = (rangeStart + i * perThread) & ~uint64_t(sliceAlign - 1);
+            return std::clamp(at, rangeStart, rangeEnd);
+        };
+        pool.run([&](unsigned worker) {
+            WorkerState& state = workers[worker];
+            state.hits.clear();
+            state.scanned = 0;
+            state.bestLimb = UINT32_MAX;
+            uint64_t begin = bound(worker), end = bound(worker + 1);
+            if (begin >= end) return;
+            uint32_t length = (uint32_t)(end - begin);
+            uint32_t first = (uint32_t)begin;
+            state.bestNonce = first;
+
+            // The kernels report hits only, so the range's sample is the best of a few
+            // nonces hashed here up front; the scan itself runs on the job's own target
+            std::array<uint32_t, 8> hash;
+            for (uint32_t i = 0; i < std::min(bestSeedNonces, length); ++i) {
+                hashHeaderNonce(job.scan, first + i, hash);
+                state.offer(__builtin_bswap32(hash[7]), first + i);
+            }
+
+            // In strides that also end on sliceAlign multiples, so a new job epoch
+            // stops the slice part-way
+            for (uint64_t at = begin; at < end;) {
+                if (epoch && epoch->load(std::memory_order_relaxed) != epochValue) break;
+                uint64_t next = std::min(end, (at + epochCheckStride) & ~uint64_t(sliceAlign - 1));
+                dispatch.scanNonces(job.scan, (uint32_t)at, (uint32_t)(next - at), state.hits);
+                state.scanned += next - at;
+                at = next;
+            }
+        });
+
+        candidates.clear();
+        uint64_t tried = 0;
+        uint32_t bestLimb = UINT32_MAX, bestNonce = nonceBase;
+        for (const WorkerState& state : workers) {
+            candidates.insert(candidates.end(), state.hits.begin(), state.hits.end());
+            tried += state.scanned;
+            if (state.bestLimb < bestLimb) {
+                bestLimb = state.bestLimb;
+                bestNonce = state.bestNonce;
+            }
+        }
+        // Candidates are target hits; with none, the best prefix hash is the sample
+        MiningResult result = finishCandidates(job, candidates, bestNonce);
+        result.hashesTried = tried;
+        return result;
+    }
+
+private:
+    // Per pool thread, kept across ranges so steady-state mining doesn't allocate
+    struct WorkerState {
+        std::vector<uint32_t> hits;
+        uint64_t scanned = 0;
+        uint32_t bestLimb = UINT32_MAX, bestNonce = 0;   // top limb of the best sampled hash
+
+        void offer(uint32_t limb, uint32_t nonce) {
+            if (limb < bestLimb) {
+                bestLimb = limb;
+                bestNonce = nonce;
+            }
+        }
+    };
+
+    const CpuDispatch& dispatch;
+    WorkerPool pool;
+    GpuJob job{};
+    const std::atomic<uint64_t>* epoch = nullptr;
+    uint64_t epochValue = 0;
+    std::vector<WorkerState> workers;
+    std::vector<uint32_t> candidates;
+};
+
+} // namespace
+
+std::unique_ptr<MiningSession> makeCpuSession(unsigned threads) {
+    return std::make_unique<CpuSession>(threads);
+}
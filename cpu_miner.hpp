@@ -0,0 +1,12 @@
+#ifndef CPU_MINER_HPP
+#define CPU_MINER_HPP
+
+#include "mining_session.hpp"
+#include <memory>
+
+// MiningSession on the CPU: each range is split across a pool of worker threads
+// that lives as long as the session, each running the scan kernel cpuDispatch
+// picked. threads == 0 means MINER_CPU_THREADS, default one per hardware thread.
+std::unique_ptr<MiningSession> makeCpuSession(unsigned threads = 0);
+
+#endif // CPU_MINER_HPP
@@ -0,0 +1,63 @@
+#include "gpu_job.hpp"
+#include "midstate_utils.hpp"
+#include <algorithm>
+#include <utility>
+
+GpuJob makeGpuJob(const BlockHeader& header, const std::vector<uint8_t>& target) {
+    GpuJob job;
+    job.scan = makeScanJob(midstateFromHeader(header), tailFromHeader(header), target);
+    std::copy(job.scan.midstate.begin(), job.scan.midstate.end(), job.midstate);
+    std::copy(job.scan.tail.begin(), job.scan.tail.end(), job.tail32);
+    job.tail32[3] = 0;
+    std::copy(job.scan.target.begin(), job.scan.target.end(), job.target32);
+    return job;
+}
+
+void MiningSession::setJob(const BlockHeader& header, const std::vector<uint8_t>& target) {
+    loadJob(makeGpuJob(header, target));
+}
+
+std::vector<uint8_t> displayHash(const uint32_t hash[8]) {
+    std::vector<uint8_t> out(32);
+    for (int i = 0; i < 8; ++i) {
+        uint32_t word = __builtin_bswap32(hash[7 - i]);
+        out[i * 4 + 0] = (word >> 24) & 0xFF;
+        out[i * 4 + 1] = (word >> 16) & 0xFF;
+        out[i * 4 + 2] = (word >> 8) & 0xFF;
+        out[i * 4 + 3] = word & 0xFF;
+    }
+    return out;
+}
+
+void resetGpuResult(GpuResult& result, uint32_t nonceBase) {
+    result.hashCount = 0;
+    result.bestLimb = 0xffffffff;
+    result.bestNonce = nonceBase;
+    result.candidateCount = 0;
+}
+
+MiningResult finishCandidates(const GpuJob& job, std::vector<uint32_t> candidates, uint32_t sampleNonce) {
+    std::sort(candidates.begin(), candidates.end());
+    MiningResult result;
+    std::array<uint32_t, 8> hash;
+    for (uint32_t nonce : candidates) {
+        if (!confirmNonce(job.scan, nonce)) continue;
+        hashHeaderNonce(job.scan, nonce, hash);
+        result.found = true;
+        result.nonce = nonce;
+        result.hash = displayHash(hash.data());
+        return result;
+    }
+
+    hashHeaderNonce(job.scan, sampleNonce, hash);
+    result.hash = displayHash(hash.data());
+    return result;
+}
+
+MiningResult finishGpuResult(const GpuJob& job, const GpuResult& result) {
+    const uint32_t* first = result.candidates;
+    std::vector<uint32_t> candidates(first, first + std::min(result.candidateCount, gpuCandidateCapacity));
+    MiningResult mined = finishCandidates(job, std::move(candidates), result.bestNonce);
+    mined.hashesTried = result.hashCount;
+    return mined;
+}
@@ -0,0 +1,62 @@
+#ifndef GPU_JOB_HPP
+#define GPU_JOB_HPP
+
+#include "block.hpp"
+#include "mining_session.hpp"
+#include "nonce_scan.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Job and result plumbing shared by the MiningSession backends (Metal, OpenCL,
+// Vulkan, and the CPU pool). Every GPU kernel takes the same buffers: midstate, tail32,
+// target limbs, a GpuResult, the candidate capacity and the nonce base.
+
+struct GpuJob {
+    ScanJob scan;              // host reference, for confirming candidates
+    uint32_t midstate[8];
+    uint32_t tail32[4];        // W0..W2 as big-endian message words, zero padded to 16 bytes
+    uint32_t target32[8];      // most significant limb first
+};
+
+GpuJob makeGpuJob(const BlockHeader& header, const std::vector<uint8_t>& target);
+
+// Ranges a GPU session keeps in flight: enough to hide the host's per-range work
+// and the launch latency behind the running range
+constexpr size_t gpuPipelineDepth = 3;
+
+// Nonces per range a kernel can report; at network difficulty a range has none,
+// so this only bounds absurdly easy targets
+constexpr uint32_t gpuCandidateCapacity = 1024;
+
+// The one result buffer every kernel writes, reduced on the device with atomics so
+// no per-nonce output exists. The host resets the four header words before a range
+// and reads the struct back after it.
+struct GpuResult {
+    uint32_t hashCount;        // nonces hashed; each work group adds its size once
+    uint32_t bestLimb;         // lowest top hash limb (bits 255..224) in the range
+    uint32_t bestNonce;        // the nonce that last lowered bestLimb; under a race it
+                               // can be a close runner-up, so the host rehashes it
+    uint32_t candidateCount;   // nonces whose top limb met the target's; may exceed the capacity
+    uint32_t candidates[gpuCandidateCapacity];
+};
+static_assert(offsetof(GpuResult, candidates) == 16, "the kernels index GpuResult by word");
+
+// Header words for a new range: no hashes, no candidates, the worst possible best
+void resetGpuResult(GpuResult& result, uint32_t nonceBase);
+
+// Final hash words as the 32 display bytes (most significant first) a
+// MiningResult carries
+std::vector<uint8_t> displayHash(const uint32_t hash[8]);
+
+// Finishes a range from the nonces whose top limb met the target: found with the
+// lowest fully confirmed nonce and its hash, otherwise sampleNonce's hash as the
+// sample. hashesTried is left for the caller.
+MiningResult finishCandidates(const GpuJob& job, std::vector<uint32_t> candidates, uint32_t sampleNonce);
+
+// finishCandidates on a kernel's GpuResult, with its best nonce as the sample and
+// its hash count as hashesTried
+MiningResult finishGpuResult(const GpuJob& job, const GpuResult& result);
+
+#endif // GPU_JOB_HPP
@@ -0,0 +1,112 @@
+#include "job_factory.hpp"
+#include "cpu_dispatch.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// sha256d(left || right), the merkle tree's node hash
+static std::array<uint8_t, 32> merkleNode(const std::array<uint8_t, 32>& left, const std::array<uint8_t, 32>& right) {
+    uint8_t pair[64];
+    std::memcpy(pair, left.data(), 32);
+    std::memcpy(pair + 32, right.data(), 32);
+    std::array<uint8_t, 32> node;
+    hashDispatch().sha256d(pair, sizeof(pair), node.data());
+    return node;
+}
+
+std::vector<std::array<uint8_t, 32>> merkleBranch(std::span<const std::array<uint8_t, 32>> txids) {
+    // Slot 0 of each level stands for the coinbase's path and is never hashed here
+    std::vector<std::array<uint8_t, 32>> level(1);
+    level.insert(level.end(), txids.begin(), txids.end());
+    std::vector<std::array<uint8_t, 32>> branch;
+    while (level.size() > 1) {
+        branch.push_back(level[1]);
+        if (level.size() % 2) level.push_back(level.back());
+        std::vector<std::array<uint8_t, 32>> up(1);
+        for (size_t i = 2; i < level.size(); i += 2) up.push_back(merkleNode(level[i], level[i + 1]));
+        level = std::move(up);
+    }
+    return branch;
+}
+
+PreparedJob prepareJob(const JobTemplate& tmpl, uint64_t sequence) {
+    PreparedJob job;
+    job.sequence = sequence;
+    job.header = tmpl.header;
+    job.header.nonce = 0;
+
+    if (tmpl.hasCoinbase()) {
+        job.coinbase = tmpl.coinbasePrefix;
+        for (unsigned i = 0; i < tmpl.extranonceSize; ++i) job.coinbase.push_back((uint8_t)(sequence >> (8 * i)));
+        job.coinbase.insert(job.coinbase.end(), tmpl.coinbaseSuffix.begin(), tmpl.coinbaseSuffix.end());
+
+        std::array<uint8_t, 32> root;
+        hashDispatch().sha256d(job.coinbase.data(), job.coinbase.size(), root.data());
+        for (const std::array<uint8_t, 32>& sibling : tmpl.merkleBranch) root = merkleNode(root, sibling);
+        // Hash byte order, as serializeBlockHeader lays it out (copyHashLE in main.cpp)
+        job.header.merkleRoot = root;
+    } else {
+        if (sequence > maxTimestampRoll || sequence > UINT32_MAX - tmpl.header.timestamp)
+            throw std::runtime_error("prepareJob: timestamp rolled too far ahead");
+        job.header.timestamp += (uint32_t)sequence;
+    }
+
+    job.work = makeGpuJob(job.header, tmpl.target);
+    return job;
+}
+
+JobFactory::JobFactory(JobTemplate tmpl, size_t capacity) : tmpl(std::move(tmpl)), ring(std::max<size_t>(1, capacity)) {
+    if (this->tmpl.hasCoinbase() && (this->tmpl.extranonceSize == 0 || this->tmpl.extranonceSize > 8))
+        throw std::runtime_error("JobFactory: extranonce size must be 1 to 8 bytes");
+    if (this->tmpl.target.size() != 32) throw std::runtime_error("JobFactory: target must be 32 bytes");
+    producer = std::thread([this] { produce(); });
+}
+
+JobFactory::~JobFactory() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    notFull.notify_one();
+    producer.join();
+}
+
+void JobFactory::produce() {
+    // Every extranonce once; timestamp rolling stops at maxTimestampRoll (or the end
+    // of the uint32 range)
+    uint64_t limit = tmpl.hasCoinbase() && tmpl.extranonceSize < 8 ? uint64_t(1) << (8 * tmpl.extranonceSize)
+                   : tmpl.hasCoinbase() ? UINT64_MAX
+                   : uint64_t(std::min(maxTimestampRoll, UINT32_MAX - tmpl.header.timestamp)) + 1;
+    try {
+        for (uint64_t sequence = 0; sequence < limit; ++sequence) {
+            // Built outside the lock, so next() never waits on the hashing
+            PreparedJob job = prepareJob(tmpl, sequence);
+            std::unique_lock<std::mutex> lock(mutex);
+            notFull.wait(lock, [this] { return stopping || count < ring.size(); });
+            if (stopping) return;
+            ring[(head + count) % ring.size()] = std::move(job);
+            ++count;
+            notEmpty.notify_one();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        error = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    exhausted = true;
+    notEmpty.notify_all();
+}
+
+PreparedJob JobFactory::next() {
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait(lock, [this] { return count > 0 || exhausted; });
+    if (count == 0) {
+        if (error) std::rethrow_exception(error);
+        throw std::runtime_error("JobFactory: no extranonces or timestamp rolls left for this template");
+    }
+    PreparedJob job = std::move(ring[head]);
+    head = (head + 1) % ring.size();
+    --count;
+    notFull.notify_one();
+    return job;
+}
@@ -0,0 +1,81 @@
+#ifndef JOB_FACTORY_HPP
+#define JOB_FACTORY_HPP
+
+#include "block.hpp"
+#include "gpu_job.hpp"
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Everything a JobFactory needs to build work for one block template
+struct JobTemplate {
+    BlockHeader header;            // merkleRoot is replaced per job when there is a coinbase
+    std::vector<uint8_t> target;   // 32 bytes, little-endian
+
+    // The coinbase, serialized without witness, split around the extranonce (Stratum's
+    // coinb1/coinb2). With no coinbase, jobs roll the header timestamp instead.
+    std::vector<uint8_t> coinbasePrefix, coinbaseSuffix;
+    unsigned extranonceSize = 4;   // bytes, little-endian, 1 to 8
+    // The coinbase's merkle siblings, leaf level first, hash byte order
+    std::vector<std::array<uint8_t, 32>> merkleBranch;
+
+    bool hasCoinbase() const { return !coinbasePrefix.empty() || !coinbaseSuffix.empty(); }
+};
+
+// How far a template without a coinbase may roll its timestamp: well inside the two
+// hours into the future that nodes accept, with room for clock skew
+const uint32_t maxTimestampRoll = 60 * 60;
+
+// One ready-to-hash job: a fresh 2^32 nonce space
+struct PreparedJob {
+    uint64_t sequence = 0;           // the extranonce, or the seconds added to the timestamp
+    std::vector<uint8_t> coinbase;   // empty when the template has none
+    BlockHeader header;              // merkle root and timestamp filled in, nonce 0
+    GpuJob work;                     // midstate, tail and target for the sessions
+};
+
+// The coinbase's merkle siblings for a block whose other transactions have these
+// txids (hash byte order), leaf level first
+std::vector<std::array<uint8_t, 32>> merkleBranch(std::span<const std::array<uint8_t, 32>> txids);
+
+// Builds job `sequence` of a template; what the factory's producer runs. Throws
+// std::runtime_error past maxTimestampRoll for a template without a coinbase.
+PreparedJob prepareJob(const JobTemplate& tmpl, uint64_t sequence);
+
+// A producer thread that keeps a bounded ring of prepared jobs for one template,
+// so a miner that exhausts a nonce space takes the next one without hashing a
+// coinbase, a merkle path or a midstate itself.
+class JobFactory {
+public:
+    explicit JobFactory(JobTemplate tmpl, size_t capacity = 8);
+    ~JobFactory();
+
+    JobFactory(const JobFactory&) = delete;
+    JobFactory& operator=(const JobFactory&) = delete;
+
+    // The next job in sequence order; waits only if the ring has run dry. Throws
+    // std::runtime_error once the extranonces (or timestamp rolls) are used up, or
+    // rethrows what the producer hit.
+    PreparedJob next();
+
+private:
+    void produce();
+
+    const JobTemplate tmpl;
+    std::vector<PreparedJob> ring;
+    std::mutex mutex;
+    std::condition_variable notEmpty, notFull;
+    size_t head = 0, count = 0;   // guarded by mutex
+    bool stopping = false;        // guarded by mutex
+    bool exhausted = false;       // guarded by mutex; the producer has made its last job
+    std::exception_ptr error;     // guarded by mutex
+    std::thread producer;
+};
+
+#endif // JOB_FACTORY_HPP
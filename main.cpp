@@ -1,14 +1,32 @@
 #include "utils.hpp"
 #include "block.hpp"
+#include "blocktemplate.hpp"
 #include "midstate_utils.hpp"
+#include "cpu_dispatch.hpp"
 #include "metal_ui.hpp"
+#include "cpu_miner.hpp"
+#include "nonce_scheduler.hpp"
+#include "job_factory.hpp"
+#ifdef __APPLE__
 #include "metal_miner.hpp"  // Include the Metal miner header
+#endif
+#ifdef MINER_OPENCL
+#include "opencl_miner.hpp"
+#endif
+#ifdef MINER_VULKAN
+#include "vulkan_miner.hpp"
+#endif
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
 #include <iostream>
 #include <chrono>
 #include <thread>
 #include <climits>
 #include <fstream>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
 #include "nlohmann/json.hpp"
 
 using json = nlohmann::json;
@@ -38,16 +56,6 @@ std::string toHex(const std::array<uint8_t, 32>& data) {
     return output;
 }
 
-std::vector<uint8_t> hexToBytes(const std::string& hex) {
-    std::vector<uint8_t> bytes;
-    bytes.reserve(hex.length() / 2);
-    for (size_t i = 0; i < hex.length(); i += 2) {
-        uint8_t byte = static_cast<uint8_t>(std::stoi(hex.substr(i, 2), nullptr, 16));
-        bytes.push_back(byte);
-    }
-    return bytes;
-}
-
 std::string loadFile(const std::string& filename) {
     std::ifstream file(filename);
     if (!file) throw std::runtime_error("Failed to open " + filename);
@@ -63,42 +71,207 @@ void copyHashLE(const std::string& hexStr, std::array<uint8_t, 32>& outArray) {
     std::copy(bytes.begin(), bytes.end(), outArray.begin());
 }
 
-// Updated dispatchMining calls your Metal miner and updates stats
-void dispatchMining(const BlockHeader& header,
-                    const std::array<uint32_t, 8>& midstate,
-                    const std::vector<uint8_t>& tail,
-                    const std::vector<uint8_t>& target,
-                    MiningStats& stats) {
-    (void)midstate; // unused param warning suppression
-    (void)tail;
+// Nonces per scheduler chunk, the smallest batch a backend is given. Batches grow
+// from there to about batchTarget of work for each backend.
+static const uint32_t noncesPerChunk = 65536;
 
-    uint32_t nonceBase = 0;
-    uint32_t validNonce = 0;
-    std::vector<uint8_t> validHash(32, 0);
-    uint64_t totalHashesTried = 0;
+// MINER_BATCH_MS, or 20 ms: short enough that a new job starts promptly, long
+// enough that per-batch launch and bookkeeping costs stay small
+static std::chrono::microseconds batchTarget() {
+    if (const char* forced = std::getenv("MINER_BATCH_MS")) {
+        double ms = std::strtod(forced, nullptr);
+        if (ms > 0) return std::chrono::microseconds((long long)(ms * 1000));
+    }
+    return std::chrono::milliseconds(20);
+}
 
-    const int maxBatches = 1000;
+// Between status lines; batches finish dozens of times a second, too fast to print each
+static const std::chrono::seconds statusInterval(2);
 
-    for (int batch = 0; batch < maxBatches && !stats.quit.load(std::memory_order_acquire); batch++) {
-        bool found = metalMineBlock(header, target, nonceBase, validNonce, validHash, totalHashesTried);
+static std::unique_ptr<MiningSession> makeSession(const std::string& name) {
+    if (name == "cpu") return makeCpuSession();
+#ifdef __APPLE__
+    if (name == "metal") return makeMetalSession();
+#endif
+#ifdef MINER_OPENCL
+    if (name == "opencl") return makeOpenCLSession();
+#endif
+#ifdef MINER_VULKAN
+    if (name == "vulkan") return makeVulkanSession();
+#endif
+    throw std::runtime_error("Mining backend " + name + " is not available in this build");
+}
 
-        stats.hashes += totalHashesTried;
+// MINER_BACKEND lists the backends to mine on together, e.g. "metal,cpu" or
+// "cpu,opencl,vulkan"; by default Metal on macOS and the CPU elsewhere
+static std::vector<std::unique_ptr<MiningSession>> pickSessions() {
+    const char* forced = std::getenv("MINER_BACKEND");
+#ifdef __APPLE__
+    std::string names = forced ? forced : "metal";
+#else
+    std::string names = forced ? forced : "cpu";
+#endif
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    std::stringstream list(names);
+    std::string name;
+    while (std::getline(list, name, ','))
+        if (!name.empty()) sessions.push_back(makeSession(name));
+    if (sessions.empty()) throw std::runtime_error("MINER_BACKEND names no backend");
+    return sessions;
+}
 
-        std::copy(validHash.begin(), validHash.end(), stats.sampleHash.begin());
-        stats.sampleHashStr = toHex(stats.sampleHash);
+// The optional Stratum-style coinbase fields: coinb1 and coinb2 (hex) around an
+// extranonce2_size-byte extranonce, and merkle_branch (hex, hash byte order)
+static void readCoinbase(const json& tmpl, JobTemplate& job) {
+    if (!tmpl.contains("coinb1") || !tmpl.contains("coinb2")) return;
+    job.coinbasePrefix = hexToBytes(tmpl["coinb1"].get<std::string>());
+    job.coinbaseSuffix = hexToBytes(tmpl["coinb2"].get<std::string>());
+    if (tmpl.contains("extranonce2_size")) job.extranonceSize = tmpl["extranonce2_size"].get<unsigned>();
+    if (tmpl.contains("merkle_branch")) {
+        for (const json& node : tmpl["merkle_branch"]) {
+            std::vector<uint8_t> bytes = hexToBytes(node.get<std::string>());
+            if (bytes.size() != 32) throw std::runtime_error("Invalid merkle_branch hash length");
+            job.merkleBranch.emplace_back();
+            std::copy(bytes.begin(), bytes.end(), job.merkleBranch.back().begin());
+        }
+    } else if (tmpl.contains("transactions")) {
+        // A getblocktemplate-style file: build the branch from the other transactions,
+        // hashed here from their "data" rather than taken from the node's txid fields
+        std::vector<uint8_t> txData;
+        std::vector<TxView> txs = decodeTransactions(tmpl["transactions"], txData);
+        std::vector<std::array<uint8_t, 32>> txids;
+        txids.reserve(txs.size());
+        for (const TxView& tx : txs) txids.push_back(tx.txid);
+        job.merkleBranch = merkleBranch(txids);
+    }
+}
+
+static JobTemplate loadJobTemplate(const std::string& path) {
+    json tmpl = json::parse(loadFile(path));
 
-        std::cout << "Batch " << batch << " tried " << totalHashesTried << " hashes, total " << stats.hashes.load() << "\n";
-        std::cout << "Sample Hash: " << stats.sampleHashStr << "\n";
+    std::string hashPrevBlockBE = tmpl["previousblockhash"];
+    std::string hashMerkleRootBE = tmpl["merkleroot"];
+    std::string hashTargetBE = tmpl["target"];
+    uint32_t nTime = tmpl["curtime"];
+    uint32_t nVersion = tmpl["version"];
+    std::string bitsHex = tmpl["bits"];
+
+    std::array<uint8_t, 32> prevBlock;
+    std::array<uint8_t, 32> merkleRoot;
+    std::array<uint8_t, 32> target;
+
+    copyHashLE(hashPrevBlockBE, prevBlock);
+    copyHashLE(hashMerkleRootBE, merkleRoot);
+    copyHashLE(hashTargetBE, target);
+
+    uint32_t nBits = 0;
+    for (int i = 0; i < 4; ++i) {
+        std::string byteStr = bitsHex.substr(i * 2, 2);
+        nBits |= static_cast<uint32_t>(std::stoi(byteStr, nullptr, 16)) << (8 * (3 - i));
+    }
 
-        if (found) {
-            stats.validNonce = validNonce;
-            stats.validHashStr = toHex(validHash);
-            std::cout << ">>> Valid nonce found: " << validNonce << "\n";
-            std::cout << ">>> Valid hash: " << stats.validHashStr << "\n";
-            break;
+    JobTemplate job;
+    job.header.version = nVersion;
+    std::copy(prevBlock.begin(), prevBlock.end(), job.header.prevBlockHash.begin());
+    std::copy(merkleRoot.begin(), merkleRoot.end(), job.header.merkleRoot.begin());
+    job.header.timestamp = nTime;
+    job.header.bits = nBits;
+    job.header.nonce = 0;
+    job.target.assign(target.begin(), target.end());
+    readCoinbase(tmpl, job);
+    return job;
+}
+
+// Bumps the job epoch whenever the template file is rewritten, e.g. by a
+// getblocktemplate poller after a new block. Writers should replace the file
+// with a rename, so a reload never reads half of one.
+class TemplateWatcher {
+public:
+    TemplateWatcher(const std::string& path, std::atomic<uint64_t>& epoch) : thread([this, path, &epoch] {
+        std::error_code error;
+        std::filesystem::file_time_type seen = std::filesystem::last_write_time(path, error);
+        while (!stopping.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            std::filesystem::file_time_type now = std::filesystem::last_write_time(path, error);
+            if (!error && now != seen) {
+                seen = now;
+                epoch.fetch_add(1);
+            }
         }
+    }) {}
 
-        nonceBase += (uint32_t)totalHashesTried;
+    ~TemplateWatcher() {
+        stopping.store(true);
+        thread.join();
+    }
+
+private:
+    std::atomic<bool> stopping{false};
+    std::thread thread;
+};
+
+// dispatchMining sets the backends up once and mines the template's jobs on all
+// of them through the work-stealing scheduler. A JobFactory keeps the next jobs
+// prepared, so an exhausted nonce space moves straight on to the next extranonce
+// (or timestamp). A rewritten template starts a new job epoch: the scheduler drops
+// the old work at once and the template is reloaded. The backends keep batches in
+// flight while this thread, the consumer stage, updates stats after every batch
+// and prints a status line every statusInterval.
+void dispatchMining(const std::string& templatePath, MiningStats& stats) {
+    NonceScheduler scheduler(pickSessions(), noncesPerChunk, batchTarget());
+    for (size_t i = 0; i < scheduler.workerCount(); ++i)
+        std::cout << "Mining backend " << i << ": " << scheduler.session(i).describe() << "\n";
+    std::cout << "Batch target: " << batchTarget().count() / 1000.0 << " ms\n";
+
+    auto lastStatus = std::chrono::steady_clock::now();
+    uint64_t hashesAtStatus = 0;
+    auto onChunk = [&](size_t, uint32_t, const MiningResult& chunk) {
+        stats.hashes += chunk.hashesTried;
+        if (chunk.epoch != stats.jobEpoch.load())
+            stats.staleHashes += chunk.hashesTried;
+        else
+            std::copy(chunk.hash.begin(), chunk.hash.end(), stats.sampleHash.begin());
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastStatus < statusInterval) return;
+        uint64_t total = stats.hashes.load();
+        stats.hashrate = float((total - hashesAtStatus) / std::chrono::duration<double>(now - lastStatus).count());
+        stats.sampleHashStr = toHex(stats.sampleHash);
+        std::cout << std::round(stats.hashrate / 1e5) / 10 << " MH/s, total " << total << " hashes, "
+                  << stats.staleHashes.load() << " stale, sample hash " << stats.sampleHashStr << "\n";
+        lastStatus = now;
+        hashesAtStatus = total;
+    };
+
+    TemplateWatcher watcher(templatePath, stats.jobEpoch);
+    while (!stats.quit.load()) {
+        uint64_t epoch = stats.jobEpoch.load();
+        JobTemplate tmpl = loadJobTemplate(templatePath);
+        JobFactory factory(tmpl);
+        std::cout << "Template loaded, job epoch " << epoch << "\n";
+
+        while (!stats.quit.load() && stats.jobEpoch.load() == epoch) {
+            PreparedJob job = factory.next();
+            std::cout << "Job " << job.sequence << ": " << (tmpl.hasCoinbase() ? "extranonce " : "timestamp ")
+                      << (tmpl.hasCoinbase() ? job.sequence : job.header.timestamp) << "\n";
+
+            MiningResult result = scheduler.mineJob(job.work, epoch, stats.jobEpoch, stats.quit, onChunk);
+            if (result.found) {
+                stats.validNonce = result.nonce;
+                stats.validHashStr = toHex(result.hash);
+                std::cout << ">>> Valid nonce found: " << result.nonce << "\n";
+                std::cout << ">>> Valid hash: " << stats.validHashStr << "\n";
+                std::cout << ">>> Timestamp: " << job.header.timestamp << ", merkle root: "
+                          << toHex(job.header.merkleRoot) << "\n";
+                if (!job.coinbase.empty()) std::cout << ">>> Coinbase: " << toHex(job.coinbase) << "\n";
+                return;
+            }
+            if (stats.jobEpoch.load() != epoch)
+                std::cout << "Template changed; dropped job " << job.sequence << ", "
+                          << stats.staleHashes.load() << " stale hashes so far\n";
+            else if (!stats.quit.load())
+                std::cout << "Nonce space exhausted for job " << job.sequence << "\n";
+        }
     }
 }
 
@@ -109,45 +282,11 @@ int main(int argc, char** argv) {
     }
 
     try {
-        std::string jsonStr = loadFile(argv[1]);
-        json tmpl = json::parse(jsonStr);
-
-        std::string hashPrevBlockBE = tmpl["previousblockhash"];
-        std::string hashMerkleRootBE = tmpl["merkleroot"];
-        std::string hashTargetBE = tmpl["target"];
-        uint32_t nTime = tmpl["curtime"];
-        uint32_t nVersion = tmpl["version"];
-        std::string bitsHex = tmpl["bits"];
-        uint32_t nNonce = 0;
-
-        std::array<uint8_t, 32> prevBlock;
-        std::array<uint8_t, 32> merkleRoot;
-        std::array<uint8_t, 32> target;
-
-        copyHashLE(hashPrevBlockBE, prevBlock);
-        copyHashLE(hashMerkleRootBE, merkleRoot);
-        copyHashLE(hashTargetBE, target);
-
-        uint32_t nBits = 0;
-        for (int i = 0; i < 4; ++i) {
-            std::string byteStr = bitsHex.substr(i * 2, 2);
-            nBits |= static_cast<uint32_t>(std::stoi(byteStr, nullptr, 16)) << (8 * (3 - i));
-        }
-
-        BlockHeader header;
-        header.version = nVersion;
-        std::copy(prevBlock.begin(), prevBlock.end(), header.prevBlockHash.begin());
-        std::copy(merkleRoot.begin(), merkleRoot.end(), header.merkleRoot.begin());
-        header.timestamp = nTime;
-        header.bits = nBits;
-        header.nonce = nNonce;
-
-        std::array<uint32_t, 8> midstate = midstateFromHeader(header);
-        std::vector<uint8_t> tail = tailFromHeader(header);
-        std::vector<uint8_t> targetVec(target.begin(), target.end());
+        // Pick the fastest CPU kernels that pass their self-test on this machine
+        printCpuDispatch(cpuDispatch(), hashDispatch(), std::cout);
 
         stats.quit.store(false);
-        dispatchMining(header, midstate, tail, targetVec, stats);
+        dispatchMining(argv[1], stats);
 
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << "\n";
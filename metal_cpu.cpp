@@ -0,0 +1,233 @@
+// macOS only exposes the (deprecated) ucontext routines under _XOPEN_SOURCE
+#if defined(__APPLE__) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#define _DARWIN_C_SOURCE
+#endif
+
+#include "metal_cpu.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <ucontext.h>
+
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+#elif defined(__GNUC__)
+// A context switch returns twice, but always into the context saved last, so no local is stale
+#pragma GCC diagnostic ignored "-Wclobbered"
+#endif
+
+namespace {
+
+// Kernels keep their working set in registers and small arrays; 64 KiB leaves room
+// for the standard library frames an exception or assert may add
+constexpr size_t fiberStackSize = 64 * 1024;
+
+#if defined(__x86_64__)
+// Saves the callee-saved registers on the current stack, stores its pointer in
+// *save and resumes the stack in `load`. glibc's swapcontext also saves the
+// signal mask with a syscall on every switch, which costs more than a hash.
+extern "C" void metalFiberSwitch(void** save, void* load);
+
+#if defined(__APPLE__)
+#define METAL_FIBER_SWITCH "_metalFiberSwitch"
+#else
+#define METAL_FIBER_SWITCH "metalFiberSwitch"
+#endif
+
+asm(".text\n"
+    ".p2align 4\n"
+    ".globl " METAL_FIBER_SWITCH "\n"
+    METAL_FIBER_SWITCH ":\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n");
+
+struct FiberContext {
+    void* sp = nullptr;
+};
+
+static void switchContext(FiberContext& save, FiberContext& load) {
+    metalFiberSwitch(&save.sp, load.sp);
+}
+
+// A fresh stack that "returns" into entry with the alignment of a normal call
+static void makeContext(FiberContext& context, char* stack, size_t size, void (*entry)()) {
+    uintptr_t top = (reinterpret_cast<uintptr_t>(stack) + size) & ~uintptr_t(15);
+    void** sp = reinterpret_cast<void**>(top);
+    *--sp = nullptr;                              // entry's return address; it never returns
+    *--sp = reinterpret_cast<void*>(entry);
+    for (int i = 0; i < 6; i++) *--sp = nullptr;  // rbp, rbx, r12..r15
+    context.sp = sp;
+}
+#else
+struct FiberContext {
+    ucontext_t context;
+};
+
+static void switchContext(FiberContext& save, FiberContext& load) {
+    swapcontext(&save.context, &load.context);
+}
+
+static void makeContext(FiberContext& context, char* stack, size_t size, void (*entry)()) {
+    getcontext(&context.context);
+    context.context.uc_stack.ss_sp = stack;
+    context.context.uc_stack.ss_size = size;
+    context.context.uc_link = nullptr;
+    makecontext(&context.context, entry, 0);
+}
+#endif
+
+// One simulated GPU thread. Fibers live as long as their worker and run one
+// kernel invocation each time the scheduler switches to them with a new position.
+struct Fiber {
+    FiberContext context;
+    std::unique_ptr<char[]> stack;
+    MetalThreadPosition position;
+    bool finished;
+};
+
+} // namespace
+
+struct MetalCpuDevice::Worker {
+    FiberContext scheduler;
+    std::vector<std::unique_ptr<Fiber>> fibers;
+    std::vector<std::max_align_t> threadgroupMemory;
+    const MetalKernelFn* kernel = nullptr;
+    std::exception_ptr error;
+};
+
+// The fiber running on this OS thread, if any, and the worker that owns it
+static thread_local Fiber* currentFiber = nullptr;
+static thread_local MetalCpuDevice::Worker* currentWorker = nullptr;
+
+[[noreturn]] static void fiberMain() {
+    Fiber* fiber = currentFiber;
+    MetalCpuDevice::Worker* worker = currentWorker;
+    for (;;) {
+        try {
+            (*worker->kernel)(fiber->position, worker->threadgroupMemory.data());
+        } catch (...) {
+            if (!worker->error) worker->error = std::current_exception();
+        }
+        fiber->finished = true;
+        switchContext(fiber->context, worker->scheduler);
+    }
+}
+
+void metalCpuThreadgroupBarrier() {
+    Fiber* fiber = currentFiber;
+    if (!fiber) return;
+    switchContext(fiber->context, currentWorker->scheduler);
+}
+
+// Every thread runs until it finishes or reaches a barrier, then the next one
+// resumes; a pass over the group releases the barrier for everyone.
+static void runThreadgroup(MetalCpuDevice::Worker& worker, uint32_t gridSize,
+                           uint32_t threadsPerThreadgroup, uint32_t group) {
+    uint32_t first = group * threadsPerThreadgroup;
+    uint32_t count = std::min(threadsPerThreadgroup, gridSize - first);
+
+    while (worker.fibers.size() < count) {
+        auto fiber = std::make_unique<Fiber>();
+        fiber->stack.reset(new char[fiberStackSize]);
+        makeContext(fiber->context, fiber->stack.get(), fiberStackSize, fiberMain);
+        worker.fibers.push_back(std::move(fiber));
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        worker.fibers[i]->position = {first + i, i, group, count};
+        worker.fibers[i]->finished = false;
+    }
+
+    uint32_t running = count;
+    while (running > 0) {
+        for (uint32_t i = 0; i < count; i++) {
+            Fiber& fiber = *worker.fibers[i];
+            if (fiber.finished) continue;
+            currentFiber = &fiber;
+            switchContext(worker.scheduler, fiber.context);
+            if (fiber.finished) running--;
+        }
+    }
+    currentFiber = nullptr;
+}
+
+MetalCpuDevice::MetalCpuDevice(unsigned workerCount) {
+    if (workerCount == 0) workerCount = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < workerCount; i++) workers.push_back(std::make_unique<Worker>());
+    for (unsigned i = 0; i < workerCount; i++) threads.emplace_back([this, i] { workerLoop(*workers[i]); });
+}
+
+MetalCpuDevice::~MetalCpuDevice() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : threads) t.join();
+}
+
+void MetalCpuDevice::dispatchThreads(uint32_t gridSize, uint32_t threadsPerThreadgroup,
+                                     size_t threadgroupMemoryLength, const MetalKernelFn& kernel) {
+    if (threadsPerThreadgroup == 0 || threadsPerThreadgroup > maxThreadsPerThreadgroup)
+        throw std::invalid_argument("MetalCpuDevice: threadsPerThreadgroup must be 1.." +
+                                    std::to_string(maxThreadsPerThreadgroup));
+    if (gridSize == 0) return;
+
+    std::lock_guard<std::mutex> serial(dispatchMutex);
+    std::unique_lock<std::mutex> lock(mutex);
+    current = {&kernel, gridSize, threadsPerThreadgroup, threadgroupMemoryLength,
+               (uint32_t)((uint64_t(gridSize) + threadsPerThreadgroup - 1) / threadsPerThreadgroup)};
+    nextGroup.store(0);
+    error = nullptr;
+    busy = (unsigned)workers.size();
+    ++generation;
+    wake.notify_all();
+    done.wait(lock, [this] { return busy == 0; });
+
+    if (error) std::rethrow_exception(std::exchange(error, nullptr));
+}
+
+void MetalCpuDevice::workerLoop(Worker& worker) {
+    uint64_t seen = 0;
+    for (;;) {
+        Dispatch d;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            d = current;
+        }
+
+        size_t slots = (d.threadgroupMemoryLength + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+        worker.threadgroupMemory.resize(std::max<size_t>(slots, 1));
+        worker.kernel = d.kernel;
+        currentWorker = &worker;
+
+        for (;;) {
+            uint32_t group = nextGroup.fetch_add(1);
+            if (group >= d.groupCount || worker.error) break;
+            runThreadgroup(worker, d.gridSize, d.threadsPerThreadgroup, group);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (worker.error && !error) error = worker.error;
+        worker.error = nullptr;
+        if (--busy == 0) done.notify_all();
+    }
+}
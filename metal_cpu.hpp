@@ -0,0 +1,80 @@
+#ifndef METAL_CPU_HPP
+#define METAL_CPU_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Values Metal passes through [[thread_position_in_grid]] and friends (1-D grids)
+struct MetalThreadPosition {
+    uint32_t threadPositionInGrid;
+    uint32_t threadIndexInThreadgroup;
+    uint32_t threadgroupPositionInGrid;
+    uint32_t threadsPerThreadgroup;
+};
+
+// One invocation of a kernel: binds buffers and attributes, then calls it
+typedef std::function<void(const MetalThreadPosition& position, void* threadgroupMemory)> MetalKernelFn;
+
+// Runs Metal compute kernels compiled through metal_shim.hpp on a pool of CPU
+// threads. Each worker takes whole threadgroups; the threads of a group are
+// fibers on that worker, so threadgroup_barrier() switches to the next thread
+// until the whole group has arrived, and threadgroup memory is shared within
+// the group only, as on the GPU.
+class MetalCpuDevice {
+public:
+    // 0 workers: one per hardware thread
+    explicit MetalCpuDevice(unsigned workers = 0);
+    ~MetalCpuDevice();
+
+    MetalCpuDevice(const MetalCpuDevice&) = delete;
+    MetalCpuDevice& operator=(const MetalCpuDevice&) = delete;
+
+    // Like dispatchThreads:threadsPerThreadgroup: with a 1-D grid; the last
+    // threadgroup may be partial. Blocks until every thread finishes and
+    // rethrows the first exception a kernel invocation threw.
+    void dispatchThreads(uint32_t gridSize, uint32_t threadsPerThreadgroup,
+                         size_t threadgroupMemoryLength, const MetalKernelFn& kernel);
+
+    unsigned workerCount() const { return (unsigned)workers.size(); }
+
+    static constexpr uint32_t maxThreadsPerThreadgroup = 1024;
+
+    struct Worker;   // per-thread fibers and threadgroup memory (metal_cpu.cpp)
+
+private:
+    struct Dispatch {
+        const MetalKernelFn* kernel;
+        uint32_t gridSize;
+        uint32_t threadsPerThreadgroup;
+        size_t threadgroupMemoryLength;
+        uint32_t groupCount;
+    };
+
+    void workerLoop(Worker& worker);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::mutex dispatchMutex;   // one dispatch at a time
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    Dispatch current{};
+    std::atomic<uint32_t> nextGroup{0};
+    uint64_t generation = 0;
+    unsigned busy = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+};
+
+// Called by threadgroup_barrier() in metal_shim.hpp
+void metalCpuThreadgroupBarrier();
+
+#endif // METAL_CPU_HPP
@@ -0,0 +1,39 @@
+#include "metal_cpu_kernels.hpp"
+
+// Everything else must be included before the shim: it defines the Metal
+// address-space keywords (thread, device, ...) as empty macros
+#include "metal_shim.hpp"
+
+// Both sources name their entry point mineKernel
+namespace mine_kernel_metal {
+#include "mineKernel.metal"
+}
+
+namespace sha256_kernel_metal {
+#include "sha256_kernel.metal"
+}
+
+void runMineKernelCpu(MetalCpuDevice& gpu, const MineKernelBuffers& buffers,
+                      uint32_t gridSize, uint32_t threadsPerThreadgroup) {
+    // Bound as `constant uint&`
+    uint32_t candidateCapacity = buffers.candidateCapacity;
+    uint32_t nonceBase = buffers.nonceBase;
+    uint32_t nonceCount = buffers.nonceCount;
+    gpu.dispatchThreads(gridSize, threadsPerThreadgroup, mineKernelThreadgroupMemory,
+        [&](const MetalThreadPosition& p, void* shared) {
+            mine_kernel_metal::mineKernel(buffers.midstate, buffers.tail32, buffers.targetLimbs,
+                                          buffers.result, candidateCapacity, nonceBase, nonceCount,
+                                          p.threadPositionInGrid, p.threadIndexInThreadgroup,
+                                          p.threadsPerThreadgroup, static_cast<uint*>(shared));
+        });
+}
+
+void runSha256KernelCpu(MetalCpuDevice& gpu, const Sha256KernelBuffers& buffers,
+                        uint32_t gridSize, uint32_t threadsPerThreadgroup) {
+    gpu.dispatchThreads(gridSize, threadsPerThreadgroup, 0,
+        [&](const MetalThreadPosition& p, void*) {
+            sha256_kernel_metal::mineKernel(buffers.blockHeader, buffers.target, buffers.resultNonce,
+                                            buffers.nonceBase, buffers.resultHash,
+                                            p.threadPositionInGrid);
+        });
+}
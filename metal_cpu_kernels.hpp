@@ -0,0 +1,41 @@
+#ifndef METAL_CPU_KERNELS_HPP
+#define METAL_CPU_KERNELS_HPP
+
+#include "metal_cpu.hpp"
+#include <atomic>
+#include <cstdint>
+
+// The repo's Metal kernels compiled for the CPU through metal_shim.hpp, so they can
+// be validated and benchmarked on hosts without Metal. Buffers use the same layout
+// metal_miner.mm binds on the GPU.
+
+// mineKernel.metal
+struct MineKernelBuffers {
+    const uint32_t* midstate;          // 8 words
+    const uint32_t* tail32;            // header W0..W2, big-endian message words
+    const uint32_t* targetLimbs;       // 8 limbs, most significant first
+    std::atomic<uint32_t>* result;     // a GpuResult (gpu_job.hpp), word by word
+    uint32_t candidateCapacity;
+    uint32_t nonceBase;
+    uint32_t nonceCount;               // threads past it in the grid don't hash
+};
+
+// Threadgroup memory mineKernel expects: K table, tail and target limbs
+constexpr size_t mineKernelThreadgroupMemory = sizeof(uint32_t) * (64 + 4 + 8);
+
+void runMineKernelCpu(MetalCpuDevice& gpu, const MineKernelBuffers& buffers,
+                      uint32_t gridSize, uint32_t threadsPerThreadgroup);
+
+// sha256_kernel.metal: the original byte-oriented kernel, kept for comparison
+struct Sha256KernelBuffers {
+    const uint8_t* blockHeader;        // 76 bytes
+    const uint8_t* target;             // 32 bytes, little-endian
+    std::atomic<uint32_t>* resultNonce;
+    const uint32_t* nonceBase;
+    uint8_t* resultHash;               // 32 bytes
+};
+
+void runSha256KernelCpu(MetalCpuDevice& gpu, const Sha256KernelBuffers& buffers,
+                        uint32_t gridSize, uint32_t threadsPerThreadgroup);
+
+#endif // METAL_CPU_KERNELS_HPP
@@ -1,15 +1,11 @@
 #ifndef METAL_MINER_HPP
 #define METAL_MINER_HPP
 
-#include "block.hpp"
-#include <vector>
+#include "mining_session.hpp"
+#include <memory>
 
-bool metalMineBlock(
-    const BlockHeader& header,
-    const std::vector<uint8_t>& target,
-    uint32_t initialNonceBase,
-    uint32_t& validNonce,
-    std::vector<uint8_t>& validHash,
-    uint64_t& totalHashesTried);
+// MiningSession on the system default Metal device, running mineKernel from the
+// default library (mineKernel.metallib). Throws std::runtime_error if Metal setup fails.
+std::unique_ptr<MiningSession> makeMetalSession();
 
 #endif // METAL_MINER_HPP
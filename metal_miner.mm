@@ -1,183 +1,156 @@
 #import <Metal/Metal.h>
 #import <Foundation/Foundation.h>
-#include "block.hpp"
-#include <iostream>
-#include <vector>
+#include "metal_miner.hpp"
+#include "gpu_job.hpp"
+#include <algorithm>
 #include <cstring>
-#include <limits>
-
-void sha256(const uint8_t* data, size_t len, uint8_t* outHash);
-
-bool isHashLower(const uint32_t* a, const uint32_t* b) {
-    for (int i = 0; i < 8; ++i) {
-        uint32_t aBE = __builtin_bswap32(a[i]);
-        uint32_t bBE = __builtin_bswap32(b[i]);
-        if (aBE < bBE) return true;
-        if (aBE > bBE) return false;
+#include <stdexcept>
+#include <string>
+
+// Device, pipeline, queue and buffers, created once. Each pipeline slot has its
+// own result buffer, so gpuPipelineDepth ranges can be committed at once. Built
+// without ARC: every object created with new* or retained is released by hand.
+class MetalSession : public MiningSession {
+public:
+    MetalSession() {
+        try {
+            setup();
+        } catch (...) {
+            release();
+            throw;
+        }
     }
-    return false;
-}
-
-std::vector<uint8_t> serializeHeader80(const BlockHeader& header) {
-    std::vector<uint8_t> out;
-    auto appendLE32 = [&](uint32_t val) {
-        for (size_t i = 0; i < 4; ++i)
-            out.push_back((val >> (8 * i)) & 0xff);
-    };
-    auto appendReversed = [&](const std::array<uint8_t, 32>& v) {
-        for (int i = 31; i >= 0; --i)
-            out.push_back(v[i]);
-    };
-    appendLE32(header.version);
-    appendReversed(header.prevBlockHash);
-    appendReversed(header.merkleRoot);
-    appendLE32(header.timestamp);
-    appendLE32(header.bits);
-    appendLE32(header.nonce);
-    return out;
-}
 
-bool metalMineBlock(const BlockHeader& header,
-                    const std::vector<uint8_t>& target,
-                    uint32_t initialNonceBase,
-                    uint32_t& validNonce,
-                    std::vector<uint8_t>& validHash,
-                    uint64_t& totalHashesTried)
-{
-    id<MTLDevice> device = MTLCreateSystemDefaultDevice();
-    if (!device) {
-        std::cerr << "No Metal device found\n";
-        return false;
-    }
+    ~MetalSession() override { release(); }
 
-    NSError* error = nil;
-    id<MTLLibrary> library = [device newDefaultLibrary];
-    id<MTLFunction> kernelFunction = [library newFunctionWithName:@"mineKernel"];
-    id<MTLComputePipelineState> pipelineState = [device newComputePipelineStateWithFunction:kernelFunction error:&error];
-    if (!pipelineState) {
-        std::cerr << "Failed to create pipeline state: " << [[error localizedDescription] UTF8String] << std::endl;
-        return false;
-    }
+    MetalSession(const MetalSession&) = delete;
+    MetalSession& operator=(const MetalSession&) = delete;
 
-    id<MTLCommandQueue> commandQueue = [device newCommandQueue];
+    std::string describe() const override { return "metal (" + deviceName + ")"; }
 
-    std::vector<uint8_t> headerData = serializeHeader80(header);
-    if (headerData.size() != 80) {
-        std::cerr << "Header serialization incorrect size\n";
-        return false;
+    // Shared storage: the device sees these writes at the next commit
+    void loadJob(const GpuJob& prepared) override {
+        if (inFlight) throw std::runtime_error("Metal: loadJob with ranges still in flight");
+        job = prepared;
+        std::memcpy(midstateBuffer.contents, job.midstate, sizeof(job.midstate));
+        std::memcpy(tailBuffer.contents, job.tail32, sizeof(job.tail32));
+        std::memcpy(targetBuffer.contents, job.target32, sizeof(job.target32));
     }
 
-    uint8_t midstateBytes[32];
-    sha256(headerData.data(), 64, midstateBytes);
-    uint32_t midstate[8];
-    for (int i = 0; i < 8; ++i) {
-        midstate[i] = ((uint32_t)midstateBytes[i * 4]) |
-                      ((uint32_t)midstateBytes[i * 4 + 1] << 8) |
-                      ((uint32_t)midstateBytes[i * 4 + 2] << 16) |
-                      ((uint32_t)midstateBytes[i * 4 + 3] << 24);
+    MiningResult mine(uint32_t nonceBase, uint32_t count) override {
+        submit(nonceBase, count);
+        return collect();
     }
 
-    uint32_t tail32[4];
-    for (int i = 0; i < 4; ++i) {
-        tail32[i] = ((uint32_t)headerData[64 + i * 4 + 0]) |
-                    ((uint32_t)headerData[64 + i * 4 + 1] << 8) |
-                    ((uint32_t)headerData[64 + i * 4 + 2] << 16) |
-                    ((uint32_t)headerData[64 + i * 4 + 3] << 24);
-    }
-
-    uint32_t target32[8];
-    for (int i = 0; i < 8; ++i) {
-        target32[i] = ((uint32_t)target[i * 4 + 0] << 24) |
-                      ((uint32_t)target[i * 4 + 1] << 16) |
-                      ((uint32_t)target[i * 4 + 2] << 8)  |
-                      ((uint32_t)target[i * 4 + 3]);
+    size_t pipelineDepth() const override { return gpuPipelineDepth; }
+
+    void submit(uint32_t nonceBase, uint32_t count) override {
+        if (inFlight == gpuPipelineDepth) throw std::runtime_error("Metal: submit with the pipeline full");
+        Slot& slot = slots[(next + inFlight) % gpuPipelineDepth];
+
+        // Whole threadgroups only: the kernel's first 64 threads load K for the group.
+        // Threads past count return after the loads, so the range is hashed exactly.
+        NSUInteger groupSize = pipelineState.maxTotalThreadsPerThreadgroup;
+        uint64_t threads = (uint64_t(count) + groupSize - 1) / groupSize * groupSize;
+        threads = std::max<uint64_t>(groupSize, std::min<uint64_t>(threads, UINT32_MAX / groupSize * groupSize));
+
+        resetGpuResult(*(GpuResult*)slot.result.contents, nonceBase);
+        @autoreleasepool {
+            // Retained past the pool so collect() can wait on it
+            id<MTLCommandBuffer> commandBuffer = [[commandQueue commandBuffer] retain];
+            id<MTLComputeCommandEncoder> encoder = [commandBuffer computeCommandEncoder];
+            [encoder setComputePipelineState:pipelineState];
+            [encoder setBuffer:midstateBuffer offset:0 atIndex:0];
+            [encoder setBuffer:tailBuffer     offset:0 atIndex:1];
+            [encoder setBuffer:targetBuffer   offset:0 atIndex:2];
+            [encoder setBuffer:slot.result    offset:0 atIndex:3];
+            [encoder setBytes:&gpuCandidateCapacity length:sizeof(gpuCandidateCapacity) atIndex:4];
+            [encoder setBytes:&nonceBase length:sizeof(nonceBase) atIndex:5];
+            [encoder setBytes:&count length:sizeof(count) atIndex:6];
+            [encoder setThreadgroupMemoryLength:sizeof(uint32_t) * (64 + 4 + 8) atIndex:0];
+            [encoder dispatchThreads:MTLSizeMake(threads, 1, 1) threadsPerThreadgroup:MTLSizeMake(groupSize, 1, 1)];
+            [encoder endEncoding];
+            [commandBuffer commit];
+            slot.commandBuffer = commandBuffer;
+        }
+        ++inFlight;
     }
 
-    const uint32_t threadsPerDispatch = 131072;
-    const uint32_t dispatchCount = 8;
-    const uint32_t totalThreads = threadsPerDispatch * dispatchCount;
-    totalHashesTried = totalThreads;
-
-    id<MTLBuffer> midstateBuffer = [device newBufferWithBytes:midstate length:sizeof(midstate) options:MTLResourceStorageModeShared];
-    id<MTLBuffer> tailBuffer     = [device newBufferWithBytes:tail32  length:sizeof(tail32)  options:MTLResourceStorageModeShared];
-    id<MTLBuffer> targetBuffer   = [device newBufferWithBytes:target32 length:sizeof(target32) options:MTLResourceStorageModeShared];
-    id<MTLBuffer> resultNonceBuf = [device newBufferWithLength:sizeof(uint32_t) options:MTLResourceStorageModeShared];
-    id<MTLBuffer> resultHashes   = [device newBufferWithLength:totalThreads * sizeof(uint32_t) * 8 options:MTLResourceStorageModeShared];
-    id<MTLBuffer> nonceBaseBuf   = [device newBufferWithLength:sizeof(uint32_t) options:MTLResourceStorageModeShared];
-
-    uint32_t zero = 0;
-    memcpy(resultNonceBuf.contents, &zero, sizeof(uint32_t));
-
-    id<MTLCommandBuffer> commandBuffer = [commandQueue commandBuffer];
-    id<MTLComputeCommandEncoder> encoder = [commandBuffer computeCommandEncoder];
-
-    [encoder setComputePipelineState:pipelineState];
-    [encoder setBuffer:midstateBuffer offset:0 atIndex:0];
-    [encoder setBuffer:tailBuffer     offset:0 atIndex:1];
-    [encoder setBuffer:targetBuffer   offset:0 atIndex:2];
-    [encoder setBuffer:resultNonceBuf offset:0 atIndex:3];
-    [encoder setBuffer:resultHashes   offset:0 atIndex:4];
-    [encoder setBuffer:nonceBaseBuf   offset:0 atIndex:5];
-    [encoder setThreadgroupMemoryLength:sizeof(uint32_t) * (64 + 4 + 8) atIndex:0];
-
-    NSUInteger threadGroupSize = pipelineState.maxTotalThreadsPerThreadgroup;
-    if (threadGroupSize > threadsPerDispatch) threadGroupSize = threadsPerDispatch;
-    MTLSize threadgroupSize = MTLSizeMake(threadGroupSize, 1, 1);
-
-    for (uint32_t i = 0; i < dispatchCount; ++i) {
-        uint32_t nonceBase = initialNonceBase + i * threadsPerDispatch;
-        MTLSize gridSize = MTLSizeMake(threadsPerDispatch, 1, 1);
-        memcpy(nonceBaseBuf.contents, &nonceBase, sizeof(uint32_t));
-        [encoder setBuffer:nonceBaseBuf offset:0 atIndex:5];
-        [encoder dispatchThreads:gridSize threadsPerThreadgroup:threadgroupSize];
+    MiningResult collect() override {
+        if (inFlight == 0) throw std::runtime_error("Metal: collect with nothing submitted");
+        Slot& slot = slots[next];
+        next = (next + 1) % gpuPipelineDepth;
+        --inFlight;
+        [slot.commandBuffer waitUntilCompleted];
+        bool failed = slot.commandBuffer.status == MTLCommandBufferStatusError;
+        [slot.commandBuffer release];
+        slot.commandBuffer = nil;
+        if (failed) throw std::runtime_error("Metal: mining command buffer failed");
+
+        // Shared storage, read in place: the header words and only the written candidates
+        return finishGpuResult(job, *(GpuResult*)slot.result.contents);
     }
 
-    [encoder endEncoding];
-    [commandBuffer commit];
-    [commandBuffer waitUntilCompleted];
-
-    const uint32_t* hashStart = (const uint32_t*)resultHashes.contents;
-    const uint32_t* bestHash = hashStart;
-    uint32_t bestIndex = 0;
+private:
+    struct Slot {
+        id<MTLBuffer> result = nil;
+        id<MTLCommandBuffer> commandBuffer = nil;   // while in flight
+    };
 
-    for (uint32_t i = 1; i < totalThreads; ++i) {
-        const uint32_t* current = hashStart + i * 8;
-        if (isHashLower(current, bestHash)) {
-            bestHash = current;
-            bestIndex = i;
-        }
+    void setup() {
+        device = MTLCreateSystemDefaultDevice();
+        if (!device) throw std::runtime_error("Metal: no device found");
+        deviceName = [[device name] UTF8String];
+
+        NSError* error = nil;
+        library = [device newDefaultLibrary];
+        if (!library) throw std::runtime_error("Metal: no default library (mineKernel.metallib)");
+        kernelFunction = [library newFunctionWithName:@"mineKernel"];
+        if (!kernelFunction) throw std::runtime_error("Metal: mineKernel not found in the library");
+        pipelineState = [device newComputePipelineStateWithFunction:kernelFunction error:&error];
+        if (!pipelineState)
+            throw std::runtime_error(std::string("Metal: failed to create pipeline state: ") +
+                                     [[error localizedDescription] UTF8String]);
+        commandQueue = [device newCommandQueue];
+
+        midstateBuffer = [device newBufferWithLength:sizeof(job.midstate) options:MTLResourceStorageModeShared];
+        tailBuffer     = [device newBufferWithLength:sizeof(job.tail32) options:MTLResourceStorageModeShared];
+        targetBuffer   = [device newBufferWithLength:sizeof(job.target32) options:MTLResourceStorageModeShared];
+        for (Slot& slot : slots)
+            slot.result = [device newBufferWithLength:sizeof(GpuResult) options:MTLResourceStorageModeShared];
     }
 
-    printf("[DEBUG] Best Sample Hash [%u]: ", bestIndex);
-    for (int i = 0; i < 8; ++i) {
-        uint32_t be = __builtin_bswap32(bestHash[i]);
-        printf("%02x%02x%02x%02x", (be >> 24), (be >> 16) & 0xff, (be >> 8) & 0xff, be & 0xff);
-    }
-    printf("\n");
-
-    uint32_t foundNonce = *((uint32_t*)resultNonceBuf.contents);
-    if (foundNonce != 0 && foundNonce < totalThreads) {
-        validNonce = foundNonce + initialNonceBase;
-        const uint32_t* validHashPtr = hashStart + foundNonce * 8;
-        validHash.resize(32);
-        for (int i = 0; i < 8; ++i) {
-            uint32_t word = __builtin_bswap32(validHashPtr[i]);
-            validHash[i * 4 + 0] = (word >> 24) & 0xFF;
-            validHash[i * 4 + 1] = (word >> 16) & 0xFF;
-            validHash[i * 4 + 2] = (word >> 8) & 0xFF;
-            validHash[i * 4 + 3] = word & 0xFF;
+    void release() {
+        for (Slot& slot : slots) {
+            [slot.commandBuffer waitUntilCompleted];
+            [slot.commandBuffer release];
+            [slot.result release];
         }
-        return true;
-    } else {
-        validNonce = 0;
-        validHash.resize(32);
-        for (int i = 0; i < 8; ++i) {
-            uint32_t word = __builtin_bswap32(bestHash[i]);
-            validHash[i * 4 + 0] = (word >> 24) & 0xFF;
-            validHash[i * 4 + 1] = (word >> 16) & 0xFF;
-            validHash[i * 4 + 2] = (word >> 8) & 0xFF;
-            validHash[i * 4 + 3] = word & 0xFF;
-        }
-        return false;
+        [targetBuffer release];
+        [tailBuffer release];
+        [midstateBuffer release];
+        [commandQueue release];
+        [pipelineState release];
+        [kernelFunction release];
+        [library release];
+        [device release];
     }
+
+    id<MTLDevice> device = nil;
+    id<MTLLibrary> library = nil;
+    id<MTLFunction> kernelFunction = nil;
+    id<MTLComputePipelineState> pipelineState = nil;
+    id<MTLCommandQueue> commandQueue = nil;
+    id<MTLBuffer> midstateBuffer = nil;
+    id<MTLBuffer> tailBuffer = nil;
+    id<MTLBuffer> targetBuffer = nil;
+    Slot slots[gpuPipelineDepth];
+    size_t next = 0;       // oldest in-flight slot
+    size_t inFlight = 0;
+    std::string deviceName;
+    GpuJob job{};
+};
+
+std::unique_ptr<MiningSession> makeMetalSession() {
+    return std::make_unique<MetalSession>();
 }
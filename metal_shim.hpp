@@ -0,0 +1,73 @@
+#ifndef METAL_SHIM_HPP
+#define METAL_SHIM_HPP
+
+// Just enough of the Metal Shading Language, as C++, to compile this repo's
+// .metal kernels for the CPU. Include it, then the .metal source (inside a
+// namespace, since both kernels are called mineKernel); metal_shim/metal_stdlib
+// forwards here so the kernels' own `#include <metal_stdlib>` resolves.
+// Run the result with MetalCpuDevice (metal_cpu.hpp).
+//
+// Address spaces and `kernel` become nothing and [[...]] attributes are ignored,
+// so kernel parameters are bound by position from the caller. The macros are
+// defined last: include every other header before this one.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+typedef unsigned int uint;
+
+namespace metal {
+
+struct uint4 {
+    uint x, y, z, w;
+    uint4() = default;
+    uint4(uint x_, uint y_, uint z_, uint w_) : x(x_), y(y_), z(z_), w(w_) {}
+};
+static_assert(sizeof(uint4) == 16, "uint4 must match the GPU buffer layout");
+
+typedef std::atomic<uint> atomic_uint;
+using std::atomic_compare_exchange_weak_explicit;
+using std::atomic_exchange_explicit;
+using std::atomic_fetch_add_explicit;
+using std::atomic_load_explicit;
+using std::atomic_store_explicit;
+using std::memory_order_relaxed;
+using std::min;
+
+// std::atomic has no fetch_min before C++26
+inline uint atomic_fetch_min_explicit(atomic_uint* object, uint value, std::memory_order order) {
+    uint old = object->load(std::memory_order_relaxed);
+    while (value < old && !object->compare_exchange_weak(old, value, order, std::memory_order_relaxed)) {}
+    return old;
+}
+
+enum class mem_flags { mem_none = 0, mem_device = 1, mem_threadgroup = 2, mem_texture = 4 };
+
+} // namespace metal
+
+// Suspends the calling simulated thread until every thread in its threadgroup
+// arrives (metal_cpu.cpp). A no-op outside MetalCpuDevice::dispatchThreads.
+void metalCpuThreadgroupBarrier();
+
+namespace metal {
+
+inline void threadgroup_barrier(mem_flags) {
+    metalCpuThreadgroupBarrier();
+}
+
+} // namespace metal
+
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wunknown-attributes"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wattributes"
+#endif
+
+#define kernel
+#define device
+#define constant
+#define threadgroup
+#define thread
+
+#endif // METAL_SHIM_HPP
@@ -9,6 +9,8 @@
 // Tracks stats during mining sessions
 struct MiningStats {
     std::atomic<bool> quit{false};                      // Signal to stop mining
+    std::atomic<uint64_t> jobEpoch{0};                  // Bumped by a new template; older work is dropped
+    std::atomic<uint64_t> staleHashes{0};               // Hashes spent on work a new epoch made stale
     std::atomic<uint64_t> totalHashes{0};               // Total hashes computed
     std::atomic<uint64_t> hashes{0};                    // Hashes in current session (used in main.cpp)
     std::atomic<uint32_t> nonceBase{0};                 // Starting nonce for GPU batch
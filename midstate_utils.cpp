@@ -1,33 +1,42 @@
 #include "midstate_utils.hpp"
 #include "block.hpp"
-#include <openssl/sha.h>
+#include "cpu_dispatch.hpp"
+#include "sha256_avx2.hpp"
+#include "sha256_compress.hpp"
+#include "sha256_shani.hpp"
+#include "sha256_simd.hpp"
 #include <stdexcept>
 #include <vector>
-#include <cstring>  // for memcpy
 
-// Calculate midstate (SHA256 first 64 bytes of block header)
-Midstate calculateMidstateFromHeader(const std::vector<uint8_t>& header) {
-    if (header.size() != 64) {
-        throw std::runtime_error("Header must be exactly 64 bytes to calculate midstate");
-    }
+std::array<uint32_t, 8> sha256Midstate(std::span<const uint8_t, 64> prefix) {
+    std::array<uint32_t, 8> state;
+    std::copy(sha256_iv, sha256_iv + 8, state.begin());
+    if (shaniAvailable())
+        sha256_compress_shani(prefix.data(), 1, state);
+    else
+        sha256_compress(prefix.data(), state);
+    return state;
+}
 
-    uint8_t hash[32];
-    SHA256(header.data(), header.size(), hash);
+void sha256Midstates(std::span<const uint8_t> prefixes, std::span<std::array<uint32_t, 8>> out) {
+    if (prefixes.size() != out.size() * 64)
+        throw std::runtime_error("sha256Midstates: need exactly 64 prefix bytes per midstate");
 
-    Midstate mid;
-    for (size_t i = 0; i < 8; ++i) {
-        mid.h[i] = (uint32_t(hash[i * 4]) << 24) |
-                   (uint32_t(hash[i * 4 + 1]) << 16) |
-                   (uint32_t(hash[i * 4 + 2]) << 8) |
-                   uint32_t(hash[i * 4 + 3]);
+    if (shaniAvailable()) {
+        for (size_t i = 0; i < out.size(); ++i) {
+            std::copy(sha256_iv, sha256_iv + 8, out[i].begin());
+            sha256_compress_shani(prefixes.data() + i * 64, 1, out[i]);
+        }
+    } else if (cpuFeatures().avx2) {
+        sha256MidstatesAVX2(prefixes.data(), out.size(), out.data());
+    } else {
+        sha256_midstates_lanes<LaneWord<4>>(prefixes.data(), out.size(), out.data());
     }
-
-    return mid;
 }
 
-// Converts BlockHeader struct to a vector<uint8_t> 80 bytes in little-endian format
-static std::vector<uint8_t> serializeBlockHeader(const BlockHeader& header) {
-    std::vector<uint8_t> data(80);
+// Converts BlockHeader struct to its 80 bytes in little-endian format
+static std::array<uint8_t, 80> serializeBlockHeader(const BlockHeader& header) {
+    std::array<uint8_t, 80> data;
 
     // version - 4 bytes LE
     data[0] = (header.version >> 0) & 0xFF;
@@ -64,14 +73,59 @@ static std::vector<uint8_t> serializeBlockHeader(const BlockHeader& header) {
 
 // Compute midstate from BlockHeader
 std::array<uint32_t, 8> midstateFromHeader(const BlockHeader& header) {
-    std::vector<uint8_t> serialized = serializeBlockHeader(header);
-    std::vector<uint8_t> first64(serialized.begin(), serialized.begin() + 64);
-    Midstate mid = calculateMidstateFromHeader(first64);
-    return mid.h;
+    std::array<uint8_t, 80> serialized = serializeBlockHeader(header);
+    return sha256Midstate(std::span<const uint8_t, 64>(serialized.data(), 64));
 }
 
 // Extract tail from BlockHeader: bytes from offset 64 to 80
 std::vector<uint8_t> tailFromHeader(const BlockHeader& header) {
-    std::vector<uint8_t> serialized = serializeBlockHeader(header);
+    std::array<uint8_t, 80> serialized = serializeBlockHeader(header);
     return std::vector<uint8_t>(serialized.begin() + 64, serialized.end());
 }
+
+PreparedTail prepareTail(const std::array<uint32_t, 8>& midstate, const std::array<uint32_t, 3>& tailWords) {
+    PreparedTail pt;
+    pt.midstate = midstate;
+    pt.w = tailWords;
+
+    // Rounds 0..2 only see W0..W2
+    uint32_t a = midstate[0], b = midstate[1], c = midstate[2], d = midstate[3];
+    uint32_t e = midstate[4], f = midstate[5], g = midstate[6], h = midstate[7];
+    for (int i = 0; i < 3; ++i) {
+        uint32_t T1 = h + sha256_bsig1(e) + sha256_ch(e, f, g) + sha256_k[i] + tailWords[i];
+        uint32_t T2 = sha256_bsig0(a) + sha256_maj(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + T1;
+        d = c;
+        c = b;
+        b = a;
+        a = T1 + T2;
+    }
+    pt.state = {a, b, c, d, e, f, g, h};
+
+    // Round 3 up to the W3 add
+    pt.t1Base = h + sha256_bsig1(e) + sha256_ch(e, f, g) + sha256_k[3];
+    pt.t2 = sha256_bsig0(a) + sha256_maj(a, b, c);
+
+    // Schedule with W4 = 0x80000000, W5..W14 = 0, W15 = 640
+    const uint32_t w0 = tailWords[0], w1 = tailWords[1], w2 = tailWords[2];
+    pt.w16 = sha256_ssig0(w1) + w0;
+    pt.w17 = sha256_ssig1(640u) + sha256_ssig0(w2) + w1;
+    pt.w18Base = sha256_ssig1(pt.w16) + w2;
+    pt.w19Base = sha256_ssig1(pt.w17) + sha256_ssig0(0x80000000u);
+
+    return pt;
+}
+
+PreparedTail prepareTail(const BlockHeader& header) {
+    std::array<uint8_t, 80> serialized = serializeBlockHeader(header);
+    const uint8_t* tail = serialized.data() + 64;
+    std::array<uint32_t, 3> words;
+    for (int i = 0; i < 3; ++i) {
+        words[i] = (uint32_t(tail[i * 4]) << 24) | (uint32_t(tail[i * 4 + 1]) << 16) |
+                   (uint32_t(tail[i * 4 + 2]) << 8) | uint32_t(tail[i * 4 + 3]);
+    }
+    return prepareTail(sha256Midstate(std::span<const uint8_t, 64>(serialized.data(), 64)), words);
+}
@@ -3,17 +3,41 @@
 
 #include <array>
 #include <cstdint>
+#include <span>
 #include <vector>
 
-struct Midstate {
-    std::array<uint32_t, 8> h;
-};
+// SHA-256 midstate of a header: the raw compression state after its first 64
+// bytes (no padding, so not a digest of them). No allocation; SHA-NI when available.
+std::array<uint32_t, 8> sha256Midstate(std::span<const uint8_t, 64> prefix);
 
-// Calculates SHA256 midstate from first 64 bytes of header
-Midstate calculateMidstateFromHeader(const std::vector<uint8_t>& header);
+// Batch form for extranonce and version rolling: out[i] is the midstate of
+// prefixes[64 * i, 64 * i + 64). SHA-NI when available, else 4-8 prefixes
+// per SIMD transform.
+// Throws if prefixes.size() != 64 * out.size().
+void sha256Midstates(std::span<const uint8_t> prefixes, std::span<std::array<uint32_t, 8>> out);
 
 // Convenience wrappers used in main.cpp:
 std::array<uint32_t, 8> midstateFromHeader(const struct BlockHeader& header);
 std::vector<uint8_t> tailFromHeader(const struct BlockHeader& header);
 
+// Nonce-invariant part of the header's second 64-byte block, computed once per job.
+// The nonce is message word W3, so rounds 0..2, all of round 3 except the W3 add,
+// and the schedule terms that do not involve W3 are the same for every nonce.
+struct PreparedTail {
+    std::array<uint32_t, 8> midstate;   // feed-forward for the first hash
+    std::array<uint32_t, 3> w;          // W0..W2: merkle root tail, time, bits
+    std::array<uint32_t, 8> state;      // working variables a..h after round 2
+    uint32_t t1Base;                    // round 3 T1 without W3
+    uint32_t t2;                        // round 3 T2 (depends only on a, b, c)
+    uint32_t w16, w17;                  // schedule words with no W3 term
+    uint32_t w18Base;                   // W18 = w18Base + SSIG0(W3)
+    uint32_t w19Base;                   // W19 = w19Base + W3
+};
+
+// Precompute the prepared tail from a midstate and the tail words W0..W2
+PreparedTail prepareTail(const std::array<uint32_t, 8>& midstate, const std::array<uint32_t, 3>& tailWords);
+
+// Same, starting from a block header via midstateFromHeader/tailFromHeader
+PreparedTail prepareTail(const struct BlockHeader& header);
+
 #endif // MIDSTATE_UTILS_HPP
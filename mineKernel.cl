@@ -0,0 +1,154 @@
+// OpenCL port of mineKernel.metal (OpenCL C 1.2). One nonce per work-item; only
+// nonces whose most significant hash limb meets the target's are written out,
+// and the host finishes them with the full compare (confirmNonce).
+//
+// `result` is a GpuResult (gpu_job.hpp), indexed by word:
+#define RESULT_HASH_COUNT 0
+#define RESULT_BEST_LIMB 1
+#define RESULT_BEST_NONCE 2
+#define RESULT_CANDIDATE_COUNT 3
+#define RESULT_CANDIDATES 4
+
+#define ROTR(x, n) rotate((uint)(x), (uint)(32 - (n)))
+#define SSIG0(x) (ROTR(x, 7) ^ ROTR(x, 18) ^ ((x) >> 3))
+#define SSIG1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
+#define BSIG0(x) (ROTR(x, 2) ^ ROTR(x, 13) ^ ROTR(x, 22))
+#define BSIG1(x) (ROTR(x, 6) ^ ROTR(x, 11) ^ ROTR(x, 25))
+#define CH(x, y, z) bitselect((z), (y), (x))
+#define MAJ(x, y, z) bitselect((x), (y), (x) ^ (z))
+
+#define BSWAP32(x) as_uint(as_uchar4(x).wzyx)
+
+__constant uint K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+__constant uint IV[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// The second hash always compresses a 32-byte digest from the IV: W8 = 0x80000000,
+// W9..W14 = 0, W15 = 256. Round 0 and the K+W sums of rounds 8..15 fold to constants.
+#define R0_T1 (0x5be0cd19 + BSIG1(0x510e527fu) + CH(0x510e527fu, 0x9b05688cu, 0x1f83d9abu) + 0x428a2f98)
+#define R0_A (R0_T1 + BSIG0(0x6a09e667u) + MAJ(0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u))
+#define R0_E (0xa54ff53a + R0_T1)
+
+__constant uint KW_PAD[8] = {
+    0xd807aa98 + 0x80000000, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174 + 256
+};
+
+#define SHA256_ROUND(kw) do {                                     \
+        uint T1 = h + BSIG1(e) + CH(e, f, g) + (kw);                \
+        uint T2 = BSIG0(a) + MAJ(a, b, c);                          \
+        h = g; g = f; f = e;                                        \
+        e = d + T1;                                                 \
+        d = c; c = b; b = a;                                        \
+        a = T1 + T2;                                                \
+    } while (0)
+
+// First hash: the header's second block (tail words, nonce word, padding, 640-bit
+// length) on the midstate. Writes the 32-byte digest as eight message words.
+inline void sha256_first(__constant uint* tail32, __constant uint* midstate,
+                         uint nonceWord, uint* output)
+{
+    uint w[64];
+
+    // Header bytes 64..75 are W0..W2, the nonce is W3
+    for (uint i = 0; i < 3; i++) w[i] = tail32[i];
+    w[3] = nonceWord;
+    w[4] = 0x80000000;
+    for (uint i = 5; i < 15; i++) w[i] = 0;
+    w[15] = 640;
+
+    #pragma unroll
+    for (uint i = 16; i < 64; i++) {
+        w[i] = SSIG1(w[i-2]) + w[i-7] + SSIG0(w[i-15]) + w[i-16];
+    }
+
+    uint a = midstate[0], b = midstate[1], c = midstate[2], d = midstate[3];
+    uint e = midstate[4], f = midstate[5], g = midstate[6], h = midstate[7];
+
+    #pragma unroll
+    for (uint i = 0; i < 64; i++) {
+        SHA256_ROUND(K[i] + w[i]);
+    }
+
+    output[0] = a + midstate[0];
+    output[1] = b + midstate[1];
+    output[2] = c + midstate[2];
+    output[3] = d + midstate[3];
+    output[4] = e + midstate[4];
+    output[5] = f + midstate[5];
+    output[6] = g + midstate[6];
+    output[7] = h + midstate[7];
+}
+
+// Second hash over the first digest, stopped after round 60: the final H7 is
+// IV7 plus that round's `e`, and H7 holds the most significant limb.
+inline uint sha256d_second_h7(uint* w)
+{
+    w[16] = SSIG0(w[1]) + w[0];
+    w[17] = SSIG0(w[2]) + w[1] + SSIG1(256u);
+    w[18] = SSIG1(w[16]) + SSIG0(w[3]) + w[2];
+    w[19] = SSIG1(w[17]) + SSIG0(w[4]) + w[3];
+    w[20] = SSIG1(w[18]) + SSIG0(w[5]) + w[4];
+    w[21] = SSIG1(w[19]) + SSIG0(w[6]) + w[5];
+    w[22] = SSIG1(w[20]) + SSIG0(w[7]) + w[6] + 256;
+    w[23] = SSIG1(w[21]) + w[16] + w[7] + SSIG0(0x80000000u);
+    w[24] = SSIG1(w[22]) + w[17] + 0x80000000;
+    for (uint i = 25; i < 30; i++) w[i] = SSIG1(w[i-2]) + w[i-7];
+    w[30] = SSIG1(w[28]) + w[23] + SSIG0(256u);
+    w[31] = SSIG1(w[29]) + w[24] + SSIG0(w[16]) + 256;
+    #pragma unroll
+    for (uint i = 32; i < 61; i++) {
+        w[i] = SSIG1(w[i-2]) + w[i-7] + SSIG0(w[i-15]) + w[i-16];
+    }
+
+    uint a = R0_A + w[0], b = IV[0], c = IV[1], d = IV[2];
+    uint e = R0_E + w[0], f = IV[4], g = IV[5], h = IV[6];
+
+    #pragma unroll
+    for (uint i = 1; i < 8; i++) SHA256_ROUND(K[i] + w[i]);
+    #pragma unroll
+    for (uint i = 8; i < 16; i++) SHA256_ROUND(KW_PAD[i - 8]);
+    #pragma unroll
+    for (uint i = 16; i < 61; i++) SHA256_ROUND(K[i] + w[i]);
+
+    return e + IV[7];
+}
+
+// Candidates, the lowest top limb and the hash count are all reduced here; the
+// host resets the header words before each range.
+__kernel void mineKernel(__constant uint* midstate,
+                         __constant uint* blockTail32,   // W0..W2, big-endian message words
+                         __constant uint* targetLimbs,   // most significant limb first
+                         __global volatile uint* result,
+                         uint candidateCapacity,
+                         uint nonceBase)
+{
+    if (get_local_id(0) == 0) atomic_add(&result[RESULT_HASH_COUNT], (uint)get_local_size(0));
+
+    // The header stores the nonce little-endian
+    uint nonce = nonceBase + (uint)get_global_id(0);
+    uint w[64];
+    sha256_first(blockTail32, midstate, BSWAP32(nonce), w);
+    uint limb = BSWAP32(sha256d_second_h7(w));
+
+    // bestLimb only falls, so a stale read is never too low: most work-items skip the atomic
+    if (limb < result[RESULT_BEST_LIMB] && limb < atomic_min(&result[RESULT_BEST_LIMB], limb))
+        atomic_xchg(&result[RESULT_BEST_NONCE], nonce);
+
+    if (limb <= targetLimbs[0]) {
+        uint slot = atomic_inc(&result[RESULT_CANDIDATE_COUNT]);
+        if (slot < candidateCapacity) result[RESULT_CANDIDATES + slot] = nonce;
+    }
+}
@@ -2,34 +2,64 @@
 using namespace metal;
 
 // Rotate right (portable)
-inline uint rotr(uint x, uint n) {
+constexpr uint rotr(uint x, uint n) {
     return (x >> n) | (x << (32 - n));
 }
 
 // SHA-256 logic functions
-inline uint ssig0(uint x) { return rotr(x, 7) ^ rotr(x, 18) ^ (x >> 3); }
-inline uint ssig1(uint x) { return rotr(x, 17) ^ rotr(x, 19) ^ (x >> 10); }
-inline uint bsig0(uint x) { return rotr(x, 2) ^ rotr(x, 13) ^ rotr(x, 22); }
-inline uint bsig1(uint x) { return rotr(x, 6) ^ rotr(x, 11) ^ rotr(x, 25); }
-
-inline void sha256_compress(const threadgroup uint* K,
-                            const threadgroup uint* tail32,
-                            const constant uint* midstate,
-                            uint nonce,
-                            thread uint *output)
+constexpr uint ssig0(uint x) { return rotr(x, 7) ^ rotr(x, 18) ^ (x >> 3); }
+constexpr uint ssig1(uint x) { return rotr(x, 17) ^ rotr(x, 19) ^ (x >> 10); }
+constexpr uint bsig0(uint x) { return rotr(x, 2) ^ rotr(x, 13) ^ rotr(x, 22); }
+constexpr uint bsig1(uint x) { return rotr(x, 6) ^ rotr(x, 11) ^ rotr(x, 25); }
+constexpr uint ch(uint x, uint y, uint z) { return (x & y) ^ (~x & z); }
+constexpr uint maj(uint x, uint y, uint z) { return (x & y) ^ (x & z) ^ (y & z); }
+
+inline uint bswap32(uint x) {
+    return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+
+constant constexpr uint IV[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// The second hash always compresses a 32-byte digest from the IV: W8 = 0x80000000,
+// W9..W14 = 0, W15 = 256. Round 0 and the K+W sums of rounds 8..15 fold to constants.
+constant constexpr uint R0_T1 = 0x5be0cd19 + bsig1(0x510e527f) + ch(0x510e527f, 0x9b05688c, 0x1f83d9ab) + 0x428a2f98;
+constant constexpr uint R0_A = R0_T1 + bsig0(0x6a09e667) + maj(0x6a09e667, 0xbb67ae85, 0x3c6ef372);
+constant constexpr uint R0_E = 0xa54ff53a + R0_T1;
+constant constexpr uint KW_PAD[8] = {
+    0xd807aa98 + 0x80000000, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174 + 256
+};
+
+#define SHA256_ROUND(kw) do {                                     \
+        uint T1 = h + bsig1(e) + ch(e, f, g) + (kw);                \
+        uint T2 = bsig0(a) + maj(a, b, c);                          \
+        h = g; g = f; f = e;                                        \
+        e = d + T1;                                                 \
+        d = c; c = b; b = a;                                        \
+        a = T1 + T2;                                                \
+    } while (0)
+
+// First hash: the header's second block (tail words, nonce word, padding, 640-bit
+// length) on the midstate. Writes the 32-byte digest as eight message words.
+inline void sha256_first(const threadgroup uint* K,
+                         const threadgroup uint* tail32,
+                         const constant uint* midstate,
+                         uint nonceWord,
+                         thread uint *output)
 {
     uint w[64];
 
-    // Load block tail into w[0..3]
-    for (uint i = 0; i < 4; i++) {
+    // Header bytes 64..75 are W0..W2, the nonce is W3
+    for (uint i = 0; i < 3; i++) {
         w[i] = tail32[i];
     }
-
-    // Insert nonce at w[4]
-    w[4] = nonce;
-    w[5] = 0x80000000;
-    for (uint i = 6; i < 15; i++) w[i] = 0;
-    w[15] = 160;
+    w[3] = nonceWord;
+    w[4] = 0x80000000;
+    for (uint i = 5; i < 15; i++) w[i] = 0;
+    w[15] = 640;
 
     // Extend schedule
     #pragma unroll
@@ -37,22 +67,14 @@ inline void sha256_compress(const threadgroup uint* K,
         w[i] = ssig1(w[i-2]) + w[i-7] + ssig0(w[i-15]) + w[i-16];
     }
 
-    // Initialize state
     uint a = midstate[0], b = midstate[1], c = midstate[2], d = midstate[3];
     uint e = midstate[4], f = midstate[5], g = midstate[6], h = midstate[7];
 
-    // Main SHA-256 loop
     #pragma unroll
     for (uint i = 0; i < 64; i++) {
-        uint T1 = h + bsig1(e) + ((e & f) ^ (~e & g)) + K[i] + w[i];
-        uint T2 = bsig0(a) + ((a & b) ^ (a & c) ^ (b & c));
-        h = g; g = f; f = e;
-        e = d + T1;
-        d = c; c = b; b = a;
-        a = T1 + T2;
+        SHA256_ROUND(K[i] + w[i]);
     }
 
-    // Final state
     output[0] = a + midstate[0];
     output[1] = b + midstate[1];
     output[2] = c + midstate[2];
@@ -63,14 +85,59 @@ inline void sha256_compress(const threadgroup uint* K,
     output[7] = h + midstate[7];
 }
 
+// Second hash over the first digest, specialised for its fixed padding and IV.
+// Schedule terms that only read padding are constants; zero words are dropped.
+// Only H7 (the hash's most significant limb, byte-swapped) is needed, and it is
+// final after round 60: e + IV[7], since h takes e's value three rounds later.
+inline uint sha256d_second_h7(const threadgroup uint* K, thread uint *w)
+{
+    w[16] = ssig0(w[1]) + w[0];
+    w[17] = ssig0(w[2]) + w[1] + ssig1(256);
+    w[18] = ssig1(w[16]) + ssig0(w[3]) + w[2];
+    w[19] = ssig1(w[17]) + ssig0(w[4]) + w[3];
+    w[20] = ssig1(w[18]) + ssig0(w[5]) + w[4];
+    w[21] = ssig1(w[19]) + ssig0(w[6]) + w[5];
+    w[22] = ssig1(w[20]) + ssig0(w[7]) + w[6] + 256;
+    w[23] = ssig1(w[21]) + w[16] + w[7] + ssig0(0x80000000);
+    w[24] = ssig1(w[22]) + w[17] + 0x80000000;
+    for (uint i = 25; i < 30; i++) w[i] = ssig1(w[i-2]) + w[i-7];
+    w[30] = ssig1(w[28]) + w[23] + ssig0(256);
+    w[31] = ssig1(w[29]) + w[24] + ssig0(w[16]) + 256;
+    #pragma unroll
+    for (uint i = 32; i < 61; i++) {
+        w[i] = ssig1(w[i-2]) + w[i-7] + ssig0(w[i-15]) + w[i-16];
+    }
+
+    uint a = R0_A + w[0], b = IV[0], c = IV[1], d = IV[2];
+    uint e = R0_E + w[0], f = IV[4], g = IV[5], h = IV[6];
+
+    #pragma unroll
+    for (uint i = 1; i < 8; i++) SHA256_ROUND(K[i] + w[i]);
+    #pragma unroll
+    for (uint i = 8; i < 16; i++) SHA256_ROUND(KW_PAD[i - 8]);
+    #pragma unroll
+    for (uint i = 16; i < 61; i++) SHA256_ROUND(K[i] + w[i]);
+
+    return e + IV[7];
+}
+
+// `result` is a GpuResult (gpu_job.hpp), indexed by word
+constant constexpr uint RESULT_HASH_COUNT = 0;
+constant constexpr uint RESULT_BEST_LIMB = 1;
+constant constexpr uint RESULT_BEST_NONCE = 2;
+constant constexpr uint RESULT_CANDIDATE_COUNT = 3;
+constant constexpr uint RESULT_CANDIDATES = 4;
+
 kernel void mineKernel(const constant uint* midstate,
-                       const constant uint* blockTail32,   // changed from uint8_t*
-                       const constant uint8_t* targetBytes,
-                       device atomic_uint* outputNonce,
-                       device uint4* resultHashes,
+                       const constant uint* blockTail32,   // W0..W2, big-endian message words
+                       const constant uint* targetLimbs,   // most significant limb first
+                       device atomic_uint* result,         // reset by the host before each range
+                       constant uint& candidateCapacity,
                        constant uint& nonceBase,
+                       constant uint& nonceCount,         // the grid may run past it to fill a group
                        uint thread_id [[thread_position_in_grid]],
                        uint tid_in_threadgroup [[thread_index_in_threadgroup]],
+                       uint threads_per_group [[threads_per_threadgroup]],
                        threadgroup uint* sharedK)  // shared[0..63] for K + [64..67] for tail
 {
     threadgroup uint* sharedTail = sharedK + 64;
@@ -99,37 +166,39 @@ kernel void mineKernel(const constant uint* midstate,
         sharedK[tid_in_threadgroup] = k[tid_in_threadgroup];
     }
 
-    // Load tail32 and targetBytes into threadgroup memory (only 1st 8 threads)
-    if (tid_in_threadgroup < 4) {
+    // Load tail32 and target limbs into threadgroup memory (only 1st 8 threads)
+    if (tid_in_threadgroup < 3) {
         sharedTail[tid_in_threadgroup] = blockTail32[tid_in_threadgroup];
     }
 
     if (tid_in_threadgroup < 8) {
-        sharedTarget[tid_in_threadgroup] = ((uint)targetBytes[tid_in_threadgroup * 4 + 0] << 24) |
-                                           ((uint)targetBytes[tid_in_threadgroup * 4 + 1] << 16) |
-                                           ((uint)targetBytes[tid_in_threadgroup * 4 + 2] << 8) |
-                                           ((uint)targetBytes[tid_in_threadgroup * 4 + 3]);
+        sharedTarget[tid_in_threadgroup] = targetLimbs[tid_in_threadgroup];
     }
 
     threadgroup_barrier(mem_flags::mem_threadgroup);
 
-    // Launch compression
-    uint nonce = nonceBase + thread_id;
-    uint hash[8];
-    sha256_compress(sharedK, sharedTail, midstate, nonce, hash);
-
-    // Write hash
-    resultHashes[thread_id * 2 + 0] = uint4(hash[0], hash[1], hash[2], hash[3]);
-    resultHashes[thread_id * 2 + 1] = uint4(hash[4], hash[5], hash[6], hash[7]);
-
-    // Target check
-    bool isValid = true;
-    for (int i = 0; i < 8; i++) {
-        if (hash[i] > sharedTarget[i]) { isValid = false; break; }
-        if (hash[i] < sharedTarget[i]) break;
-    }
+    // Only threads inside the range hash; the rest just helped load the group's tables
+    uint group_start = thread_id - tid_in_threadgroup;
+    if (tid_in_threadgroup == 0 && group_start < nonceCount)
+        atomic_fetch_add_explicit(&result[RESULT_HASH_COUNT], min(threads_per_group, nonceCount - group_start),
+                                  memory_order_relaxed);
+    if (thread_id >= nonceCount) return;
 
-    if (isValid) {
-        atomic_exchange_explicit(outputNonce, nonce, memory_order_relaxed);
+    // Double SHA-256; the header stores the nonce little-endian
+    uint nonce = nonceBase + thread_id;
+    uint w[64];
+    sha256_first(sharedK, sharedTail, midstate, bswap32(nonce), w);
+    uint limb = bswap32(sha256d_second_h7(sharedK, w));
+
+    // bestLimb only falls, so a stale read is never too low: most threads skip the atomic
+    if (limb < atomic_load_explicit(&result[RESULT_BEST_LIMB], memory_order_relaxed) &&
+        limb < atomic_fetch_min_explicit(&result[RESULT_BEST_LIMB], limb, memory_order_relaxed))
+        atomic_store_explicit(&result[RESULT_BEST_NONCE], nonce, memory_order_relaxed);
+
+    // Candidates meet the target's top limb; the host confirms them in full
+    if (limb <= sharedTarget[0]) {
+        uint slot = atomic_fetch_add_explicit(&result[RESULT_CANDIDATE_COUNT], 1, memory_order_relaxed);
+        if (slot < candidateCapacity)
+            atomic_store_explicit(&result[RESULT_CANDIDATES + slot], nonce, memory_order_relaxed);
     }
 }
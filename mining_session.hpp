@@ -0,0 +1,84 @@
+#ifndef MINING_SESSION_HPP
+#define MINING_SESSION_HPP
+
+#include "block.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct GpuJob;
+
+// What one nonce range produced
+struct MiningResult {
+    bool found = false;
+    uint32_t nonce = 0;          // the lowest confirmed nonce, when found
+    std::vector<uint8_t> hash;   // its hash, or a sample hash; display byte order
+    uint64_t hashesTried = 0;    // nonces scanned, starting at the range's base
+    uint64_t epoch = 0;          // job epoch it was mined under; NonceScheduler stamps it
+};
+
+// A mining backend that sets up once (device, pipeline, buffers, worker threads)
+// and then takes jobs and nonce ranges. setJob does the per-job host work and
+// loadJob the uploads; mine only launches and collects, so short ranges stay cheap
+// and a job prepared ahead (JobFactory) costs one loadJob. Sessions are used from
+// one thread at a time.
+//
+// submit/collect are the pipelined form of mine: up to pipelineDepth() ranges can
+// be in flight, so the device starts the next range while the host finishes the
+// last. GPU backends override all three; the defaults run mine() inside collect(),
+// for backends (the CPU pool) whose host work would only compete with hashing.
+// Backends: makeCpuSession (cpu_miner.hpp), makeMetalSession, makeOpenCLSession,
+// makeVulkanSession. Their constructors throw std::runtime_error if setup fails.
+class MiningSession {
+public:
+    virtual ~MiningSession() = default;
+
+    // One line for the startup log, e.g. "cpu (8 threads, avx2 kernel)"
+    virtual std::string describe() const = 0;
+
+    // Replaces the current job; target is 32 bytes, little-endian. Prepares it with
+    // makeGpuJob and loads it.
+    void setJob(const BlockHeader& header, const std::vector<uint8_t>& target);
+
+    // Replaces the current job with one already prepared
+    virtual void loadJob(const GpuJob& job) = 0;
+
+    // Lets a range stop early once *current moves past jobEpoch (null: never),
+    // with hashesTried counting only the nonces really hashed. By default ranges
+    // run out; GPU kernels can't be stopped, so their stale results are dropped.
+    virtual void watchEpoch(const std::atomic<uint64_t>* current, uint64_t jobEpoch) {
+        (void)current;
+        (void)jobEpoch;
+    }
+
+    // Scans `count` nonces from nonceBase (wrapping at 2^32) for the current job;
+    // never past them. A backend may come up short (Vulkan caps a dispatch at the
+    // device's work-group limit): hashesTried < count then means only the first
+    // hashesTried nonces were scanned, and NonceScheduler queues the rest again.
+    // The exception is a range cut short by a new job epoch (watchEpoch), which
+    // is stale and not resumed.
+    virtual MiningResult mine(uint32_t nonceBase, uint32_t count) = 0;
+
+    // Ranges submit() accepts before a collect() is needed
+    virtual size_t pipelineDepth() const { return 1; }
+
+    // Starts a range for the current job and returns without waiting for it
+    virtual void submit(uint32_t nonceBase, uint32_t count) { queued.emplace_back(nonceBase, count); }
+
+    // Waits for the oldest submitted range and returns its result. Collect every
+    // range before the next setJob or loadJob.
+    virtual MiningResult collect() {
+        std::pair<uint32_t, uint32_t> range = queued.front();
+        queued.pop_front();
+        return mine(range.first, range.second);
+    }
+
+private:
+    std::deque<std::pair<uint32_t, uint32_t>> queued;   // for the default submit/collect
+};
+
+#endif // MINING_SESSION_HPP
@@ -0,0 +1,94 @@
+#include "nonce_scan.hpp"
+#include "sha256_compress.hpp"
+#include "sha256_simd.hpp"
+#include <stdexcept>
+
+static uint32_t readBE32(const uint8_t* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) |
+           (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+static void writeBE32(uint8_t* p, uint32_t v) {
+    p[0] = (v >> 24) & 0xff;
+    p[1] = (v >> 16) & 0xff;
+    p[2] = (v >> 8) & 0xff;
+    p[3] = v & 0xff;
+}
+
+ScanJob makeScanJob(const std::array<uint32_t, 8>& midstate,
+                    const std::vector<uint8_t>& tail,
+                    const std::vector<uint8_t>& target) {
+    if (tail.size() < 12) throw std::runtime_error("Header tail must be at least 12 bytes");
+    if (target.size() != 32) throw std::runtime_error("Target must be exactly 32 bytes");
+
+    ScanJob job;
+    job.midstate = midstate;
+    for (int i = 0; i < 3; ++i)
+        job.tail[i] = readBE32(&tail[i * 4]);
+
+    // Little-endian target: most significant limb lives in bytes 28..31
+    for (int i = 0; i < 8; ++i) {
+        const uint8_t* p = &target[28 - i * 4];
+        job.target[i] = uint32_t(p[0]) | (uint32_t(p[1]) << 8) |
+                        (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    job.prepared = prepareTail(job.midstate, job.tail);
+    return job;
+}
+
+// First SHA-256: the second header block (tail, nonce, padding, 640-bit length) on the midstate
+static std::array<uint32_t, 8> firstHash(const ScanJob& job, uint32_t nonce) {
+    uint8_t block[64] = {0};
+    for (int i = 0; i < 3; ++i)
+        writeBE32(&block[i * 4], job.tail[i]);
+    writeBE32(&block[12], nonceToWord(nonce));
+    block[16] = 0x80;
+    writeBE32(&block[60], 640);
+
+    std::array<uint32_t, 8> first = job.midstate;
+    sha256_compress(block, first);
+    return first;
+}
+
+void hashHeaderNonce(const ScanJob& job, uint32_t nonce, std::array<uint32_t, 8>& hashOut) {
+    std::array<uint32_t, 8> first = firstHash(job, nonce);
+
+    // Second hash over the 32-byte digest, padding and IV folded in
+    uint32_t w[64];
+    for (int i = 0; i < 8; ++i) w[i] = first[i];
+    sha256d_second_lanes<uint32_t>(w, hashOut.data());
+}
+
+void appendHit(std::vector<uint32_t>& hits, uint32_t nonce) {
+    hits.push_back(nonce);
+}
+
+bool confirmNonce(const ScanJob& job, uint32_t nonce) {
+    std::array<uint32_t, 8> hash;
+    hashHeaderNonce(job, nonce, hash);
+    return meetsTarget(hash, job.target);
+}
+
+uint64_t scanNoncesScalar(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                          std::vector<uint32_t>& hits) {
+    if (earlyExitApplies(job)) {
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t nonce = nonceStart + i;
+            uint32_t w[64];
+            sha256_first_prepared<uint32_t>(job.prepared, nonceToWord(nonce), w);
+            if (sha256d_h7_lanes<uint32_t>(w) == 0 && confirmNonce(job, nonce))
+                hits.push_back(nonce);
+        }
+        return count;
+    }
+
+    std::array<uint32_t, 8> hash;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t nonce = nonceStart + i;
+        hashHeaderNonce(job, nonce, hash);
+        if (meetsTarget(hash, job.target))
+            hits.push_back(nonce);
+    }
+    return count;
+}
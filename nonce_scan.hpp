@@ -0,0 +1,61 @@
+#ifndef NONCE_SCAN_HPP
+#define NONCE_SCAN_HPP
+
+#include "midstate_utils.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Per-job input shared by every CPU nonce scan kernel.
+// All words are in SHA-256 message order (big-endian).
+struct ScanJob {
+    std::array<uint32_t, 8> midstate;   // compression state after header bytes 0..63
+    std::array<uint32_t, 3> tail;       // header bytes 64..75 (merkle root tail, time, bits)
+    std::array<uint32_t, 8> target;     // target limbs, most significant first
+    PreparedTail prepared;              // nonce-invariant rounds and schedule terms
+};
+
+// Build a ScanJob from the midstate, the 16-byte header tail and a
+// little-endian 32-byte target (as produced by copyHashLE in main.cpp)
+ScanJob makeScanJob(const std::array<uint32_t, 8>& midstate,
+                    const std::vector<uint8_t>& tail,
+                    const std::vector<uint8_t>& target);
+
+// Header bytes 76..79 hold the nonce little-endian; the message word is big-endian
+inline uint32_t nonceToWord(uint32_t nonce) {
+    return __builtin_bswap32(nonce);
+}
+
+// Full double SHA-256 of the header carrying `nonce`; writes the final state words
+void hashHeaderNonce(const ScanJob& job, uint32_t nonce, std::array<uint32_t, 8>& hashOut);
+
+// True if the double SHA-256 state, read as Bitcoin's little-endian number, is <= target
+inline bool meetsTarget(const std::array<uint32_t, 8>& hash, const std::array<uint32_t, 8>& target) {
+    for (int i = 0; i < 8; ++i) {
+        uint32_t limb = __builtin_bswap32(hash[7 - i]);
+        if (limb < target[i]) return true;
+        if (limb > target[i]) return false;
+    }
+    return true;
+}
+
+// When the top target limb is zero only hashes with H7 == 0 can qualify, so a
+// kernel may stop the second SHA-256 after round 60 (which fixes H7) and reject
+// on that word alone. Survivors are finished with confirmNonce.
+inline bool earlyExitApplies(const ScanJob& job) {
+    return job.target[0] == 0;
+}
+
+// Record a hit. Out of line so kernels built with wider ISA flags never emit their
+// own copy of the vector growth path, which the linker could then pick for every caller.
+void appendHit(std::vector<uint32_t>& hits, uint32_t nonce);
+
+// Full double SHA-256 and target compare for a nonce that passed an early check
+bool confirmNonce(const ScanJob& job, uint32_t nonce);
+
+// Scan nonces [nonceStart, nonceStart + count) one at a time with sha256_compress.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+uint64_t scanNoncesScalar(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                          std::vector<uint32_t>& hits);
+
+#endif // NONCE_SCAN_HPP
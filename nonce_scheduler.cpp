@@ -0,0 +1,225 @@
+#include "nonce_scheduler.hpp"
+#include "gpu_job.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+static const uint64_t nonceSpace = uint64_t(1) << 32;
+
+// Weight of the newest rate sample; smooths over launch jitter and stolen tails
+static const double rateSmoothing = 0.25;
+
+NonceScheduler::NonceScheduler(std::vector<std::unique_ptr<MiningSession>> sessions, uint32_t chunkSize,
+                               std::chrono::microseconds batchTarget)
+    : chunkSize(chunkSize), batchTarget(batchTarget) {
+    if (sessions.empty()) throw std::runtime_error("NonceScheduler needs at least one mining session");
+    if (chunkSize == 0) throw std::runtime_error("NonceScheduler chunk size must be positive");
+    if (batchTarget.count() < 0) throw std::runtime_error("NonceScheduler batch target must not be negative");
+    for (std::unique_ptr<MiningSession>& session : sessions) {
+        workers.push_back(std::make_unique<Worker>());
+        workers.back()->session = std::move(session);
+    }
+}
+
+// Chunks the worker's rate covers in the batch target; one until it has a rate.
+// Capped so a batch stays well inside a uint32 count.
+uint64_t NonceScheduler::batchChunks(const Worker& worker) const {
+    if (batchTarget.count() == 0 || worker.rate <= 0) return 1;
+    double chunks = worker.rate * std::chrono::duration<double>(batchTarget).count() / chunkSize;
+    uint64_t most = std::max<uint64_t>(1, (uint64_t(1) << 31) / chunkSize);
+    return std::clamp<uint64_t>((uint64_t)(chunks + 0.5), 1, most);
+}
+
+// Up to `wanted` chunks from the front of the worker's own share, else from the
+// back of the largest other share, taking at most half of it so the owner keeps
+// going too. Shares only shrink at their ends, so every batch is contiguous.
+bool NonceScheduler::takeBatch(size_t self, uint64_t wanted, uint64_t& first, uint64_t& count) {
+    {
+        Worker& own = *workers[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.begin < own.end) {
+            first = own.begin;
+            count = std::min(wanted, own.end - own.begin);
+            own.begin += count;
+            return true;
+        }
+    }
+
+    for (;;) {
+        size_t victim = self;
+        uint64_t most = 0;
+        for (size_t i = 0; i < workers.size(); ++i) {
+            if (i == self) continue;
+            std::lock_guard<std::mutex> lock(workers[i]->mutex);
+            if (workers[i]->end - workers[i]->begin > most) {
+                most = workers[i]->end - workers[i]->begin;
+                victim = i;
+            }
+        }
+        if (victim == self) return false;
+
+        // The victim may have drained since it was sized up; look again if so
+        Worker& other = *workers[victim];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (other.begin < other.end) {
+            count = std::min(wanted, (other.end - other.begin + 1) / 2);
+            other.end -= count;
+            first = other.end;
+            return true;
+        }
+    }
+}
+
+MiningResult NonceScheduler::mineJob(const BlockHeader& header, const std::vector<uint8_t>& target,
+                                     const std::atomic<bool>& stop, const ChunkFn& onChunk) {
+    const std::atomic<uint64_t> epoch{0};
+    return mineJob(makeGpuJob(header, target), 0, epoch, stop, onChunk);
+}
+
+MiningResult NonceScheduler::mineJob(const GpuJob& job, uint64_t jobEpoch, const std::atomic<uint64_t>& currentEpoch,
+                                     const std::atomic<bool>& stop, const ChunkFn& onChunk) {
+    // Contiguous shares keep each device walking nonces in order until it steals
+    uint64_t chunkCount = (nonceSpace + chunkSize - 1) / chunkSize;
+    for (size_t i = 0; i < workers.size(); ++i) {
+        Worker& worker = *workers[i];
+        worker.session->loadJob(job);
+        worker.session->watchEpoch(&currentEpoch, jobEpoch);
+        worker.begin = chunkCount * i / workers.size();
+        worker.end = chunkCount * (i + 1) / workers.size();
+    }
+
+    std::atomic<bool> done{false};
+    std::mutex queueMutex;
+    std::condition_variable ready;
+    std::deque<Completion> completions;   // guarded by queueMutex
+    size_t running = workers.size();      // guarded by queueMutex
+    std::exception_ptr error;             // guarded by queueMutex
+
+    // Producer stage: keep the session's pipeline full, collect the oldest batch and
+    // queue it for the consumer. Nothing here waits on host bookkeeping.
+    auto run = [&](size_t self) {
+        typedef std::chrono::steady_clock Clock;
+        Worker& worker = *workers[self];
+        MiningSession& session = *worker.session;
+        std::deque<std::pair<uint64_t, uint64_t>> inFlight;   // nonce ranges (base, count), oldest first
+        std::deque<std::pair<uint64_t, uint64_t>> shortfall;  // tails a session left unscanned
+        Clock::time_point lastCollect = Clock::now();
+        try {
+            for (;;) {
+                uint64_t first, count;
+                while (inFlight.size() < session.pipelineDepth() && !done.load(std::memory_order_relaxed) &&
+                       !stop.load(std::memory_order_acquire) &&
+                       currentEpoch.load(std::memory_order_acquire) == jobEpoch) {
+                    // A short range's tail goes first, so nothing is left behind
+                    std::pair<uint64_t, uint64_t> range;
+                    if (!shortfall.empty()) {
+                        range = shortfall.front();
+                        shortfall.pop_front();
+                    } else if (takeBatch(self, batchChunks(worker), first, count)) {
+                        range.first = first * chunkSize;
+                        range.second = std::min(count * chunkSize, nonceSpace - range.first);
+                    } else {
+                        break;
+                    }
+                    session.submit((uint32_t)range.first, (uint32_t)range.second);
+                    inFlight.push_back(range);
+                }
+                if (inFlight.empty()) break;
+
+                std::pair<uint64_t, uint64_t> range = inFlight.front();
+                Completion completion{self, (uint32_t)range.first, session.collect()};
+                inFlight.pop_front();
+                completion.result.epoch = jobEpoch;
+
+                // A session may scan only a prefix of a live range; the rest is queued
+                // again. Ranges cut short by a new epoch are stale and dropped.
+                uint64_t tried = completion.result.hashesTried;
+                if (tried < range.second && !completion.result.found &&
+                    currentEpoch.load(std::memory_order_acquire) == jobEpoch) {
+                    if (tried == 0) throw std::runtime_error("NonceScheduler: " + session.describe() +
+                                                             " scanned none of a range");
+                    shortfall.emplace_back(range.first + tried, range.second - tried);
+                }
+
+                // With the pipeline kept full, the gap between collects is the device
+                // time of the batch just collected
+                Clock::time_point now = Clock::now();
+                double seconds = std::chrono::duration<double>(now - lastCollect).count();
+                lastCollect = now;
+                if (seconds > 0 && completion.result.hashesTried) {
+                    double sample = completion.result.hashesTried / seconds;
+                    worker.rate = worker.rate > 0 ? worker.rate + rateSmoothing * (sample - worker.rate) : sample;
+                }
+                if (completion.result.found && currentEpoch.load(std::memory_order_acquire) == jobEpoch)
+                    done.store(true, std::memory_order_relaxed);
+                std::lock_guard<std::mutex> lock(queueMutex);
+                completions.push_back(std::move(completion));
+                ready.notify_one();
+            }
+        } catch (...) {
+            std::exception_ptr failure = std::current_exception();
+            done.store(true, std::memory_order_relaxed);
+            // Drain what the device still holds so the session can take the next job
+            for (; !inFlight.empty(); inFlight.pop_front()) {
+                try {
+                    session.collect();
+                } catch (...) {
+                }
+            }
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (!error) error = failure;
+        }
+        std::lock_guard<std::mutex> lock(queueMutex);
+        --running;
+        ready.notify_one();
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < workers.size(); ++i) threads.emplace_back(run, i);
+
+    // Consumer stage, on the calling thread: stats, callbacks and the outcome
+    MiningResult outcome;
+    uint64_t hashesTried = 0;
+    std::unique_lock<std::mutex> lock(queueMutex);
+    for (;;) {
+        ready.wait(lock, [&] { return !completions.empty() || running == 0; });
+        if (completions.empty()) break;
+        Completion completion = std::move(completions.front());
+        completions.pop_front();
+        lock.unlock();
+
+        const MiningResult& result = completion.result;
+        hashesTried += result.hashesTried;
+        try {
+            if (onChunk) onChunk(completion.worker, completion.nonceBase, result);
+        } catch (...) {
+            // Stop the producers but keep draining, so every thread can be joined
+            done.store(true, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> errorLock(queueMutex);
+            if (!error) error = std::current_exception();
+        }
+        // Work from a dead epoch is counted but can't win
+        if (!outcome.found && currentEpoch.load(std::memory_order_acquire) == jobEpoch) {
+            outcome.hash = result.hash;
+            if (result.found) {
+                outcome.found = true;
+                outcome.nonce = result.nonce;
+            }
+        }
+        lock.lock();
+    }
+    lock.unlock();
+
+    for (std::thread& t : threads) t.join();
+    // The sessions outlive this call; the epoch they watched may not
+    for (std::unique_ptr<Worker>& worker : workers) worker->session->watchEpoch(nullptr, 0);
+    if (error) std::rethrow_exception(error);
+
+    outcome.hashesTried = hashesTried;
+    outcome.epoch = jobEpoch;
+    return outcome;
+}
@@ -0,0 +1,84 @@
+#ifndef NONCE_SCHEDULER_HPP
+#define NONCE_SCHEDULER_HPP
+
+#include "mining_session.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Mines one job's 2^32 nonces on several MiningSessions at once (CPU pools, GPUs),
+// one host thread per session. The nonce space is cut into fixed-size chunks and
+// each worker starts with a contiguous share of them. It takes batches from the
+// front of its share; once empty it steals from the back of the largest other
+// share, so fast devices keep going while slow ones still hold work and all
+// finish together.
+//
+// A batch is a run of contiguous chunks sized per worker by a feedback loop: each
+// collect updates the worker's smoothed hash rate, and the next batch is as many
+// chunks as that rate covers in the batch target. Fast and slow devices thus all
+// see batches of about the same duration, bounding how long a job switch waits.
+// A session that scans only a prefix of a batch (MiningSession::mine) gets the
+// rest back as its next batch.
+//
+// Each worker thread keeps its session's pipeline full (MiningSession::submit /
+// collect) and hands finished batches to a consumer stage on the calling thread,
+// which does the stats and callbacks; a device never waits on that host work.
+class NonceScheduler {
+public:
+    // Called after each batch, on the thread that called mineJob, in the order
+    // batches completed; it may update shared stats without locking, and time
+    // spent in it does not hold up the devices
+    typedef std::function<void(size_t worker, uint32_t nonceBase, const MiningResult& result)> ChunkFn;
+
+    // chunkSize is the smallest batch. A zero batchTarget turns the feedback off
+    // and every batch is one chunk.
+    NonceScheduler(std::vector<std::unique_ptr<MiningSession>> sessions, uint32_t chunkSize,
+                   std::chrono::microseconds batchTarget = std::chrono::microseconds(0));
+
+    size_t workerCount() const { return workers.size(); }
+    const MiningSession& session(size_t worker) const { return *workers[worker]->session; }
+
+    // Mines the job until a worker finds a nonce, every chunk is done, or `stop`
+    // is set; workers finish the batches in flight first. Returns the found nonce and
+    // hash, or else the last sample, with hashesTried summed over all workers.
+    // Rethrows the first exception a worker hit, after stopping the others.
+    MiningResult mineJob(const BlockHeader& header, const std::vector<uint8_t>& target,
+                         const std::atomic<bool>& stop, const ChunkFn& onChunk);
+
+    // The same for a job prepared ahead (e.g. by a JobFactory) under job epoch
+    // jobEpoch. Once currentEpoch moves on, workers submit nothing more and the
+    // CPU sessions cut their batches short; what is still in flight is collected,
+    // stamped with jobEpoch, counted and passed to onChunk, but never found.
+    MiningResult mineJob(const GpuJob& job, uint64_t jobEpoch, const std::atomic<uint64_t>& currentEpoch,
+                         const std::atomic<bool>& stop, const ChunkFn& onChunk);
+
+private:
+    struct Worker {
+        std::unique_ptr<MiningSession> session;
+        std::mutex mutex;             // guards begin and end; owner and thieves both lock it
+        uint64_t begin = 0, end = 0;  // chunk indices still to take, [begin, end)
+        double rate = 0;              // nonces per second, smoothed; kept across jobs
+    };
+
+    // A collected batch on its way to the consumer stage
+    struct Completion {
+        size_t worker;
+        uint32_t nonceBase;
+        MiningResult result;
+    };
+
+    uint64_t batchChunks(const Worker& worker) const;
+    bool takeBatch(size_t self, uint64_t wanted, uint64_t& first, uint64_t& count);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    uint32_t chunkSize;
+    std::chrono::microseconds batchTarget;
+};
+
+#endif // NONCE_SCHEDULER_HPP
@@ -0,0 +1,230 @@
+#include "opencl_miner.hpp"
+#include "gpu_job.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#define CL_TARGET_OPENCL_VERSION 120
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+static void check(cl_int err, const char* what) {
+    if (err != CL_SUCCESS)
+        throw std::runtime_error(std::string("OpenCL: ") + what + " failed (error " + std::to_string(err) + ")");
+}
+
+static std::string readKernelSource() {
+    const char* path = std::getenv("MINER_OPENCL_KERNEL");
+    if (!path) path = "mineKernel.cl";
+    std::ifstream file(path);
+    if (!file) throw std::runtime_error(std::string("OpenCL: cannot open kernel source ") + path);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+static cl_device_id pickDevice() {
+    cl_uint platformCount = 0;
+    if (clGetPlatformIDs(0, nullptr, &platformCount) != CL_SUCCESS || platformCount == 0)
+        throw std::runtime_error("OpenCL: no platforms found");
+    std::vector<cl_platform_id> platforms(platformCount);
+    check(clGetPlatformIDs(platformCount, platforms.data(), nullptr), "clGetPlatformIDs");
+
+    std::vector<cl_device_id> devices;
+    cl_device_id firstGpu = nullptr;
+    for (cl_platform_id platform : platforms) {
+        cl_uint count = 0;
+        if (clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 0, nullptr, &count) != CL_SUCCESS || count == 0)
+            continue;
+        std::vector<cl_device_id> found(count);
+        check(clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, count, found.data(), nullptr), "clGetDeviceIDs");
+        for (cl_device_id device : found) {
+            cl_device_type type = 0;
+            clGetDeviceInfo(device, CL_DEVICE_TYPE, sizeof(type), &type, nullptr);
+            if (!firstGpu && (type & CL_DEVICE_TYPE_GPU)) firstGpu = device;
+            devices.push_back(device);
+        }
+    }
+    if (devices.empty()) throw std::runtime_error("OpenCL: no devices found");
+
+    if (const char* forced = std::getenv("MINER_OPENCL_DEVICE")) {
+        size_t index = std::strtoul(forced, nullptr, 10);
+        if (index >= devices.size())
+            throw std::runtime_error("OpenCL: MINER_OPENCL_DEVICE=" + std::string(forced) + " but only " +
+                                     std::to_string(devices.size()) + " devices exist");
+        return devices[index];
+    }
+    return firstGpu ? firstGpu : devices[0];
+}
+
+// Device, compiled kernel and buffers, created once and reused by every range
+class OpenCLSession : public MiningSession {
+public:
+    OpenCLSession() {
+        try {
+            setup();
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    ~OpenCLSession() override { release(); }
+
+    OpenCLSession(const OpenCLSession&) = delete;
+    OpenCLSession& operator=(const OpenCLSession&) = delete;
+
+    std::string describe() const override { return "opencl (" + deviceName + ")"; }
+
+    void loadJob(const GpuJob& prepared) override {
+        if (inFlight) throw std::runtime_error("OpenCL: loadJob with ranges still in flight");
+        job = prepared;
+        // The uploads read from `job`, so they must land before it can change again
+        check(clEnqueueWriteBuffer(queue, midstateBuf, CL_FALSE, 0, sizeof(job.midstate), job.midstate,
+                                   0, nullptr, nullptr), "upload midstate");
+        check(clEnqueueWriteBuffer(queue, tailBuf, CL_FALSE, 0, sizeof(job.tail32), job.tail32,
+                                   0, nullptr, nullptr), "upload tail");
+        check(clEnqueueWriteBuffer(queue, targetBuf, CL_FALSE, 0, sizeof(job.target32), job.target32,
+                                   0, nullptr, nullptr), "upload target");
+        check(clFinish(queue), "clFinish");
+    }
+
+    MiningResult mine(uint32_t nonceBase, uint32_t count) override {
+        submit(nonceBase, count);
+        return collect();
+    }
+
+    size_t pipelineDepth() const override { return gpuPipelineDepth; }
+
+    void submit(uint32_t nonceBase, uint32_t count) override {
+        if (inFlight == gpuPipelineDepth) throw std::runtime_error("OpenCL: submit with the pipeline full");
+        Slot& slot = slots[(next + inFlight) % gpuPipelineDepth];
+
+        // In-order queue: the reset lands before the kernel and the read after it.
+        // Kernel arguments are captured at enqueue, so slots can share the kernel.
+        resetGpuResult(slot.result, nonceBase);
+        check(clEnqueueWriteBuffer(queue, slot.buffer, CL_FALSE, 0, resultHeaderSize, &slot.result,
+                                   0, nullptr, nullptr), "reset result");
+        check(clSetKernelArg(kernel, 3, sizeof(cl_mem), &slot.buffer), "clSetKernelArg(3)");
+        check(clSetKernelArg(kernel, 5, sizeof(cl_uint), &nonceBase), "clSetKernelArg(5)");
+        size_t globalSize = count;
+        check(clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &globalSize, nullptr,
+                                     0, nullptr, nullptr), "clEnqueueNDRangeKernel");
+        check(clEnqueueReadBuffer(queue, slot.buffer, CL_FALSE, 0, resultHeaderSize, &slot.result,
+                                  0, nullptr, &slot.done), "read result");
+        check(clFlush(queue), "clFlush");
+        ++inFlight;
+    }
+
+    MiningResult collect() override {
+        if (inFlight == 0) throw std::runtime_error("OpenCL: collect with nothing submitted");
+        Slot& slot = slots[next];
+        next = (next + 1) % gpuPipelineDepth;
+        --inFlight;
+
+        cl_int err = clWaitForEvents(1, &slot.done);
+        clReleaseEvent(slot.done);
+        slot.done = nullptr;
+        check(err, "wait for range");
+        // Only as many candidates as were written; rarely any
+        uint32_t candidates = std::min(slot.result.candidateCount, gpuCandidateCapacity);
+        if (candidates)
+            check(clEnqueueReadBuffer(queue, slot.buffer, CL_TRUE, resultHeaderSize, sizeof(uint32_t) * candidates,
+                                      slot.result.candidates, 0, nullptr, nullptr), "read candidates");
+        return finishGpuResult(job, slot.result);
+    }
+
+private:
+    // One in-flight range: its result buffer, the host copy the reset is written
+    // from and the header read back into, and the event that read signals
+    struct Slot {
+        cl_mem buffer = nullptr;
+        cl_event done = nullptr;
+        GpuResult result{};
+    };
+
+    cl_context context = nullptr;
+    cl_command_queue queue = nullptr;
+    cl_program program = nullptr;
+    cl_kernel kernel = nullptr;
+    cl_mem midstateBuf = nullptr;
+    cl_mem tailBuf = nullptr;
+    cl_mem targetBuf = nullptr;
+    std::string deviceName;
+    GpuJob job{};
+    Slot slots[gpuPipelineDepth];
+    size_t next = 0;       // oldest in-flight slot
+    size_t inFlight = 0;
+
+    static constexpr size_t resultHeaderSize = offsetof(GpuResult, candidates);
+
+    void setup() {
+        cl_device_id device = pickDevice();
+        char name[256] = {};
+        clGetDeviceInfo(device, CL_DEVICE_NAME, sizeof(name) - 1, name, nullptr);
+        deviceName = name;
+
+        cl_int err;
+        context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+        check(err, "clCreateContext");
+        queue = clCreateCommandQueue(context, device, 0, &err);
+        check(err, "clCreateCommandQueue");
+
+        std::string source = readKernelSource();
+        const char* sourcePtr = source.c_str();
+        size_t sourceLength = source.size();
+        program = clCreateProgramWithSource(context, 1, &sourcePtr, &sourceLength, &err);
+        check(err, "clCreateProgramWithSource");
+        if (clBuildProgram(program, 1, &device, "-cl-std=CL1.2", nullptr, nullptr) != CL_SUCCESS) {
+            size_t logSize = 0;
+            clGetProgramBuildInfo(program, device, CL_PROGRAM_BUILD_LOG, 0, nullptr, &logSize);
+            std::string log(logSize, '\0');
+            clGetProgramBuildInfo(program, device, CL_PROGRAM_BUILD_LOG, logSize, &log[0], nullptr);
+            throw std::runtime_error("OpenCL: mineKernel.cl failed to build:\n" + log);
+        }
+        kernel = clCreateKernel(program, "mineKernel", &err);
+        check(err, "clCreateKernel");
+
+        midstateBuf = clCreateBuffer(context, CL_MEM_READ_ONLY, sizeof(uint32_t) * 8, nullptr, &err);
+        check(err, "clCreateBuffer(midstate)");
+        tailBuf = clCreateBuffer(context, CL_MEM_READ_ONLY, sizeof(uint32_t) * 4, nullptr, &err);
+        check(err, "clCreateBuffer(tail)");
+        targetBuf = clCreateBuffer(context, CL_MEM_READ_ONLY, sizeof(uint32_t) * 8, nullptr, &err);
+        check(err, "clCreateBuffer(target)");
+        for (Slot& slot : slots) {
+            slot.buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, sizeof(GpuResult), nullptr, &err);
+            check(err, "clCreateBuffer(result)");
+        }
+
+        // Everything but the result buffer and nonce base is bound once
+        check(clSetKernelArg(kernel, 0, sizeof(cl_mem), &midstateBuf), "clSetKernelArg(0)");
+        check(clSetKernelArg(kernel, 1, sizeof(cl_mem), &tailBuf), "clSetKernelArg(1)");
+        check(clSetKernelArg(kernel, 2, sizeof(cl_mem), &targetBuf), "clSetKernelArg(2)");
+        check(clSetKernelArg(kernel, 4, sizeof(cl_uint), &gpuCandidateCapacity), "clSetKernelArg(4)");
+    }
+
+    void release() {
+        if (queue) clFinish(queue);
+        for (Slot& slot : slots) {
+            if (slot.done) clReleaseEvent(slot.done);
+            if (slot.buffer) clReleaseMemObject(slot.buffer);
+        }
+        for (cl_mem buffer : {targetBuf, tailBuf, midstateBuf})
+            if (buffer) clReleaseMemObject(buffer);
+        if (kernel) clReleaseKernel(kernel);
+        if (program) clReleaseProgram(program);
+        if (queue) clReleaseCommandQueue(queue);
+        if (context) clReleaseContext(context);
+    }
+};
+
+std::unique_ptr<MiningSession> makeOpenCLSession() {
+    return std::make_unique<OpenCLSession>();
+}
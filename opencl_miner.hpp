@@ -0,0 +1,13 @@
+#ifndef OPENCL_MINER_HPP
+#define OPENCL_MINER_HPP
+
+#include "mining_session.hpp"
+#include <memory>
+
+// MiningSession on the first OpenCL GPU (or any OpenCL device, e.g. the POCL CPU
+// runtime); MINER_OPENCL_DEVICE picks a device by index across platforms. The
+// kernel source is read from mineKernel.cl, or MINER_OPENCL_KERNEL.
+// Throws std::runtime_error if OpenCL setup fails.
+std::unique_ptr<MiningSession> makeOpenCLSession();
+
+#endif // OPENCL_MINER_HPP
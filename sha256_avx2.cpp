@@ -0,0 +1,187 @@
+#include "sha256_avx2.hpp"
+#include "sha256_multibuffer.hpp"
+#include "sha256_simd.hpp"
+
+void sha256MidstatesAVX2(const uint8_t* prefixes, size_t count, std::array<uint32_t, 8>* out) {
+    sha256_midstates_lanes<LaneWord<8>>(prefixes, count, out);
+}
+
+void sha256dMultiBufferAVX2(const Sha256dJob* jobs, size_t count) {
+    sha256d_multibuffer_lanes<LaneWord<8>>(jobs, count);
+}
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+#define ADD(x,y) _mm256_add_epi32((x), (y))
+#define XOR(x,y) _mm256_xor_si256((x), (y))
+#define ROTR(x,n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32-(n)))
+#define SHR(x,n) _mm256_srli_epi32((x), (n))
+#define CH(x,y,z) XOR(_mm256_and_si256((x), (y)), _mm256_andnot_si256((x), (z)))
+#define MAJ(x,y,z) _mm256_or_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_or_si256((x), (y))))
+#define BSIG0(x) XOR(XOR(ROTR(x,2), ROTR(x,13)), ROTR(x,22))
+#define BSIG1(x) XOR(XOR(ROTR(x,6), ROTR(x,11)), ROTR(x,25))
+#define SSIG0(x) XOR(XOR(ROTR(x,7), ROTR(x,18)), SHR(x,3))
+#define SSIG1(x) XOR(XOR(ROTR(x,17), ROTR(x,19)), SHR(x,10))
+
+// First SHA-256 for the nonce words in w3, resuming from the job's prepared tail
+// at round 3. out[0..7] receive the digest words (the second hash's message).
+static inline void firstHashPrepared8(const PreparedTail& pt, __m256i w3, __m256i out[8]) {
+    __m256i w[64];
+    w[4] = _mm256_set1_epi32(0x80000000);
+    for (int i = 5; i < 15; i++) w[i] = _mm256_setzero_si256();
+    w[15] = _mm256_set1_epi32(640);
+    w[16] = _mm256_set1_epi32(pt.w16);
+    w[17] = _mm256_set1_epi32(pt.w17);
+    w[18] = ADD(_mm256_set1_epi32(pt.w18Base), SSIG0(w3));
+    w[19] = ADD(_mm256_set1_epi32(pt.w19Base), w3);
+    for (int i = 20; i < 64; i++) {
+        w[i] = ADD(ADD(SSIG1(w[i-2]), w[i-7]), ADD(SSIG0(w[i-15]), w[i-16]));
+    }
+
+    // Finish round 3 with the nonce word
+    __m256i a = ADD(_mm256_set1_epi32(pt.t1Base + pt.t2), w3);
+    __m256i b = _mm256_set1_epi32(pt.state[0]), c = _mm256_set1_epi32(pt.state[1]), d = _mm256_set1_epi32(pt.state[2]);
+    __m256i e = ADD(_mm256_set1_epi32(pt.state[3] + pt.t1Base), w3);
+    __m256i f = _mm256_set1_epi32(pt.state[4]), g = _mm256_set1_epi32(pt.state[5]), h = _mm256_set1_epi32(pt.state[6]);
+
+    for (int i = 4; i < 64; i++) {
+        __m256i T1 = ADD(ADD(h, BSIG1(e)), ADD(CH(e,f,g), ADD(_mm256_set1_epi32(sha256_k[i]), w[i])));
+        __m256i T2 = ADD(BSIG0(a), MAJ(a,b,c));
+        h = g;
+        g = f;
+        f = e;
+        e = ADD(d, T1);
+        d = c;
+        c = b;
+        b = a;
+        a = ADD(T1, T2);
+    }
+
+    out[0] = ADD(a, _mm256_set1_epi32(pt.midstate[0]));
+    out[1] = ADD(b, _mm256_set1_epi32(pt.midstate[1]));
+    out[2] = ADD(c, _mm256_set1_epi32(pt.midstate[2]));
+    out[3] = ADD(d, _mm256_set1_epi32(pt.midstate[3]));
+    out[4] = ADD(e, _mm256_set1_epi32(pt.midstate[4]));
+    out[5] = ADD(f, _mm256_set1_epi32(pt.midstate[5]));
+    out[6] = ADD(g, _mm256_set1_epi32(pt.midstate[6]));
+    out[7] = ADD(h, _mm256_set1_epi32(pt.midstate[7]));
+}
+
+// Second SHA-256 over the 32-byte first digest in w[0..7], specialised for its
+// fixed padding and IV (see sha256d_second_rounds in sha256_simd.hpp).
+// Runs rounds 0..Last and leaves a..h in s[0..7] without the feed-forward.
+template <int Last>
+static inline void secondHashRounds(__m256i w[64], __m256i s[8]) {
+    w[16] = ADD(SSIG0(w[1]), w[0]);
+    w[17] = ADD(ADD(SSIG0(w[2]), w[1]), _mm256_set1_epi32(sha256d_w17_const));
+    w[18] = ADD(SSIG1(w[16]), ADD(SSIG0(w[3]), w[2]));
+    w[19] = ADD(SSIG1(w[17]), ADD(SSIG0(w[4]), w[3]));
+    w[20] = ADD(SSIG1(w[18]), ADD(SSIG0(w[5]), w[4]));
+    w[21] = ADD(SSIG1(w[19]), ADD(SSIG0(w[6]), w[5]));
+    w[22] = ADD(ADD(SSIG1(w[20]), ADD(SSIG0(w[7]), w[6])), _mm256_set1_epi32(sha256d_pad_word(15)));
+    w[23] = ADD(ADD(SSIG1(w[21]), ADD(w[16], w[7])), _mm256_set1_epi32(sha256d_w23_const));
+    w[24] = ADD(ADD(SSIG1(w[22]), w[17]), _mm256_set1_epi32(sha256d_pad_word(8)));
+    for (int i = 25; i < 30; i++) w[i] = ADD(SSIG1(w[i-2]), w[i-7]);
+    w[30] = ADD(ADD(SSIG1(w[28]), w[23]), _mm256_set1_epi32(sha256d_w30_const));
+    w[31] = ADD(ADD(SSIG1(w[29]), w[24]), ADD(SSIG0(w[16]), _mm256_set1_epi32(sha256d_pad_word(15))));
+    for (int i = 32; i <= Last; i++) {
+        w[i] = ADD(ADD(SSIG1(w[i-2]), w[i-7]), ADD(SSIG0(w[i-15]), w[i-16]));
+    }
+
+    // Round 0 from the IV is constant apart from W0
+    __m256i a = ADD(_mm256_set1_epi32(sha256d_round0_a), w[0]), b = _mm256_set1_epi32(sha256_iv[0]);
+    __m256i c = _mm256_set1_epi32(sha256_iv[1]), d = _mm256_set1_epi32(sha256_iv[2]);
+    __m256i e = ADD(_mm256_set1_epi32(sha256d_round0_e), w[0]), f = _mm256_set1_epi32(sha256_iv[4]);
+    __m256i g = _mm256_set1_epi32(sha256_iv[5]), h = _mm256_set1_epi32(sha256_iv[6]);
+
+    auto round = [&](__m256i kw) {
+        __m256i T1 = ADD(ADD(h, BSIG1(e)), ADD(CH(e,f,g), kw));
+        __m256i T2 = ADD(BSIG0(a), MAJ(a,b,c));
+        h = g;
+        g = f;
+        f = e;
+        e = ADD(d, T1);
+        d = c;
+        c = b;
+        b = a;
+        a = ADD(T1, T2);
+    };
+    for (int i = 1; i < 8; i++) round(ADD(_mm256_set1_epi32(sha256_k[i]), w[i]));
+    for (int i = 8; i < 16; i++) round(_mm256_set1_epi32(sha256d_kw_pad[i - 8]));
+    for (int i = 16; i <= Last; i++) round(ADD(_mm256_set1_epi32(sha256_k[i]), w[i]));
+
+    s[0] = a; s[1] = b; s[2] = c; s[3] = d;
+    s[4] = e; s[5] = f; s[6] = g; s[7] = h;
+}
+
+// Second SHA-256 stopped once H7 is known (IV7 + the `e` from round 60)
+static inline __m256i secondHashH7(__m256i w[64]) {
+    __m256i s[8];
+    secondHashRounds<60>(w, s);
+    return ADD(s[4], _mm256_set1_epi32(sha256_iv[7]));
+}
+
+uint64_t scanNoncesAVX2(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                        std::vector<uint32_t>& hits) {
+    const __m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i bswapMask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                               3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i topTarget = _mm256_set1_epi32(job.target[0]);
+    const bool earlyExit = earlyExitApplies(job);
+
+    uint32_t done = 0;
+    for (; count - done >= 8; done += 8) {
+        __m256i nonces = ADD(_mm256_set1_epi32(nonceStart + done), laneOffsets);
+
+        // First hash from the job's prepared tail; its digest is the second message
+        __m256i w[64];
+        firstHashPrepared8(job.prepared, _mm256_shuffle_epi8(nonces, bswapMask), w);
+
+        if (earlyExit) {
+            __m256i h7 = secondHashH7(w);
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(h7, zero)));
+            for (int lane = 0; mask; lane++, mask >>= 1) {
+                uint32_t nonce = nonceStart + done + lane;
+                if ((mask & 1) && confirmNonce(job, nonce))
+                    appendHit(hits, nonce);
+            }
+            continue;
+        }
+
+        __m256i hash[8];
+        secondHashRounds<63>(w, hash);
+        for (int i = 0; i < 8; i++) hash[i] = ADD(hash[i], _mm256_set1_epi32(sha256_iv[i]));
+
+        // Cheap filter on the most significant limb; full compare only for survivors
+        __m256i top = _mm256_shuffle_epi8(hash[7], bswapMask);
+        __m256i le = _mm256_cmpeq_epi32(_mm256_max_epu32(top, topTarget), topTarget);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(le));
+        if (!mask) continue;
+
+        alignas(32) uint32_t lanes[8][8];
+        for (int i = 0; i < 8; i++)
+            _mm256_store_si256((__m256i*)lanes[i], hash[i]);
+        for (int lane = 0; lane < 8; lane++) {
+            if (!(mask & (1 << lane))) continue;
+            std::array<uint32_t, 8> laneHash;
+            for (int i = 0; i < 8; i++) laneHash[i] = lanes[i][lane];
+            if (meetsTarget(laneHash, job.target))
+                appendHit(hits, nonceStart + done + lane);
+        }
+    }
+
+    if (done < count)
+        scanNoncesScalar(job, nonceStart + done, count - done, hits);
+    return count;
+}
+
+#else
+
+uint64_t scanNoncesAVX2(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                        std::vector<uint32_t>& hits) {
+    return scanNoncesScalar(job, nonceStart, count, hits);
+}
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SHA256_AVX2_HPP
+#define SHA256_AVX2_HPP
+
+#include "nonce_scan.hpp"
+#include <array>
+#include <cstddef>
+
+// Scan nonces [nonceStart, nonceStart + count) eight at a time with AVX2,
+// running the full double SHA-256 for each lane.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+// Without AVX2 support at compile time this falls back to scanNoncesScalar.
+uint64_t scanNoncesAVX2(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                        std::vector<uint32_t>& hits);
+
+// Midstates of `count` contiguous 64-byte prefixes, eight per transform; see
+// sha256Midstates. Portable vector code, built with this file's AVX2 flags.
+void sha256MidstatesAVX2(const uint8_t* prefixes, size_t count, std::array<uint32_t, 8>* out);
+
+// sha256dMultiBuffer with eight lanes; portable vector code like the above
+struct Sha256dJob;
+void sha256dMultiBufferAVX2(const Sha256dJob* jobs, size_t count);
+
+#endif // SHA256_AVX2_HPP
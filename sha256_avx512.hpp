@@ -0,0 +1,13 @@
+#ifndef SHA256_AVX512_HPP
+#define SHA256_AVX512_HPP
+
+#include "nonce_scan.hpp"
+
+// Scan nonces [nonceStart, nonceStart + count) sixteen at a time with AVX-512F/VL.
+// Ch/Maj and the three-way sigma XORs are single vpternlogd ops, rotates are vprord.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+// Without AVX-512 support at compile time this falls back to scanNoncesScalar.
+uint64_t scanNoncesAVX512(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                          std::vector<uint32_t>& hits);
+
+#endif // SHA256_AVX512_HPP
@@ -0,0 +1,16 @@
+#ifndef SHA256_BITSLICE_HPP
+#define SHA256_BITSLICE_HPP
+
+#include "nonce_scan.hpp"
+
+// Experimental bitsliced scanners. Register i of a message word holds bit i of that
+// word for every nonce in the batch (256 with AVX2, 512 with AVX-512), so rotates are
+// only re-indexing and additions are ripple-carry chains of boolean ops.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+// Nonces outside whole aligned batches, and builds without the ISA, use scanNoncesScalar.
+uint64_t scanNoncesBitslice256(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                               std::vector<uint32_t>& hits);
+uint64_t scanNoncesBitslice512(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                               std::vector<uint32_t>& hits);
+
+#endif // SHA256_BITSLICE_HPP
@@ -0,0 +1,38 @@
+#include "sha256_bitslice.hpp"
+
+#if defined(__AVX2__)
+#include "sha256_bitslice_core.hpp"
+#include <immintrin.h>
+
+// 256 lanes, one bit position per ymm register
+struct BitsliceAVX2 {
+    typedef __m256i Slice;
+    static constexpr int Lanes = 256;
+
+    static inline Slice zero() { return _mm256_setzero_si256(); }
+    static inline Slice ones() { return _mm256_set1_epi32(-1); }
+    static inline Slice or2(Slice x, Slice y) { return _mm256_or_si256(x, y); }
+    static inline Slice xor3(Slice x, Slice y, Slice z) { return _mm256_xor_si256(_mm256_xor_si256(x, y), z); }
+    static inline Slice maj(Slice x, Slice y, Slice z) {
+        return _mm256_or_si256(_mm256_and_si256(x, y), _mm256_and_si256(z, _mm256_or_si256(x, y)));
+    }
+    static inline Slice ch(Slice x, Slice y, Slice z) {
+        return _mm256_xor_si256(_mm256_and_si256(x, y), _mm256_andnot_si256(x, z));
+    }
+    static inline Slice load(const uint64_t* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static inline void store(uint64_t* p, Slice x) { _mm256_storeu_si256((__m256i*)p, x); }
+};
+
+uint64_t scanNoncesBitslice256(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                               std::vector<uint32_t>& hits) {
+    return scanNoncesBitsliced<BitsliceAVX2>(job, nonceStart, count, hits);
+}
+
+#else
+
+uint64_t scanNoncesBitslice256(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                               std::vector<uint32_t>& hits) {
+    return scanNoncesScalar(job, nonceStart, count, hits);
+}
+
+#endif
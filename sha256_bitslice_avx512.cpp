@@ -0,0 +1,35 @@
+#include "sha256_bitslice.hpp"
+
+#if defined(__AVX512F__)
+#include "sha256_bitslice_core.hpp"
+#include <immintrin.h>
+
+// 512 lanes, one bit position per zmm register. Every boolean step of the adders
+// and SHA functions is a single vpternlogd (0x96 = x^y^z, 0xE8 = majority, 0xCA = x ? y : z).
+struct BitsliceAVX512 {
+    typedef __m512i Slice;
+    static constexpr int Lanes = 512;
+
+    static inline Slice zero() { return _mm512_setzero_si512(); }
+    static inline Slice ones() { return _mm512_set1_epi32(-1); }
+    static inline Slice or2(Slice x, Slice y) { return _mm512_or_si512(x, y); }
+    static inline Slice xor3(Slice x, Slice y, Slice z) { return _mm512_ternarylogic_epi32(x, y, z, 0x96); }
+    static inline Slice maj(Slice x, Slice y, Slice z) { return _mm512_ternarylogic_epi32(x, y, z, 0xE8); }
+    static inline Slice ch(Slice x, Slice y, Slice z) { return _mm512_ternarylogic_epi32(x, y, z, 0xCA); }
+    static inline Slice load(const uint64_t* p) { return _mm512_loadu_si512(p); }
+    static inline void store(uint64_t* p, Slice x) { _mm512_storeu_si512(p, x); }
+};
+
+uint64_t scanNoncesBitslice512(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                               std::vector<uint32_t>& hits) {
+    return scanNoncesBitsliced<BitsliceAVX512>(job, nonceStart, count, hits);
+}
+
+#else
+
+uint64_t scanNoncesBitslice512(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                               std::vector<uint32_t>& hits) {
+    return scanNoncesScalar(job, nonceStart, count, hits);
+}
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef SHA256_BITSLICE_CORE_HPP
+#define SHA256_BITSLICE_CORE_HPP
+
+// Bitsliced double SHA-256 nonce scan, shared by the AVX2 and AVX-512 front ends.
+// `Ops` supplies the register type and its boolean ops:
+//   Slice, Lanes, zero(), ones(), xor3(), maj(), ch(), or2(), load(), store()
+// Only include this from a translation unit built for the matching ISA.
+
+#include "nonce_scan.hpp"
+#include "sha256_simd.hpp"
+
+// One 32-bit word across every lane: slice i holds bit i (LSB first)
+template <class Ops>
+struct BitsliceWord {
+    typename Ops::Slice b[32];
+};
+
+template <class Ops>
+static inline void bitsliceSplat(BitsliceWord<Ops>& w, uint32_t x) {
+    for (int i = 0; i < 32; i++)
+        w.b[i] = ((x >> i) & 1) ? Ops::ones() : Ops::zero();
+}
+
+// x >> n as a slice index: bits shifted in from above are zero
+template <class Ops>
+static inline typename Ops::Slice bitsliceShr(const BitsliceWord<Ops>& x, int i, int n) {
+    return i + n < 32 ? x.b[i + n] : Ops::zero();
+}
+
+// W[r] = SSIG1(W[r-2]) + W[r-7] + SSIG0(W[r-15]) + W[r-16] in a 16-word window,
+// as one pass over the bits with a carry per addition
+template <class Ops>
+static inline void bitsliceSchedule(BitsliceWord<Ops> w[16], int r) {
+    typedef typename Ops::Slice S;
+    BitsliceWord<Ops>& out = w[r & 15];
+    const BitsliceWord<Ops>& x2 = w[(r - 2) & 15];
+    const BitsliceWord<Ops>& x7 = w[(r - 7) & 15];
+    const BitsliceWord<Ops>& x15 = w[(r - 15) & 15];
+
+    S c1 = Ops::zero(), c2 = Ops::zero(), c3 = Ops::zero();
+    for (int i = 0; i < 32; i++) {
+        S s1 = Ops::xor3(x2.b[(i + 17) & 31], x2.b[(i + 19) & 31], bitsliceShr(x2, i, 10));
+        S s0 = Ops::xor3(x15.b[(i + 7) & 31], x15.b[(i + 18) & 31], bitsliceShr(x15, i, 3));
+        S o = out.b[i];
+        S t1 = Ops::xor3(s1, x7.b[i], c1);  c1 = Ops::maj(s1, x7.b[i], c1);
+        S t2 = Ops::xor3(t1, s0, c2);       c2 = Ops::maj(t1, s0, c2);
+        out.b[i] = Ops::xor3(t2, o, c3);    c3 = Ops::maj(t2, o, c3);
+    }
+}
+
+// Round r on the working variables. v[] rotates instead of shifting a..h: round r
+// reads a at v[-r & 7], and writes the new e over d and the new a over h.
+// Rotations are slice offsets; T1, T2 and both state adds share one bit pass.
+template <class Ops>
+static inline void bitsliceRound(BitsliceWord<Ops> v[8], int r, const BitsliceWord<Ops>& w, uint32_t k) {
+    typedef typename Ops::Slice S;
+    const BitsliceWord<Ops>& A = v[(0 - r) & 7];
+    const BitsliceWord<Ops>& B = v[(1 - r) & 7];
+    const BitsliceWord<Ops>& C = v[(2 - r) & 7];
+    BitsliceWord<Ops>& D = v[(3 - r) & 7];
+    const BitsliceWord<Ops>& E = v[(4 - r) & 7];
+    const BitsliceWord<Ops>& F = v[(5 - r) & 7];
+    const BitsliceWord<Ops>& G = v[(6 - r) & 7];
+    BitsliceWord<Ops>& H = v[(7 - r) & 7];
+
+    S c1 = Ops::zero(), c2 = Ops::zero(), c3 = Ops::zero(), c4 = Ops::zero();
+    S c5 = Ops::zero(), c6 = Ops::zero(), c7 = Ops::zero();
+    for (int i = 0; i < 32; i++) {
+        S kb = ((k >> i) & 1) ? Ops::ones() : Ops::zero();
+        S s1 = Ops::xor3(E.b[(i + 6) & 31], E.b[(i + 11) & 31], E.b[(i + 25) & 31]);
+        S chv = Ops::ch(E.b[i], F.b[i], G.b[i]);
+        S s0 = Ops::xor3(A.b[(i + 2) & 31], A.b[(i + 13) & 31], A.b[(i + 22) & 31]);
+        S mj = Ops::maj(A.b[i], B.b[i], C.b[i]);
+
+        // T1 = h + BSIG1(e) + Ch(e, f, g) + K + W
+        S h = H.b[i];
+        S t = Ops::xor3(h, s1, c1);        c1 = Ops::maj(h, s1, c1);
+        S u = Ops::xor3(t, chv, c2);       c2 = Ops::maj(t, chv, c2);
+        S x = Ops::xor3(u, kb, c3);        c3 = Ops::maj(u, kb, c3);
+        S T1 = Ops::xor3(x, w.b[i], c4);   c4 = Ops::maj(x, w.b[i], c4);
+
+        // T2 = BSIG0(a) + Maj(a, b, c)
+        S T2 = Ops::xor3(s0, mj, c5);      c5 = Ops::maj(s0, mj, c5);
+
+        S d = D.b[i];
+        D.b[i] = Ops::xor3(d, T1, c6);     c6 = Ops::maj(d, T1, c6);
+        H.b[i] = Ops::xor3(T1, T2, c7);    c7 = Ops::maj(T1, T2, c7);
+    }
+}
+
+// x += constant
+template <class Ops>
+static inline void bitsliceAddConst(BitsliceWord<Ops>& x, uint32_t k) {
+    typedef typename Ops::Slice S;
+    S c = Ops::zero();
+    for (int i = 0; i < 32; i++) {
+        S kb = ((k >> i) & 1) ? Ops::ones() : Ops::zero();
+        S xi = x.b[i];
+        x.b[i] = Ops::xor3(xi, kb, c);
+        c = Ops::maj(xi, kb, c);
+    }
+}
+
+// Per-lane value of a bitsliced word
+template <class Ops>
+static inline void bitsliceExtract(const BitsliceWord<Ops>& x, uint32_t out[Ops::Lanes]) {
+    uint64_t bits[32][Ops::Lanes / 64];
+    for (int i = 0; i < 32; i++) Ops::store(bits[i], x.b[i]);
+    for (int lane = 0; lane < Ops::Lanes; lane++) {
+        uint32_t v = 0;
+        for (int i = 0; i < 32; i++)
+            v |= uint32_t((bits[i][lane / 64] >> (lane % 64)) & 1) << i;
+        out[lane] = v;
+    }
+}
+
+// Scan Ops::Lanes nonces per batch. Batches start on a multiple of Ops::Lanes, so the
+// low nonce bits are fixed lane patterns and the rest are constant across the batch.
+template <class Ops>
+uint64_t scanNoncesBitsliced(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                             std::vector<uint32_t>& hits) {
+    typedef typename Ops::Slice S;
+    typedef BitsliceWord<Ops> Word;
+    constexpr int Lanes = Ops::Lanes;
+    constexpr int LaneBits = __builtin_ctz(Lanes);
+
+    uint64_t end = uint64_t(nonceStart) + count;
+    uint64_t first = (uint64_t(nonceStart) + Lanes - 1) & ~uint64_t(Lanes - 1);
+    uint64_t last = end & ~uint64_t(Lanes - 1);
+    if (first >= last)
+        return scanNoncesScalar(job, nonceStart, count, hits);
+    if (first > nonceStart)
+        scanNoncesScalar(job, nonceStart, uint32_t(first - nonceStart), hits);
+
+    // Slice j has lane n's bit j of n, for the nonce bits that vary inside a batch
+    S lanePattern[LaneBits];
+    for (int j = 0; j < LaneBits; j++) {
+        uint64_t bits[Lanes / 64] = {};
+        for (int lane = 0; lane < Lanes; lane++)
+            if ((lane >> j) & 1) bits[lane / 64] |= uint64_t(1) << (lane % 64);
+        lanePattern[j] = Ops::load(bits);
+    }
+
+    const PreparedTail& pt = job.prepared;
+    const bool earlyExit = earlyExitApplies(job);
+    // With the early exit, H7 == 0 means the round-60 `e` equals -IV7
+    const uint32_t e60Zero = 0u - sha256_iv[7];
+
+    Word v[8], w[16];
+    uint32_t laneWords[Lanes];
+    for (uint64_t base = first; base < last; base += Lanes) {
+        // First hash: message window with the nonce word W3 = bswap(nonce)
+        for (int i = 0; i < 3; i++) bitsliceSplat(w[i], pt.w[i]);
+        uint32_t w3Base = nonceToWord(uint32_t(base));
+        for (int p = 0; p < 32; p++) {
+            int j = 8 * (3 - p / 8) + p % 8;   // nonce bit that lands in W3 bit p
+            w[3].b[p] = j < LaneBits ? lanePattern[j]
+                                     : ((w3Base >> p) & 1) ? Ops::ones() : Ops::zero();
+        }
+        bitsliceSplat(w[4], 0x80000000);
+        for (int i = 5; i < 15; i++) bitsliceSplat(w[i], 0);
+        bitsliceSplat(w[15], 640);
+
+        // Resume from the prepared state after round 2
+        for (int i = 0; i < 8; i++) bitsliceSplat(v[(i - 3) & 7], pt.state[i]);
+        for (int r = 3; r < 64; r++) {
+            if (r >= 16) bitsliceSchedule(w, r);
+            bitsliceRound(v, r, w[r & 15], sha256_k[r]);
+        }
+
+        // Digest words become the second message; the state restarts from the IV
+        for (int i = 0; i < 8; i++) {
+            bitsliceAddConst(v[i], pt.midstate[i]);
+            w[i] = v[i];
+            bitsliceSplat(v[i], sha256_iv[i]);
+        }
+        bitsliceSplat(w[8], 0x80000000);
+        for (int i = 9; i < 15; i++) bitsliceSplat(w[i], 0);
+        bitsliceSplat(w[15], 256);
+
+        int lastRound = earlyExit ? 60 : 63;
+        for (int r = 0; r <= lastRound; r++) {
+            if (r >= 16) bitsliceSchedule(w, r);
+            bitsliceRound(v, r, w[r & 15], sha256_k[r]);
+        }
+
+        // After round 60 the new `e` sits in v[7]; after round 63 so does h
+        if (earlyExit) {
+            S mismatch = Ops::zero();
+            for (int i = 0; i < 32; i++) {
+                S kb = ((e60Zero >> i) & 1) ? Ops::ones() : Ops::zero();
+                mismatch = Ops::or2(mismatch, Ops::xor3(v[7].b[i], kb, Ops::zero()));
+            }
+            uint64_t bits[Lanes / 64];
+            Ops::store(bits, mismatch);
+            for (int lane = 0; lane < Lanes; lane++) {
+                if ((bits[lane / 64] >> (lane % 64)) & 1) continue;
+                uint32_t nonce = uint32_t(base) + lane;
+                if (confirmNonce(job, nonce))
+                    appendHit(hits, nonce);
+            }
+            continue;
+        }
+
+        bitsliceAddConst(v[7], sha256_iv[7]);
+        bitsliceExtract(v[7], laneWords);
+        for (int lane = 0; lane < Lanes; lane++) {
+            // Cheap filter on the most significant limb; full compare only for survivors
+            if (__builtin_bswap32(laneWords[lane]) > job.target[0]) continue;
+            uint32_t nonce = uint32_t(base) + lane;
+            if (confirmNonce(job, nonce))
+                appendHit(hits, nonce);
+        }
+    }
+
+    if (last < end)
+        scanNoncesScalar(job, uint32_t(last), uint32_t(end - last), hits);
+    return count;
+}
+
+#endif // SHA256_BITSLICE_CORE_HPP
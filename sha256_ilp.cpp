@@ -0,0 +1,130 @@
+#include "sha256_ilp.hpp"
+#include "sha256_simd.hpp"
+#include <utility>
+
+namespace {
+
+// sha256_round_unrolled, forced inline: 2-4 ways of 60-odd unrolled rounds are far
+// past the inliner's budget, and a round left out of line passes the ways through memory
+template <int Round, class V>
+__attribute__((always_inline)) inline void ilpRound(V s[8], V w) {
+    V T1 = s[7] + sha256_bsig1(s[4]) + sha256_ch(s[4], s[5], s[6]) + sha256_k[Round] + w;
+    V T2 = sha256_bsig0(s[0]) + sha256_maj(s[0], s[1], s[2]);
+    s[7] = s[6];
+    s[6] = s[5];
+    s[5] = s[4];
+    s[4] = s[3] + T1;
+    s[3] = s[2];
+    s[2] = s[1];
+    s[1] = s[0];
+    s[0] = T1 + T2;
+}
+
+// W[Round] in a rolling 16-word window: from FirstRolled on, each word is computed
+// in place over W[Round - 16] just before its round. With the rounds unrolled every
+// index is a constant, so the window stays in registers instead of a 64-word array
+// per way in memory.
+template <int Round, int FirstRolled, class V>
+__attribute__((always_inline)) inline V scheduleWord(V w[16]) {
+    if constexpr (Round >= FirstRolled)
+        w[Round & 15] += sha256_ssig1(w[(Round - 2) & 15]) + w[(Round - 7) & 15] +
+                         sha256_ssig0(w[(Round - 15) & 15]);
+    return w[Round & 15];
+}
+
+// First SHA-256 from the job's prepared tail (rounds 4..63; round 3 is finished
+// here with the nonce word). W16..W19 come from the tail's precomputed terms.
+template <class V>
+inline void ilpFirstHash(const PreparedTail& pt, V w3, V out[8]) {
+    V w[16];
+    w[0] = laneSplat<V>(pt.w16);
+    w[1] = laneSplat<V>(pt.w17);
+    w[2] = laneSplat<V>(pt.w18Base) + sha256_ssig0(w3);
+    w[3] = laneSplat<V>(pt.w19Base) + w3;
+    w[4] = laneSplat<V>(0x80000000);
+    for (int i = 5; i < 15; i++) w[i] = V{};
+    w[15] = laneSplat<V>(640);
+
+    V s[8] = {laneSplat<V>(pt.t1Base + pt.t2) + w3,
+              laneSplat<V>(pt.state[0]), laneSplat<V>(pt.state[1]), laneSplat<V>(pt.state[2]),
+              laneSplat<V>(pt.state[3] + pt.t1Base) + w3,
+              laneSplat<V>(pt.state[4]), laneSplat<V>(pt.state[5]), laneSplat<V>(pt.state[6])};
+    [&]<size_t... R>(std::index_sequence<R...>) __attribute__((always_inline, flatten)) {
+        (ilpRound<R + 4>(s, scheduleWord<R + 4, 20>(w)), ...);
+    }(std::make_index_sequence<60>{});
+
+    for (int i = 0; i < 8; i++) out[i] = s[i] + pt.midstate[i];
+}
+
+// Second SHA-256 through round Last; s receives the working variables. The
+// padding words are constants, so their rounds and schedule terms fold.
+template <int Last, class V>
+inline void ilpSecondRounds(const V digest[8], V s[8]) {
+    V w[16];
+    for (int i = 0; i < 8; i++) w[i] = digest[i];
+    for (int i = 8; i < 16; i++) w[i] = laneSplat<V>(sha256d_pad_word(i));
+
+    s[0] = laneSplat<V>(sha256d_round0_a) + w[0];
+    s[1] = laneSplat<V>(sha256_iv[0]);
+    s[2] = laneSplat<V>(sha256_iv[1]);
+    s[3] = laneSplat<V>(sha256_iv[2]);
+    s[4] = laneSplat<V>(sha256d_round0_e) + w[0];
+    s[5] = laneSplat<V>(sha256_iv[4]);
+    s[6] = laneSplat<V>(sha256_iv[5]);
+    s[7] = laneSplat<V>(sha256_iv[6]);
+    [&]<size_t... R>(std::index_sequence<R...>) __attribute__((always_inline, flatten)) {
+        (ilpRound<R + 1>(s, scheduleWord<R + 1, 16>(w)), ...);
+    }(std::make_index_sequence<Last>{});
+}
+
+} // namespace
+
+// flatten: the unrolled rounds are far past the inliner's budget, and every
+// helper left out of line would pass the ways through memory
+template <int Ways>
+__attribute__((flatten)) uint64_t scanNoncesILP(const ScanJob& job, uint32_t nonceStart,
+                                                uint32_t count, std::vector<uint32_t>& hits) {
+    typedef IlpWord<Ways> V;
+
+    const bool earlyExit = earlyExitApplies(job);
+
+    uint32_t done = 0;
+    for (; count - done >= (uint32_t)Ways; done += Ways) {
+        V w3;
+        for (int i = 0; i < Ways; i++) w3.set(i, nonceToWord(nonceStart + done + i));
+
+        V digest[8];
+        ilpFirstHash(job.prepared, w3, digest);
+
+        V s[8];
+        if (earlyExit) {
+            // H7 is IV7 plus the `e` of round 60
+            ilpSecondRounds<60>(digest, s);
+            V h7 = s[4] + sha256_iv[7];
+            for (int i = 0; i < Ways; i++) {
+                uint32_t nonce = nonceStart + done + i;
+                if (h7[i] == 0 && confirmNonce(job, nonce))
+                    hits.push_back(nonce);
+            }
+            continue;
+        }
+
+        ilpSecondRounds<63>(digest, s);
+        for (int i = 0; i < Ways; i++) {
+            // Cheap filter on the most significant limb; full compare only for survivors
+            if (__builtin_bswap32(s[7][i] + sha256_iv[7]) > job.target[0]) continue;
+            std::array<uint32_t, 8> wayHash;
+            for (int j = 0; j < 8; j++) wayHash[j] = s[j][i] + sha256_iv[j];
+            if (meetsTarget(wayHash, job.target))
+                hits.push_back(nonceStart + done + i);
+        }
+    }
+
+    if (done < count)
+        scanNoncesScalar(job, nonceStart + done, count - done, hits);
+    return count;
+}
+
+template uint64_t scanNoncesILP<2>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+template uint64_t scanNoncesILP<3>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+template uint64_t scanNoncesILP<4>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
@@ -0,0 +1,89 @@
+#ifndef SHA256_ILP_HPP
+#define SHA256_ILP_HPP
+
+#include "nonce_scan.hpp"
+
+// `Ways` independent 32-bit words updated by plain scalar code. Every operation
+// expands to `Ways` independent instructions, so a superscalar core can overlap
+// the otherwise serial round chains. The words are nested members rather than an
+// array so the compiler keeps each one in its own register.
+// sha256_ilp.cpp is built without auto-vectorization so these stay scalar.
+template <int Ways>
+struct IlpWord {
+    uint32_t x;
+    IlpWord<Ways - 1> rest;
+
+    constexpr uint32_t operator[](int i) const { return i == 0 ? x : rest[i - 1]; }
+    constexpr void set(int i, uint32_t v) { if (i == 0) x = v; else rest.set(i - 1, v); }
+};
+
+template <>
+struct IlpWord<1> {
+    uint32_t x;
+
+    constexpr uint32_t operator[](int) const { return x; }
+    constexpr void set(int, uint32_t v) { x = v; }
+};
+
+template <int Ways, class F>
+constexpr IlpWord<Ways> ilpMap(IlpWord<Ways> a, F f) {
+    if constexpr (Ways == 1) return {f(a.x)};
+    else return {f(a.x), ilpMap(a.rest, f)};
+}
+
+template <int Ways, class F>
+constexpr IlpWord<Ways> ilpZip(IlpWord<Ways> a, IlpWord<Ways> b, F f) {
+    if constexpr (Ways == 1) return {f(a.x, b.x)};
+    else return {f(a.x, b.x), ilpZip(a.rest, b.rest, f)};
+}
+
+#define ILP_BINARY_OP(op)                                                              \
+    template <int Ways>                                                                \
+    constexpr IlpWord<Ways> operator op(IlpWord<Ways> a, IlpWord<Ways> b) {            \
+        return ilpZip(a, b, [](uint32_t x, uint32_t y) { return x op y; });            \
+    }                                                                                  \
+    template <int Ways>                                                                \
+    constexpr IlpWord<Ways> operator op(IlpWord<Ways> a, uint32_t y) {                 \
+        return ilpMap(a, [y](uint32_t x) { return x op y; });                          \
+    }
+
+ILP_BINARY_OP(+)
+ILP_BINARY_OP(&)
+ILP_BINARY_OP(|)
+ILP_BINARY_OP(^)
+#undef ILP_BINARY_OP
+
+template <int Ways>
+constexpr IlpWord<Ways> operator~(IlpWord<Ways> a) {
+    return ilpMap(a, [](uint32_t x) { return ~x; });
+}
+
+template <int Ways>
+constexpr IlpWord<Ways> operator>>(IlpWord<Ways> a, int n) {
+    return ilpMap(a, [n](uint32_t x) { return x >> n; });
+}
+
+template <int Ways>
+constexpr IlpWord<Ways> operator<<(IlpWord<Ways> a, int n) {
+    return ilpMap(a, [n](uint32_t x) { return x << n; });
+}
+
+template <int Ways, class T>
+constexpr IlpWord<Ways>& operator+=(IlpWord<Ways>& a, T y) {
+    return a = a + y;
+}
+
+// Scan nonces [nonceStart, nonceStart + count) `Ways` (2..4) at a time with
+// interleaved scalar streams. Not a dispatch candidate: on x86-64 the ways spill
+// out of the 16 GPRs and every width measures below scanNoncesScalar, so only
+// bench_kernels runs it.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+template <int Ways>
+uint64_t scanNoncesILP(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                       std::vector<uint32_t>& hits);
+
+extern template uint64_t scanNoncesILP<2>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+extern template uint64_t scanNoncesILP<3>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+extern template uint64_t scanNoncesILP<4>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+
+#endif // SHA256_ILP_HPP
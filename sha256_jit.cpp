@@ -0,0 +1,336 @@
+#include "sha256_jit.hpp"
+#include "sha256_simd.hpp"
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__x86_64__)
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Minimal x86-64 encoder: 32-bit ALU ops on registers, [rsp + disp32] operands
+class X86Emitter {
+public:
+    enum { EAX = 0, ECX = 1, EDX = 2, EDI = 7 };
+    enum { ADD = 0x01, OR = 0x09, AND = 0x21, XOR = 0x31, MOV = 0x89 };
+
+    std::vector<uint8_t> code;
+
+    void movImm(int dst, uint32_t v) { rex(0, dst); byte(0xB8 + (dst & 7)); imm32(v); }
+    void op(uint8_t opcode, int dst, int src) { rex(src, dst); byte(opcode); modrm(3, src, dst); }
+    void addImm(int dst, uint32_t v) { if (v) { rex(0, dst); byte(0x81); modrm(3, 0, dst); imm32(v); } }
+    void ror(int dst, uint8_t n) { rex(0, dst); byte(0xC1); modrm(3, 1, dst); byte(n); }
+    void shr(int dst, uint8_t n) { rex(0, dst); byte(0xC1); modrm(3, 5, dst); byte(n); }
+    void load(int dst, int32_t disp) { stackOp(0x8B, dst, disp); }
+    void store(int32_t disp, int src) { stackOp(0x89, src, disp); }
+    void addLoad(int dst, int32_t disp) { stackOp(0x03, dst, disp); }
+
+    void push(int r) { rex(0, r); byte(0x50 + (r & 7)); }
+    void pop(int r) { rex(0, r); byte(0x58 + (r & 7)); }
+    void subRsp(uint32_t n) { byte(0x48); byte(0x81); byte(0xEC); imm32(n); }
+    void addRsp(uint32_t n) { byte(0x48); byte(0x81); byte(0xC4); imm32(n); }
+    void ret() { byte(0xC3); }
+
+private:
+    void byte(uint8_t b) { code.push_back(b); }
+    void imm32(uint32_t v) { for (int i = 0; i < 4; i++) byte((v >> (8 * i)) & 0xff); }
+    void modrm(int mod, int reg, int rm) { byte((mod << 6) | ((reg & 7) << 3) | (rm & 7)); }
+    void rex(int reg, int rm) {
+        uint8_t r = 0x40 | ((reg >> 3) << 2) | (rm >> 3);
+        if (r != 0x40) byte(r);
+    }
+    // [rsp + disp32] needs a SIB byte
+    void stackOp(uint8_t opcode, int reg, int32_t disp) {
+        rex(reg, 0);
+        byte(opcode);
+        modrm(2, reg, 4);
+        byte(0x24);
+        imm32((uint32_t)disp);
+    }
+};
+
+// A schedule word while emitting: either known now or held in a stack slot
+struct JitWord {
+    bool known;
+    uint32_t value;
+};
+
+// Emits `uint32_t kernel(uint32_t w3)` returning H7 of the double hash. State
+// registers are renamed between rounds instead of moved; eax/ecx/edx are scratch,
+// and esi/edi carry b ^ c into the next round's Maj once the argument is spilled.
+class JitBuilder {
+public:
+    X86Emitter x;
+
+    std::vector<uint8_t> build(const ScanJob& job) {
+        const PreparedTail& pt = job.prepared;
+        static const int calleeSaved[] = {12, 13, 14, 15};
+        for (int r : calleeSaved) x.push(r);
+        x.subRsp(frameSize);
+
+        // First hash: W0..W2 and the padding are known, W3 is the argument
+        JitWord w[64];
+        for (int i = 0; i < 3; i++) w[i] = {true, pt.w[i]};
+        w[3] = {false, 0};
+        x.store(slot(0, 3), X86Emitter::EDI);
+        w[4] = {true, 0x80000000};
+        for (int i = 5; i < 15; i++) w[i] = {true, 0};
+        w[15] = {true, 640};
+
+        // Resume after round 2 from the prepared state
+        for (int i = 0; i < 8; i++) reg[i] = 8 + i;
+        loadState(pt.state.data());
+        for (int r = 3; r < 64; r++) {
+            if (r >= 16) schedule(w, 0, r);
+            round(w[r], 0, r);
+        }
+
+        // Digest words are the second message; restart from the IV
+        JitWord w2[64];
+        for (int i = 0; i < 8; i++) {
+            x.addImm(reg[i], pt.midstate[i]);
+            x.store(slot(1, i), reg[i]);
+            w2[i] = {false, 0};
+        }
+        w2[8] = {true, 0x80000000};
+        for (int i = 9; i < 15; i++) w2[i] = {true, 0};
+        w2[15] = {true, 256};
+
+        loadState(sha256_iv);
+        for (int r = 0; r <= 60; r++) {
+            if (r >= 16) schedule(w2, 1, r);
+            round(w2[r], 1, r);
+        }
+
+        // H7 = IV7 + the `e` from round 60
+        x.op(X86Emitter::MOV, X86Emitter::EAX, reg[4]);
+        x.addImm(X86Emitter::EAX, sha256_iv[7]);
+
+        x.addRsp(frameSize);
+        for (int i = 3; i >= 0; i--) x.pop(calleeSaved[i]);
+        x.ret();
+        return x.code;
+    }
+
+private:
+    // Two 64-word schedules; 8 more bytes keep rsp 16-byte aligned
+    static constexpr uint32_t frameSize = 2 * 64 * 4 + 8;
+    int reg[8];   // registers holding a..h this round
+    int ab = 6;   // esi/edi alternate: Maj scratch and the carried b ^ c
+    int bc = 7;
+
+    static int32_t slot(int hash, int i) { return (hash * 64 + i) * 4; }
+
+    // ecx = SSIG(W[i]) for a slot word (rotates r1, r2; shift s)
+    void sigma(int hash, int i, uint8_t r1, uint8_t r2, uint8_t s) {
+        x.load(X86Emitter::ECX, slot(hash, i));
+        x.op(X86Emitter::MOV, X86Emitter::EDX, X86Emitter::ECX);
+        x.ror(X86Emitter::EDX, r1);
+        x.shr(X86Emitter::ECX, s);
+        x.op(X86Emitter::XOR, X86Emitter::ECX, X86Emitter::EDX);
+        x.ror(X86Emitter::EDX, r2 - r1);
+        x.op(X86Emitter::XOR, X86Emitter::ECX, X86Emitter::EDX);
+    }
+
+    // W[r] = SSIG1(W[r-2]) + W[r-7] + SSIG0(W[r-15]) + W[r-16], folding known terms
+    void schedule(JitWord w[64], int hash, int r) {
+        uint32_t known = 0;
+        bool any = false;
+        auto accumulate = [&](bool fromEcx, int i) {
+            if (fromEcx) x.op(any ? X86Emitter::ADD : X86Emitter::MOV, X86Emitter::EAX, X86Emitter::ECX);
+            else if (any) x.addLoad(X86Emitter::EAX, slot(hash, i));
+            else x.load(X86Emitter::EAX, slot(hash, i));
+            any = true;
+        };
+
+        if (w[r - 2].known) known += sha256_ssig1(w[r - 2].value);
+        else { sigma(hash, r - 2, 17, 19, 10); accumulate(true, 0); }
+        if (w[r - 7].known) known += w[r - 7].value;
+        else accumulate(false, r - 7);
+        if (w[r - 15].known) known += sha256_ssig0(w[r - 15].value);
+        else { sigma(hash, r - 15, 7, 18, 3); accumulate(true, 0); }
+        if (w[r - 16].known) known += w[r - 16].value;
+        else accumulate(false, r - 16);
+
+        if (!any) {
+            w[r] = {true, known};
+            return;
+        }
+        x.addImm(X86Emitter::EAX, known);
+        x.store(slot(hash, r), X86Emitter::EAX);
+        w[r] = {false, 0};
+    }
+
+    void round(const JitWord& w, int hash, int r) {
+        const int A = reg[0], B = reg[1], C = reg[2], D = reg[3];
+        const int E = reg[4], F = reg[5], G = reg[6], H = reg[7];
+        const int T = X86Emitter::ECX, U = X86Emitter::EDX;
+
+        // h += BSIG1(e) + Ch(e, f, g) + K + W; h then holds T1
+        x.op(X86Emitter::MOV, T, E);
+        x.ror(T, 6);
+        x.op(X86Emitter::MOV, U, E);
+        x.ror(U, 11);
+        x.op(X86Emitter::XOR, T, U);
+        x.ror(U, 14);
+        x.op(X86Emitter::XOR, T, U);
+        x.op(X86Emitter::ADD, H, T);
+        x.op(X86Emitter::MOV, T, F);
+        x.op(X86Emitter::XOR, T, G);
+        x.op(X86Emitter::AND, T, E);
+        x.op(X86Emitter::XOR, T, G);
+        x.op(X86Emitter::ADD, H, T);
+        if (w.known) {
+            x.addImm(H, sha256_k[r] + w.value);
+        } else {
+            x.addImm(H, sha256_k[r]);
+            x.addLoad(H, slot(hash, r));
+        }
+
+        // d += T1 is the new e; h += BSIG0(a) + Maj(a, b, c) is the new a
+        x.op(X86Emitter::ADD, D, H);
+        x.op(X86Emitter::MOV, T, A);
+        x.ror(T, 2);
+        x.op(X86Emitter::MOV, U, A);
+        x.ror(U, 13);
+        x.op(X86Emitter::XOR, T, U);
+        x.ror(U, 9);
+        x.op(X86Emitter::XOR, T, U);
+        x.op(X86Emitter::ADD, H, T);
+
+        // Maj(a, b, c) = b ^ ((a ^ b) & (b ^ c)); this round's a ^ b is the next round's b ^ c
+        x.op(X86Emitter::MOV, ab, A);
+        x.op(X86Emitter::XOR, ab, B);
+        x.op(X86Emitter::AND, bc, ab);
+        x.op(X86Emitter::XOR, bc, B);
+        x.op(X86Emitter::ADD, H, bc);
+        std::swap(ab, bc);
+
+        const int next[8] = {H, A, B, C, D, E, F, G};
+        for (int i = 0; i < 8; i++) reg[i] = next[i];
+    }
+
+    // Load a..h into the state registers, with b ^ c for the first Maj
+    void loadState(const uint32_t s[8]) {
+        for (int i = 0; i < 8; i++) x.movImm(reg[i], s[i]);
+        x.movImm(bc, s[1] ^ s[2]);
+    }
+};
+
+// Executable copy of one job's kernel
+class JitKernel {
+public:
+    typedef uint32_t (*Fn)(uint32_t w3);
+
+    explicit JitKernel(const ScanJob& job) : midstate(job.midstate), tail(job.tail) {
+        std::vector<uint8_t> code = JitBuilder().build(job);
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        size = (code.size() + page - 1) / page * page;
+
+        // Written while RW, then flipped to RX; never writable and executable at once
+        void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED) throw std::runtime_error("JIT: mmap failed");
+        memcpy(mem, code.data(), code.size());
+        if (mprotect(mem, size, PROT_READ | PROT_EXEC) != 0) {
+            munmap(mem, size);
+            throw std::runtime_error("JIT: mprotect failed");
+        }
+        base = mem;
+        fn = (Fn)mem;
+    }
+
+    ~JitKernel() { munmap(base, size); }
+
+    JitKernel(const JitKernel&) = delete;
+    JitKernel& operator=(const JitKernel&) = delete;
+
+    bool matches(const ScanJob& job) const {
+        return job.midstate == midstate && job.tail == tail;
+    }
+
+    Fn fn;
+
+private:
+    std::array<uint32_t, 8> midstate;
+    std::array<uint32_t, 3> tail;
+    void* base;
+    size_t size;
+};
+
+// A few recent jobs stay compiled so switching back (e.g. after a stale share) is free
+static const size_t jitCacheSize = 4;
+static std::mutex jitMutex;
+static std::deque<std::shared_ptr<const JitKernel>> jitCache;   // most recent first
+
+static std::shared_ptr<const JitKernel> jitKernelFor(const ScanJob& job) {
+    std::lock_guard<std::mutex> lock(jitMutex);
+    for (auto it = jitCache.begin(); it != jitCache.end(); ++it) {
+        if (!(*it)->matches(job)) continue;
+        std::shared_ptr<const JitKernel> kernel = *it;
+        if (it != jitCache.begin()) {
+            jitCache.erase(it);
+            jitCache.push_front(kernel);
+        }
+        return kernel;
+    }
+
+    auto kernel = std::make_shared<const JitKernel>(job);
+    jitCache.push_front(kernel);
+    if (jitCache.size() > jitCacheSize) jitCache.pop_back();
+    return kernel;
+}
+
+bool jitAvailable() {
+    static const bool available = [] {
+        // Generate and run one kernel; W^X policies or seccomp may forbid it
+        try {
+            ScanJob job{};
+            job.prepared = prepareTail(job.midstate, job.tail);
+            JitKernel kernel(job);
+            std::array<uint32_t, 8> hash;
+            hashHeaderNonce(job, 0, hash);
+            return kernel.fn(nonceToWord(0)) == hash[7];
+        } catch (const std::exception&) {
+            return false;
+        }
+    }();
+    return available;
+}
+
+uint64_t scanNoncesJIT(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                       std::vector<uint32_t>& hits) {
+    if (!jitAvailable()) return scanNoncesScalar(job, nonceStart, count, hits);
+
+    // Each scanning thread keeps its last kernel, so the shared cache and its lock
+    // are only hit on a job change. Holding the shared_ptr keeps the code mapped
+    // even if the cache evicts it.
+    thread_local std::shared_ptr<const JitKernel> kernel;
+    if (!kernel || !kernel->matches(job)) kernel = jitKernelFor(job);
+    JitKernel::Fn fn = kernel->fn;
+    const uint32_t topTarget = job.target[0];
+
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t nonce = nonceStart + i;
+        // H7 carries the most significant limb; full compare only for survivors
+        uint32_t h7 = fn(nonceToWord(nonce));
+        if (__builtin_bswap32(h7) <= topTarget && confirmNonce(job, nonce))
+            appendHit(hits, nonce);
+    }
+    return count;
+}
+
+#else
+
+bool jitAvailable() {
+    return false;
+}
+
+uint64_t scanNoncesJIT(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                       std::vector<uint32_t>& hits) {
+    return scanNoncesScalar(job, nonceStart, count, hits);
+}
+
+#endif
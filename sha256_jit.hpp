@@ -0,0 +1,20 @@
+#ifndef SHA256_JIT_HPP
+#define SHA256_JIT_HPP
+
+#include "nonce_scan.hpp"
+
+// True if this build can generate and run per-job machine code (x86-64 only)
+bool jitAvailable();
+
+// Scan nonces [nonceStart, nonceStart + count) with code generated for this job.
+// The midstate, the prepared tail and every K+W sum that does not depend on the
+// nonce are baked in as immediates, and schedule terms that only read constants
+// are folded while emitting. Generated kernels are cached per job (midstate and
+// tail words) and swapped in under a lock, so concurrent scans share one copy;
+// each thread reuses its last kernel without the lock until the job changes.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+// Without JIT support this falls back to scanNoncesScalar.
+uint64_t scanNoncesJIT(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                       std::vector<uint32_t>& hits);
+
+#endif // SHA256_JIT_HPP
@@ -47,7 +47,7 @@ inline u32 sigma1(u32 x) {
     return ROTR(x, 17) ^ ROTR(x, 19) ^ (x >> 10);
 }
 
-inline void sha256_transform(const device uint8_t *data, device u32 *state) {
+inline void sha256_transform(const thread uint8_t *data, thread u32 *state) {
     u32 w[64];
     for (uint i = 0; i < 16; i++) {
         w[i] = (u32(data[i * 4]) << 24) | (u32(data[i * 4 + 1]) << 16) |
@@ -89,25 +89,35 @@ inline void sha256_transform(const device uint8_t *data, device u32 *state) {
     state[7] += h;
 }
 
-inline void sha256(const device uint8_t *data, uint len, device u32 *hash) {
+inline void sha256(const thread uint8_t *data, uint len, thread u32 *hash) {
     for (uint i = 0; i < 8; i++) hash[i] = h0_init[i];
 
-    uint8_t block[64] = {0};
-    for (uint i = 0; i < len; i++) {
-        block[i] = data[i];
+    // Whole blocks straight from the message
+    uint offset = 0;
+    for (; offset + 64 <= len; offset += 64) {
+        sha256_transform(data + offset, hash);
     }
-    block[len] = 0x80;
+
+    // The rest, 0x80 and the bit length: one block, or two if they don't fit in one
+    uint8_t block[128] = {0};
+    uint rest = len - offset;
+    for (uint i = 0; i < rest; i++) {
+        block[i] = data[offset + i];
+    }
+    block[rest] = 0x80;
+    uint padded = rest + 9 <= 64 ? 64 : 128;
 
     uint bitLen = len * 8;
-    block[63] = bitLen & 0xff;
-    block[62] = (bitLen >> 8) & 0xff;
-    block[61] = (bitLen >> 16) & 0xff;
-    block[60] = (bitLen >> 24) & 0xff;
+    block[padded - 1] = bitLen & 0xff;
+    block[padded - 2] = (bitLen >> 8) & 0xff;
+    block[padded - 3] = (bitLen >> 16) & 0xff;
+    block[padded - 4] = (bitLen >> 24) & 0xff;
 
     sha256_transform(block, hash);
+    if (padded == 128) sha256_transform(block + 64, hash);
 }
 
-inline void double_sha256(const device uint8_t *data, uint len, device u32 *hash_out) {
+inline void double_sha256(const thread uint8_t *data, uint len, thread u32 *hash_out) {
     u32 hash1[8];
     sha256(data, len, hash1);
 
@@ -0,0 +1,10 @@
+#include "sha256_multibuffer.hpp"
+#include "cpu_dispatch.hpp"
+#include "sha256_avx2.hpp"
+
+void sha256dMultiBuffer(std::span<const Sha256dJob> jobs) {
+    if (cpuFeatures().avx2)
+        sha256dMultiBufferAVX2(jobs.data(), jobs.size());
+    else
+        sha256d_multibuffer_lanes<LaneWord<4>>(jobs.data(), jobs.size());
+}
@@ -0,0 +1,119 @@
+#ifndef SHA256_MULTIBUFFER_HPP
+#define SHA256_MULTIBUFFER_HPP
+
+#include "sha256_simd.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+// One double SHA-256 over up to three byte ranges hashed as if concatenated, so a
+// txid can skip the witness section in place. Unused parts have length 0.
+struct Sha256dJob {
+    const uint8_t* part[3] = {nullptr, nullptr, nullptr};
+    size_t len[3] = {0, 0, 0};
+    uint8_t* out = nullptr;   // 32 bytes, in hash byte order
+};
+
+// Runs every job, several messages per SIMD transform (8 lanes with AVX2, else 4).
+// Lanes are refilled as their messages finish, so lengths may differ freely.
+void sha256dMultiBuffer(std::span<const Sha256dJob> jobs);
+
+// Block `index` of the job's padded message (`total` message bytes)
+inline void sha256_job_block(const Sha256dJob& job, uint64_t total, uint64_t index, uint8_t block[64]) {
+    const uint64_t begin = index * 64, end = begin + 64;
+    std::memset(block, 0, 64);
+    uint64_t partStart = 0;
+    for (int p = 0; p < 3; p++) {
+        uint64_t partEnd = partStart + job.len[p];
+        uint64_t from = std::max(partStart, begin), to = std::min(partEnd, end);
+        if (from < to) std::memcpy(block + (from - begin), job.part[p] + (from - partStart), to - from);
+        partStart = partEnd;
+    }
+    if (total >= begin && total < end) block[total - begin] = 0x80;
+    if (index == (total + 8) / 64) {
+        uint64_t bits = total * 8;
+        for (int i = 0; i < 8; i++) block[63 - i] = (uint8_t)(bits >> (8 * i));
+    }
+}
+
+// Multi-buffer core: each lane of V works through its own message, then through
+// the 32-byte second message, then takes the next job.
+template <class V>
+inline void sha256d_multibuffer_lanes(const Sha256dJob* jobs, size_t count) {
+    constexpr int lanes = sizeof(V) / sizeof(uint32_t);
+    struct Lane {
+        const Sha256dJob* job = nullptr;
+        uint64_t total = 0;
+        uint64_t block = 0, blocks = 0;   // blocks == 1 and second: hashing the digest
+        bool second = false;
+        uint32_t digest[8];
+    };
+    Lane lane[lanes];
+    V state[8];
+    for (int i = 0; i < 8; i++) state[i] = laneSplat<V>(sha256_iv[i]);
+
+    size_t next = 0;
+    int active = 0;
+    auto startJob = [&](int l) {
+        Lane& ln = lane[l];
+        ln = Lane{};
+        if (next == count) return false;
+        ln.job = &jobs[next++];
+        ln.total = ln.job->len[0] + ln.job->len[1] + ln.job->len[2];
+        ln.blocks = (ln.total + 8) / 64 + 1;
+        for (int i = 0; i < 8; i++) laneSet(state[i], l, sha256_iv[i]);
+        return true;
+    };
+    for (int l = 0; l < lanes; l++) active += startJob(l);
+
+    while (active) {
+        V w[64];
+        for (int i = 0; i < 16; i++) w[i] = V{};
+        for (int l = 0; l < lanes; l++) {
+            const Lane& ln = lane[l];
+            if (!ln.job) continue;
+            if (ln.second) {
+                for (int i = 0; i < 8; i++) laneSet(w[i], l, ln.digest[i]);
+                laneSet(w[8], l, 0x80000000u);
+                laneSet(w[15], l, 256u);
+                continue;
+            }
+            uint8_t block[64];
+            sha256_job_block(*ln.job, ln.total, ln.block, block);
+            for (int i = 0; i < 16; i++) {
+                const uint8_t* p = block + i * 4;
+                laneSet(w[i], l, (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) |
+                                 (uint32_t(p[2]) << 8) | uint32_t(p[3]));
+            }
+        }
+
+        sha256_transform_lanes(state, w);
+
+        for (int l = 0; l < lanes; l++) {
+            Lane& ln = lane[l];
+            if (!ln.job || ++ln.block < ln.blocks) continue;
+            if (!ln.second) {
+                for (int i = 0; i < 8; i++) {
+                    ln.digest[i] = laneGet(state[i], l);
+                    laneSet(state[i], l, sha256_iv[i]);
+                }
+                ln.second = true;
+                ln.block = 0;
+                ln.blocks = 1;
+                continue;
+            }
+            for (int i = 0; i < 8; i++) {
+                uint32_t word = laneGet(state[i], l);
+                ln.job->out[i * 4] = (uint8_t)(word >> 24);
+                ln.job->out[i * 4 + 1] = (uint8_t)(word >> 16);
+                ln.job->out[i * 4 + 2] = (uint8_t)(word >> 8);
+                ln.job->out[i * 4 + 3] = (uint8_t)word;
+            }
+            if (!startJob(l)) active--;
+        }
+    }
+}
+
+#endif // SHA256_MULTIBUFFER_HPP
@@ -0,0 +1,205 @@
+#include "sha256_shani.hpp"
+#include "cpu_dispatch.hpp"
+#include "sha256_compress.hpp"
+#include "sha256_simd.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SHA__) && defined(__SSE4_1__)
+#include <immintrin.h>
+
+bool shaniAvailable() {
+    const CpuFeatures& f = cpuFeatures();
+    return f.sha && f.ssse3 && f.sse41;
+}
+
+// Big-endian message bytes to native words
+static inline __m128i loadBE(const uint8_t* p) {
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)p), mask);
+}
+
+// State words H0..H7 to the ABEF/CDGH register layout sha256rnds2 expects
+static inline void packState(const uint32_t* h, __m128i& s0, __m128i& s1) {
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[0]), 0xB1);
+    __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[4]), 0x1B);
+    s0 = _mm_alignr_epi8(abcd, efgh, 8);
+    s1 = _mm_blend_epi16(efgh, abcd, 0xF0);
+}
+
+// ABEF/CDGH back to state words: lo = H0..H3, hi = H4..H7
+static inline void unpackState(__m128i s0, __m128i s1, __m128i& lo, __m128i& hi) {
+    __m128i feba = _mm_shuffle_epi32(s0, 0x1B);
+    __m128i dchg = _mm_shuffle_epi32(s1, 0xB1);
+    lo = _mm_blend_epi16(feba, dchg, 0xF0);
+    hi = _mm_alignr_epi8(dchg, feba, 8);
+}
+
+// 64 rounds on N independent streams. m[n][0..3] hold W0..W15 as native words.
+// The streams share one instruction sequence so their latencies overlap.
+// With FromRound2 the first sha256rnds2 is skipped: the caller has already run
+// rounds 0..1, leaving the new ABEF in s1 and the old ABEF (now CDGH) in s0.
+// With H7Only the last sha256rnds2 is skipped: after rounds 60..61 the new ABEF
+// in s1 carries the round-60 `e` as F (lane 0), which is all H7 needs.
+template <int N, bool FromRound2 = false, bool H7Only = false>
+static inline void rounds(__m128i s0[N], __m128i s1[N], __m128i m[N][4]) {
+    for (int q = 0; q < 16; q++) {
+        const __m128i kq = _mm_load_si128((const __m128i*)&sha256_k[q * 4]);
+        for (int n = 0; n < N; n++) {
+            __m128i msg = _mm_add_epi32(m[n][q & 3], kq);
+            if (!(FromRound2 && q == 0))
+                s1[n] = _mm_sha256rnds2_epu32(s1[n], s0[n], msg);
+            if (H7Only && q == 15) continue;
+            s0[n] = _mm_sha256rnds2_epu32(s0[n], s1[n], _mm_shuffle_epi32(msg, 0x0E));
+        }
+        for (int n = 0; n < N; n++) {
+            __m128i& a = m[n][(q + 3) & 3];
+            __m128i& b = m[n][q & 3];
+            __m128i& c = m[n][(q + 1) & 3];
+            if (q >= 3 && q <= 14)
+                c = _mm_sha256msg2_epu32(_mm_add_epi32(c, _mm_alignr_epi8(b, a, 4)), b);
+            if (q >= 1 && q <= 12)
+                a = _mm_sha256msg1_epu32(a, b);
+        }
+    }
+}
+
+void sha256_compress_shani(const uint8_t* blocks, size_t nblocks, std::array<uint32_t, 8>& state) {
+    __m128i s0[1], s1[1];
+    packState(state.data(), s0[0], s1[0]);
+
+    for (size_t i = 0; i < nblocks; i++, blocks += 64) {
+        __m128i save0 = s0[0], save1 = s1[0];
+        __m128i m[1][4] = {{loadBE(blocks), loadBE(blocks + 16), loadBE(blocks + 32), loadBE(blocks + 48)}};
+        rounds<1>(s0, s1, m);
+        s0[0] = _mm_add_epi32(s0[0], save0);
+        s1[0] = _mm_add_epi32(s1[0], save1);
+    }
+
+    __m128i lo, hi;
+    unpackState(s0[0], s1[0], lo, hi);
+    _mm_storeu_si128((__m128i*)&state[0], lo);
+    _mm_storeu_si128((__m128i*)&state[4], hi);
+}
+
+uint64_t scanNoncesSHANI(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                         std::vector<uint32_t>& hits) {
+    __m128i mid0, mid1, iv0, iv1;
+    packState(job.midstate.data(), mid0, mid1);
+    packState(sha256_iv, iv0, iv1);
+
+    const __m128i pad = _mm_set_epi32(0, 0, 0, 0x80000000);
+    const __m128i len1 = _mm_set_epi32(640, 0, 0, 0);
+    const __m128i len2 = _mm_set_epi32(256, 0, 0, 0);
+    const __m128i zero = _mm_setzero_si128();
+    const bool earlyExit = earlyExitApplies(job);
+
+    // Rounds 0..1 only see the tail words W0..W1, so run them once per call
+    const __m128i wk01 = _mm_add_epi32(_mm_set_epi32(0, 0, job.tail[1], job.tail[0]),
+                                       _mm_load_si128((const __m128i*)&sha256_k[0]));
+    const __m128i pre = _mm_sha256rnds2_epu32(mid1, mid0, wk01);
+
+    uint32_t done = 0;
+    for (; count - done >= 2; done += 2) {
+        // First hash from round 2 onward, two nonces side by side
+        __m128i s0[2] = {mid0, mid0}, s1[2] = {pre, pre};
+        __m128i m[2][4];
+        for (int n = 0; n < 2; n++) {
+            uint32_t nonce = nonceStart + done + n;
+            m[n][0] = _mm_set_epi32(nonceToWord(nonce), job.tail[2], job.tail[1], job.tail[0]);
+            m[n][1] = pad;
+            m[n][2] = zero;
+            m[n][3] = len1;
+        }
+        rounds<2, true>(s0, s1, m);
+
+        // Second hash over the 32-byte digests
+        for (int n = 0; n < 2; n++) {
+            unpackState(_mm_add_epi32(s0[n], mid0), _mm_add_epi32(s1[n], mid1), m[n][0], m[n][1]);
+            m[n][2] = pad;
+            m[n][3] = len2;
+            s0[n] = iv0;
+            s1[n] = iv1;
+        }
+
+        if (earlyExit) {
+            rounds<2, false, true>(s0, s1, m);
+            for (int n = 0; n < 2; n++) {
+                uint32_t nonce = nonceStart + done + n;
+                uint32_t h7 = (uint32_t)_mm_cvtsi128_si32(s1[n]) + sha256_iv[7];
+                if (h7 == 0 && confirmNonce(job, nonce))
+                    appendHit(hits, nonce);
+            }
+            continue;
+        }
+        rounds<2>(s0, s1, m);
+
+        for (int n = 0; n < 2; n++) {
+            __m128i lo, hi;
+            unpackState(_mm_add_epi32(s0[n], iv0), _mm_add_epi32(s1[n], iv1), lo, hi);
+            // Cheap filter on the most significant limb before the full compare
+            uint32_t top = __builtin_bswap32((uint32_t)_mm_extract_epi32(hi, 3));
+            if (top > job.target[0]) continue;
+
+            std::array<uint32_t, 8> hash;
+            _mm_storeu_si128((__m128i*)&hash[0], lo);
+            _mm_storeu_si128((__m128i*)&hash[4], hi);
+            if (meetsTarget(hash, job.target))
+                appendHit(hits, nonceStart + done + n);
+        }
+    }
+
+    if (done < count)
+        scanNoncesScalar(job, nonceStart + done, count - done, hits);
+    return count;
+}
+
+#else
+
+bool shaniAvailable() {
+    return false;
+}
+
+void sha256_compress_shani(const uint8_t* blocks, size_t nblocks, std::array<uint32_t, 8>& state) {
+    for (size_t i = 0; i < nblocks; i++)
+        sha256_compress(blocks + i * 64, state);
+}
+
+uint64_t scanNoncesSHANI(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                         std::vector<uint32_t>& hits) {
+    return scanNoncesScalar(job, nonceStart, count, hits);
+}
+
+#endif
+
+void sha256_shani(const uint8_t* data, size_t len, uint8_t* out) {
+    std::array<uint32_t, 8> state;
+    std::copy(sha256_iv, sha256_iv + 8, state.begin());
+
+    size_t full = len / 64;
+    sha256_compress_shani(data, full, state);
+
+    // Remaining bytes, 0x80 terminator and 64-bit bit length: one or two blocks
+    uint8_t last[128] = {0};
+    size_t rem = len - full * 64;
+    if (rem) memcpy(last, data + full * 64, rem);
+    last[rem] = 0x80;
+    size_t lastLen = rem < 56 ? 64 : 128;
+    uint64_t bits = (uint64_t)len * 8;
+    for (int i = 0; i < 8; i++)
+        last[lastLen - 1 - i] = (bits >> (8 * i)) & 0xff;
+    sha256_compress_shani(last, lastLen / 64, state);
+
+    for (int i = 0; i < 8; i++) {
+        out[i * 4 + 0] = (state[i] >> 24) & 0xff;
+        out[i * 4 + 1] = (state[i] >> 16) & 0xff;
+        out[i * 4 + 2] = (state[i] >> 8) & 0xff;
+        out[i * 4 + 3] = state[i] & 0xff;
+    }
+}
+
+void sha256d_shani(const uint8_t* data, size_t len, uint8_t* out) {
+    uint8_t first[32];
+    sha256_shani(data, len, first);
+    sha256_shani(first, 32, out);
+}
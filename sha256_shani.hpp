@@ -0,0 +1,27 @@
+#ifndef SHA256_SHANI_HPP
+#define SHA256_SHANI_HPP
+
+#include "nonce_scan.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// True if this build has the SHA extension path and the CPU supports it
+// (SHA, SSSE3 and SSE4.1). Callers should check this before preferring the
+// functions below; without it they still work but run the scalar compressor.
+bool shaniAvailable();
+
+// Compress `nblocks` consecutive 64-byte blocks into `state`
+void sha256_compress_shani(const uint8_t* blocks, size_t nblocks, std::array<uint32_t, 8>& state);
+
+// Single and double SHA-256 of an arbitrary message; `out` receives 32 bytes
+void sha256_shani(const uint8_t* data, size_t len, uint8_t* out);
+void sha256d_shani(const uint8_t* data, size_t len, uint8_t* out);
+
+// Scan nonces [nonceStart, nonceStart + count) two headers at a time, with the
+// two SHA-256 streams interleaved to hide sha256rnds2 latency.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+uint64_t scanNoncesSHANI(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                         std::vector<uint32_t>& hits);
+
+#endif // SHA256_SHANI_HPP
@@ -0,0 +1,52 @@
+#include "sha256_simd.hpp"
+
+template <int Lanes>
+uint64_t scanNoncesSIMD(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                        std::vector<uint32_t>& hits) {
+    typedef LaneWord<Lanes> V;
+
+    V laneOffsets{};
+    for (int i = 0; i < Lanes; i++) laneSet(laneOffsets, i, i);
+    const bool earlyExit = earlyExitApplies(job);
+
+    uint32_t done = 0;
+    for (; count - done >= (uint32_t)Lanes; done += Lanes) {
+        V nonces = laneSplat<V>(nonceStart + done) + laneOffsets;
+
+        // First hash from the job's prepared tail; its digest is the second message
+        V w[64];
+        sha256_first_prepared(job.prepared, sha256_bswap(nonces), w);
+
+        if (earlyExit) {
+            V h7 = sha256d_h7_lanes(w);
+            for (int lane = 0; lane < Lanes; lane++) {
+                uint32_t nonce = nonceStart + done + lane;
+                if (laneGet(h7, lane) == 0 && confirmNonce(job, nonce))
+                    hits.push_back(nonce);
+            }
+            continue;
+        }
+
+        V hash[8];
+        sha256d_second_lanes(w, hash);
+
+        // Cheap filter on the most significant limb; full compare only for survivors
+        V top = sha256_bswap(hash[7]);
+        for (int lane = 0; lane < Lanes; lane++) {
+            if (laneGet(top, lane) > job.target[0]) continue;
+            std::array<uint32_t, 8> laneHash;
+            for (int i = 0; i < 8; i++) laneHash[i] = laneGet(hash[i], lane);
+            if (meetsTarget(laneHash, job.target))
+                hits.push_back(nonceStart + done + lane);
+        }
+    }
+
+    if (done < count)
+        scanNoncesScalar(job, nonceStart + done, count - done, hits);
+    return count;
+}
+
+template uint64_t scanNoncesSIMD<1>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+template uint64_t scanNoncesSIMD<4>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+template uint64_t scanNoncesSIMD<8>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+template uint64_t scanNoncesSIMD<16>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
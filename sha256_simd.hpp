@@ -0,0 +1,295 @@
+#ifndef SHA256_SIMD_HPP
+#define SHA256_SIMD_HPP
+
+#include "midstate_utils.hpp"
+#include "nonce_scan.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// SHA-256 round constants and initial hash value. K is aligned for the SHA-NI
+// kernel's 128-bit loads.
+alignas(16) inline constexpr uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline constexpr uint32_t sha256_iv[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// `Lanes` independent 32-bit words as a GCC/Clang vector; one lane is a plain uint32_t.
+// The compiler lowers the vector ops to whatever SIMD the target has (or to scalar code).
+template <int Lanes>
+struct LaneWordImpl {
+    typedef uint32_t type __attribute__((vector_size(Lanes * sizeof(uint32_t))));
+};
+
+template <>
+struct LaneWordImpl<1> {
+    typedef uint32_t type;
+};
+
+template <int Lanes>
+using LaneWord = typename LaneWordImpl<Lanes>::type;
+
+template <class V>
+inline uint32_t laneGet(const V& v, int i) {
+    if constexpr (std::is_same_v<V, uint32_t>) { (void)i; return v; }
+    else return v[i];
+}
+
+template <class V>
+inline void laneSet(V& v, int i, uint32_t x) {
+    if constexpr (std::is_same_v<V, uint32_t>) { (void)i; v = x; }
+    else v[i] = x;
+}
+
+template <class V>
+inline V laneSplat(uint32_t x) {
+    return V{} + x;
+}
+
+// SHA-256 functions, written once for every lane width (and usable in constant expressions)
+template <int N, class V> constexpr V sha256_rotr(V x) { return (x >> N) | (x << (32 - N)); }
+template <class V> constexpr V sha256_ch(V x, V y, V z) { return (x & y) ^ (~x & z); }
+template <class V> constexpr V sha256_maj(V x, V y, V z) { return (x & y) | (z & (x | y)); }
+template <class V> constexpr V sha256_bsig0(V x) { return sha256_rotr<2>(x) ^ sha256_rotr<13>(x) ^ sha256_rotr<22>(x); }
+template <class V> constexpr V sha256_bsig1(V x) { return sha256_rotr<6>(x) ^ sha256_rotr<11>(x) ^ sha256_rotr<25>(x); }
+template <class V> constexpr V sha256_ssig0(V x) { return sha256_rotr<7>(x) ^ sha256_rotr<18>(x) ^ (x >> 3); }
+template <class V> constexpr V sha256_ssig1(V x) { return sha256_rotr<17>(x) ^ sha256_rotr<19>(x) ^ (x >> 10); }
+
+template <class V>
+inline V sha256_bswap(V x) {
+    return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+
+// One SHA-256 compression per lane. w[0..15] must hold the message words;
+// w[16..63] are expanded in place. `state` is updated with the feed-forward.
+template <class V>
+inline void sha256_transform_lanes(V state[8], V w[64]) {
+    for (int i = 16; i < 64; i++) {
+        w[i] = sha256_ssig1(w[i-2]) + w[i-7] + sha256_ssig0(w[i-15]) + w[i-16];
+    }
+
+    V a = state[0], b = state[1], c = state[2], d = state[3];
+    V e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (int i = 0; i < 64; i++) {
+        V T1 = h + sha256_bsig1(e) + sha256_ch(e, f, g) + sha256_k[i] + w[i];
+        V T2 = sha256_bsig0(a) + sha256_maj(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + T1;
+        d = c;
+        c = b;
+        b = a;
+        a = T1 + T2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+// Midstates of `count` contiguous 64-byte prefixes, one prefix per lane of V;
+// a short final group runs one lane at a time.
+template <class V>
+inline void sha256_midstates_lanes(const uint8_t* prefixes, size_t count, std::array<uint32_t, 8>* out) {
+    constexpr size_t lanes = sizeof(V) / sizeof(uint32_t);
+    size_t done = 0;
+    for (; count - done >= lanes; done += lanes) {
+        V w[64], state[8];
+        for (int i = 0; i < 16; i++) {
+            w[i] = V{};
+            for (size_t lane = 0; lane < lanes; lane++) {
+                const uint8_t* p = prefixes + (done + lane) * 64 + i * 4;
+                laneSet(w[i], (int)lane, (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) |
+                                         (uint32_t(p[2]) << 8) | uint32_t(p[3]));
+            }
+        }
+        for (int i = 0; i < 8; i++) state[i] = laneSplat<V>(sha256_iv[i]);
+        sha256_transform_lanes(state, w);
+        for (size_t lane = 0; lane < lanes; lane++)
+            for (int i = 0; i < 8; i++) out[done + lane][i] = laneGet(state[i], (int)lane);
+    }
+    if constexpr (lanes > 1) {
+        if (done < count) sha256_midstates_lanes<uint32_t>(prefixes + done * 64, count - done, out + done);
+    }
+}
+
+// First SHA-256 of a header for the per-lane nonce words `w3`, resuming from the
+// job's PreparedTail at round 3. `out` receives the eight digest words.
+template <class V>
+inline void sha256_first_prepared(const PreparedTail& pt, V w3, V out[8]) {
+    V w[64];
+    w[4] = laneSplat<V>(0x80000000);
+    for (int i = 5; i < 15; i++) w[i] = V{};
+    w[15] = laneSplat<V>(640);
+    w[16] = laneSplat<V>(pt.w16);
+    w[17] = laneSplat<V>(pt.w17);
+    w[18] = laneSplat<V>(pt.w18Base) + sha256_ssig0(w3);
+    w[19] = laneSplat<V>(pt.w19Base) + w3;
+    for (int i = 20; i < 64; i++) {
+        w[i] = sha256_ssig1(w[i-2]) + w[i-7] + sha256_ssig0(w[i-15]) + w[i-16];
+    }
+
+    // Finish round 3 with the nonce word
+    V a = laneSplat<V>(pt.t1Base + pt.t2) + w3;
+    V b = laneSplat<V>(pt.state[0]), c = laneSplat<V>(pt.state[1]), d = laneSplat<V>(pt.state[2]);
+    V e = laneSplat<V>(pt.state[3] + pt.t1Base) + w3;
+    V f = laneSplat<V>(pt.state[4]), g = laneSplat<V>(pt.state[5]), h = laneSplat<V>(pt.state[6]);
+
+    for (int i = 4; i < 64; i++) {
+        V T1 = h + sha256_bsig1(e) + sha256_ch(e, f, g) + sha256_k[i] + w[i];
+        V T2 = sha256_bsig0(a) + sha256_maj(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + T1;
+        d = c;
+        c = b;
+        b = a;
+        a = T1 + T2;
+    }
+
+    out[0] = a + pt.midstate[0];
+    out[1] = b + pt.midstate[1];
+    out[2] = c + pt.midstate[2];
+    out[3] = d + pt.midstate[3];
+    out[4] = e + pt.midstate[4];
+    out[5] = f + pt.midstate[5];
+    out[6] = g + pt.midstate[6];
+    out[7] = h + pt.midstate[7];
+}
+
+// The second SHA-256 of a double hash always compresses a 32-byte digest from the IV,
+// so W8..W15 are fixed padding (0x80000000, six zeros, 256) and round 0 sees a constant
+// state. The constants below fold that shape in at compile time.
+constexpr uint32_t sha256d_pad_word(int i) {
+    return i == 8 ? 0x80000000 : i == 15 ? 256 : 0;
+}
+
+// K+W for rounds 8..15, where W is padding
+inline constexpr uint32_t sha256d_kw_pad[8] = {
+    sha256_k[8] + sha256d_pad_word(8),   sha256_k[9],  sha256_k[10], sha256_k[11],
+    sha256_k[12], sha256_k[13], sha256_k[14], sha256_k[15] + sha256d_pad_word(15)
+};
+
+// Round 0 from the IV without its W0 term: a1 = sha256d_round0_a + W0, e1 = sha256d_round0_e + W0
+inline constexpr uint32_t sha256d_round0_t1 =
+    sha256_iv[7] + sha256_bsig1(sha256_iv[4]) + sha256_ch(sha256_iv[4], sha256_iv[5], sha256_iv[6]) + sha256_k[0];
+inline constexpr uint32_t sha256d_round0_a =
+    sha256d_round0_t1 + sha256_bsig0(sha256_iv[0]) + sha256_maj(sha256_iv[0], sha256_iv[1], sha256_iv[2]);
+inline constexpr uint32_t sha256d_round0_e = sha256_iv[3] + sha256d_round0_t1;
+
+// Schedule terms that only read padding words
+inline constexpr uint32_t sha256d_w17_const = sha256_ssig1(sha256d_pad_word(15));
+inline constexpr uint32_t sha256d_w23_const = sha256_ssig0(sha256d_pad_word(8));
+inline constexpr uint32_t sha256d_w30_const = sha256_ssig0(sha256d_pad_word(15));
+
+// Message schedule of the second hash up to word `Last`. w[0..7] hold the digest;
+// W16..W31 only keep the terms that are not padding (most of W8..W15 is zero).
+template <int Last, class V>
+inline void sha256d_second_schedule(V w[64]) {
+    static_assert(Last >= 31 && Last < 64);
+    w[16] = sha256_ssig0(w[1]) + w[0];
+    w[17] = sha256_ssig0(w[2]) + w[1] + sha256d_w17_const;
+    w[18] = sha256_ssig1(w[16]) + sha256_ssig0(w[3]) + w[2];
+    w[19] = sha256_ssig1(w[17]) + sha256_ssig0(w[4]) + w[3];
+    w[20] = sha256_ssig1(w[18]) + sha256_ssig0(w[5]) + w[4];
+    w[21] = sha256_ssig1(w[19]) + sha256_ssig0(w[6]) + w[5];
+    w[22] = sha256_ssig1(w[20]) + sha256_ssig0(w[7]) + w[6] + sha256d_pad_word(15);
+    w[23] = sha256_ssig1(w[21]) + w[16] + w[7] + sha256d_w23_const;
+    w[24] = sha256_ssig1(w[22]) + w[17] + sha256d_pad_word(8);
+    for (int i = 25; i < 30; i++) w[i] = sha256_ssig1(w[i-2]) + w[i-7];
+    w[30] = sha256_ssig1(w[28]) + w[23] + sha256d_w30_const;
+    w[31] = sha256_ssig1(w[29]) + w[24] + sha256_ssig0(w[16]) + sha256d_pad_word(15);
+    for (int i = 32; i <= Last; i++) {
+        w[i] = sha256_ssig1(w[i-2]) + w[i-7] + sha256_ssig0(w[i-15]) + w[i-16];
+    }
+}
+
+// Rounds 0..Last of the second hash; s[0..7] receive the working variables a..h
+// (no feed-forward). Round 0 starts from the folded IV state and rounds 8..15
+// add the constant K+W sums instead of reading the schedule.
+template <int Last, class V>
+inline void sha256d_second_rounds(V w[64], V s[8]) {
+    sha256d_second_schedule<Last>(w);
+
+    V a = laneSplat<V>(sha256d_round0_a) + w[0], b = laneSplat<V>(sha256_iv[0]);
+    V c = laneSplat<V>(sha256_iv[1]), d = laneSplat<V>(sha256_iv[2]);
+    V e = laneSplat<V>(sha256d_round0_e) + w[0], f = laneSplat<V>(sha256_iv[4]);
+    V g = laneSplat<V>(sha256_iv[5]), h = laneSplat<V>(sha256_iv[6]);
+
+    auto round = [&](V kw) {
+        V T1 = h + sha256_bsig1(e) + sha256_ch(e, f, g) + kw;
+        V T2 = sha256_bsig0(a) + sha256_maj(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + T1;
+        d = c;
+        c = b;
+        b = a;
+        a = T1 + T2;
+    };
+    for (int i = 1; i < 8; i++) round(w[i] + sha256_k[i]);
+    for (int i = 8; i < 16; i++) round(laneSplat<V>(sha256d_kw_pad[i - 8]));
+    for (int i = 16; i <= Last; i++) round(w[i] + sha256_k[i]);
+
+    s[0] = a; s[1] = b; s[2] = c; s[3] = d;
+    s[4] = e; s[5] = f; s[6] = g; s[7] = h;
+}
+
+// Full second SHA-256 of a double hash; w[0..7] hold the first digest
+template <class V>
+inline void sha256d_second_lanes(V w[64], V out[8]) {
+    sha256d_second_rounds<63>(w, out);
+    for (int i = 0; i < 8; i++) out[i] += sha256_iv[i];
+}
+
+// Second SHA-256 stopped as soon as H7 is known. H7 is IV7 plus the `e` produced
+// by round 60, so rounds 61..63, their schedule words and the other seven output
+// words are never computed.
+template <class V>
+inline V sha256d_h7_lanes(V w[64]) {
+    V s[8];
+    sha256d_second_rounds<60>(w, s);
+    return s[4] + sha256_iv[7];
+}
+
+// Scan nonces [nonceStart, nonceStart + count) `Lanes` at a time with the portable core.
+// Appends every nonce meeting the target to `hits` and returns the number of hashes done.
+template <int Lanes>
+uint64_t scanNoncesSIMD(const ScanJob& job, uint32_t nonceStart, uint32_t count,
+                        std::vector<uint32_t>& hits);
+
+extern template uint64_t scanNoncesSIMD<1>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+extern template uint64_t scanNoncesSIMD<4>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+extern template uint64_t scanNoncesSIMD<8>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+extern template uint64_t scanNoncesSIMD<16>(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+
+#endif // SHA256_SIMD_HPP
@@ -0,0 +1,124 @@
+#ifndef SHA256_TABLES_HPP
+#define SHA256_TABLES_HPP
+
+#include "sha256_simd.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Compile-time SHA-256 building blocks: sigma lookup tables and fully unrolled
+// rounds, instantiated per lane width, sigma implementation and folding level.
+// They replace the Python generators (gen_*_lut.py, generate_unrolled_sha256.py).
+
+// The sigma functions are linear over GF(2), so sigma(x) is the XOR of sigma over
+// x's 12-bit chunks: chunk[c][v] = sigma(v << 12c). chunk[0] is the 4096-entry
+// table the generators used to emit.
+struct SigmaTable {
+    uint32_t chunk[3][4096];
+};
+
+template <uint32_t (*Sigma)(uint32_t)>
+constexpr SigmaTable makeSigmaTable() {
+    SigmaTable table{};
+    for (int c = 0; c < 3; c++)
+        for (uint32_t v = 0; v < (c == 2 ? 256u : 4096u); v++)   // the top chunk has 8 bits
+            table.chunk[c][v] = Sigma(v << (12 * c));
+    return table;
+}
+
+inline constexpr SigmaTable ssig0Table = makeSigmaTable<sha256_ssig0<uint32_t>>();
+inline constexpr SigmaTable ssig1Table = makeSigmaTable<sha256_ssig1<uint32_t>>();
+inline constexpr SigmaTable bsig0Table = makeSigmaTable<sha256_bsig0<uint32_t>>();
+inline constexpr SigmaTable bsig1Table = makeSigmaTable<sha256_bsig1<uint32_t>>();
+
+static_assert((ssig0Table.chunk[0][0x123] ^ ssig0Table.chunk[1][0x456] ^ ssig0Table.chunk[2][0x78]) ==
+              sha256_ssig0(0x78456123u));
+static_assert((bsig1Table.chunk[0][0xfff] ^ bsig1Table.chunk[1][0xfff] ^ bsig1Table.chunk[2][0xff]) ==
+              sha256_bsig1(0xffffffffu));
+
+// sigma(x) by three table lookups per lane; AVX2 builds gather eight lanes at once
+template <class V>
+inline V sigmaLookup(const SigmaTable& t, V x) {
+    if constexpr (std::is_same_v<V, uint32_t>) {
+        return t.chunk[0][x & 0xfff] ^ t.chunk[1][(x >> 12) & 0xfff] ^ t.chunk[2][x >> 24];
+    }
+#if defined(__AVX2__)
+    else if constexpr (sizeof(V) == 32) {
+        __m256i v = (__m256i)x, mask = _mm256_set1_epi32(0xfff);
+        __m256i lo = _mm256_i32gather_epi32((const int*)t.chunk[0], _mm256_and_si256(v, mask), 4);
+        __m256i mid = _mm256_i32gather_epi32((const int*)t.chunk[1],
+                                             _mm256_and_si256(_mm256_srli_epi32(v, 12), mask), 4);
+        __m256i hi = _mm256_i32gather_epi32((const int*)t.chunk[2], _mm256_srli_epi32(v, 24), 4);
+        return (V)_mm256_xor_si256(_mm256_xor_si256(lo, mid), hi);
+    }
+#endif
+    else {
+        V r;
+        for (size_t i = 0; i < sizeof(V) / sizeof(uint32_t); i++)
+            r[i] = t.chunk[0][x[i] & 0xfff] ^ t.chunk[1][(x[i] >> 12) & 0xfff] ^ t.chunk[2][x[i] >> 24];
+        return r;
+    }
+}
+
+// Sigma implementations for the unrolled transform
+struct RotateSigma {
+    template <class V> static V ssig0(V x) { return sha256_ssig0(x); }
+    template <class V> static V ssig1(V x) { return sha256_ssig1(x); }
+    template <class V> static V bsig0(V x) { return sha256_bsig0(x); }
+    template <class V> static V bsig1(V x) { return sha256_bsig1(x); }
+};
+
+struct TableSigma {
+    template <class V> static V ssig0(V x) { return sigmaLookup(ssig0Table, x); }
+    template <class V> static V ssig1(V x) { return sigmaLookup(ssig1Table, x); }
+    template <class V> static V bsig0(V x) { return sigmaLookup(bsig0Table, x); }
+    template <class V> static V bsig1(V x) { return sigmaLookup(bsig1Table, x); }
+};
+
+// Round `Round` with its K as a compile-time constant
+template <int Round, class Sigma, class V>
+inline void sha256_round_unrolled(V s[8], V w) {
+    V T1 = s[7] + Sigma::bsig1(s[4]) + sha256_ch(s[4], s[5], s[6]) + sha256_k[Round] + w;
+    V T2 = Sigma::bsig0(s[0]) + sha256_maj(s[0], s[1], s[2]);
+    s[7] = s[6];
+    s[6] = s[5];
+    s[5] = s[4];
+    s[4] = s[3] + T1;
+    s[3] = s[2];
+    s[2] = s[1];
+    s[1] = s[0];
+    s[0] = T1 + T2;
+}
+
+// Folding levels for sha256_transform_unrolled
+enum class Sha256Fold {
+    None,      // any block: w[0..15] are all message words
+    Padding,   // second hash of a double SHA-256: w[8..15] are the fixed padding
+};
+
+// sha256_transform_lanes with the schedule and all 64 rounds unrolled at compile
+// time. With Sha256Fold::Padding the padding words are constants, so their K+W
+// sums and schedule terms fold away; w[8..15] are ignored on input.
+template <class Sigma, Sha256Fold Fold, class V>
+inline void sha256_transform_unrolled(V state[8], V w[64]) {
+    if constexpr (Fold == Sha256Fold::Padding)
+        for (int i = 8; i < 16; i++) w[i] = laneSplat<V>(sha256d_pad_word(i));
+
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((w[I + 16] = Sigma::ssig1(w[I + 14]) + w[I + 9] + Sigma::ssig0(w[I + 1]) + w[I]), ...);
+    }(std::make_index_sequence<48>{});
+
+    V s[8];
+    for (int i = 0; i < 8; i++) s[i] = state[i];
+    [&]<size_t... R>(std::index_sequence<R...>) {
+        (sha256_round_unrolled<R, Sigma>(s, w[R]), ...);
+    }(std::make_index_sequence<64>{});
+    for (int i = 0; i < 8; i++) state[i] += s[i];
+}
+
+#endif // SHA256_TABLES_HPP
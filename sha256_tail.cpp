@@ -1,4 +1,5 @@
 #include "sha256_compress.hpp"
+#include "sha256_shani.hpp"
 #include <array>
 #include <cstdint>
 #include <cstring>
@@ -6,7 +7,10 @@
 // Compute SHA256 hash given a midstate and tail (last 64 bytes + padding)
 void sha256_from_midstate(const std::array<uint32_t, 8>& midstate, const uint8_t tail[64], uint8_t hash_out[32]) {
     std::array<uint32_t, 8> state = midstate;
-    sha256_compress(tail, state);
+    if (shaniAvailable())
+        sha256_compress_shani(tail, 1, state);
+    else
+        sha256_compress(tail, state);
 
     for (int i = 0; i < 8; i++) {
         hash_out[i * 4 + 0] = (state[i] >> 24) & 0xff;
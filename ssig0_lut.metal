@@ -1,514 +0,0 @@
-constant uint SSIG0_LUT[4096] = {
-    0x00000000, 0x02004000, 0x04008000, 0x0600c000, 0x08010000, 0x0a014000, 0x0c018000, 0x0e01c000, 
-    0x10020001, 0x12024001, 0x14028001, 0x1602c001, 0x18030001, 0x1a034001, 0x1c038001, 0x1e03c001, 
-    0x20040002, 0x22044002, 0x24048002, 0x2604c002, 0x28050002, 0x2a054002, 0x2c058002, 0x2e05c002, 
-    0x30060003, 0x32064003, 0x34068003, 0x3606c003, 0x38070003, 0x3a074003, 0x3c078003, 0x3e07c003, 
-    0x40080004, 0x42084004, 0x44088004, 0x4608c004, 0x48090004, 0x4a094004, 0x4c098004, 0x4e09c004, 
-    0x500a0005, 0x520a4005, 0x540a8005, 0x560ac005, 0x580b0005, 0x5a0b4005, 0x5c0b8005, 0x5e0bc005, 
-    0x600c0006, 0x620c4006, 0x640c8006, 0x660cc006, 0x680d0006, 0x6a0d4006, 0x6c0d8006, 0x6e0dc006, 
-    0x700e0007, 0x720e4007, 0x740e8007, 0x760ec007, 0x780f0007, 0x7a0f4007, 0x7c0f8007, 0x7e0fc007, 
-    0x80100008, 0x82104008, 0x84108008, 0x8610c008, 0x88110008, 0x8a114008, 0x8c118008, 0x8e11c008, 
-    0x90120009, 0x92124009, 0x94128009, 0x9612c009, 0x98130009, 0x9a134009, 0x9c138009, 0x9e13c009, 
-    0xa014000a, 0xa214400a, 0xa414800a, 0xa614c00a, 0xa815000a, 0xaa15400a, 0xac15800a, 0xae15c00a, 
-    0xb016000b, 0xb216400b, 0xb416800b, 0xb616c00b, 0xb817000b, 0xba17400b, 0xbc17800b, 0xbe17c00b, 
-    0xc018000c, 0xc218400c, 0xc418800c, 0xc618c00c, 0xc819000c, 0xca19400c, 0xcc19800c, 0xce19c00c, 
-    0xd01a000d, 0xd21a400d, 0xd41a800d, 0xd61ac00d, 0xd81b000d, 0xda1b400d, 0xdc1b800d, 0xde1bc00d, 
-    0xe01c000e, 0xe21c400e, 0xe41c800e, 0xe61cc00e, 0xe81d000e, 0xea1d400e, 0xec1d800e, 0xee1dc00e, 
-    0xf01e000f, 0xf21e400f, 0xf41e800f, 0xf61ec00f, 0xf81f000f, 0xfa1f400f, 0xfc1f800f, 0xfe1fc00f, 
-    0x00200011, 0x02204011, 0x04208011, 0x0620c011, 0x08210011, 0x0a214011, 0x0c218011, 0x0e21c011, 
-    0x10220010, 0x12224010, 0x14228010, 0x1622c010, 0x18230010, 0x1a234010, 0x1c238010, 0x1e23c010, 
-    0x20240013, 0x22244013, 0x24248013, 0x2624c013, 0x28250013, 0x2a254013, 0x2c258013, 0x2e25c013, 
-    0x30260012, 0x32264012, 0x34268012, 0x3626c012, 0x38270012, 0x3a274012, 0x3c278012, 0x3e27c012, 
-    0x40280015, 0x42284015, 0x44288015, 0x4628c015, 0x48290015, 0x4a294015, 0x4c298015, 0x4e29c015, 
-    0x502a0014, 0x522a4014, 0x542a8014, 0x562ac014, 0x582b0014, 0x5a2b4014, 0x5c2b8014, 0x5e2bc014, 
-    0x602c0017, 0x622c4017, 0x642c8017, 0x662cc017, 0x682d0017, 0x6a2d4017, 0x6c2d8017, 0x6e2dc017, 
-    0x702e0016, 0x722e4016, 0x742e8016, 0x762ec016, 0x782f0016, 0x7a2f4016, 0x7c2f8016, 0x7e2fc016, 
-    0x80300019, 0x82304019, 0x84308019, 0x8630c019, 0x88310019, 0x8a314019, 0x8c318019, 0x8e31c019, 
-    0x90320018, 0x92324018, 0x94328018, 0x9632c018, 0x98330018, 0x9a334018, 0x9c338018, 0x9e33c018, 
-    0xa034001b, 0xa234401b, 0xa434801b, 0xa634c01b, 0xa835001b, 0xaa35401b, 0xac35801b, 0xae35c01b, 
-    0xb036001a, 0xb236401a, 0xb436801a, 0xb636c01a, 0xb837001a, 0xba37401a, 0xbc37801a, 0xbe37c01a, 
-    0xc038001d, 0xc238401d, 0xc438801d, 0xc638c01d, 0xc839001d, 0xca39401d, 0xcc39801d, 0xce39c01d, 
-    0xd03a001c, 0xd23a401c, 0xd43a801c, 0xd63ac01c, 0xd83b001c, 0xda3b401c, 0xdc3b801c, 0xde3bc01c, 
-    0xe03c001f, 0xe23c401f, 0xe43c801f, 0xe63cc01f, 0xe83d001f, 0xea3d401f, 0xec3d801f, 0xee3dc01f, 
-    0xf03e001e, 0xf23e401e, 0xf43e801e, 0xf63ec01e, 0xf83f001e, 0xfa3f401e, 0xfc3f801e, 0xfe3fc01e, 
-    0x00400022, 0x02404022, 0x04408022, 0x0640c022, 0x08410022, 0x0a414022, 0x0c418022, 0x0e41c022, 
-    0x10420023, 0x12424023, 0x14428023, 0x1642c023, 0x18430023, 0x1a434023, 0x1c438023, 0x1e43c023, 
-    0x20440020, 0x22444020, 0x24448020, 0x2644c020, 0x28450020, 0x2a454020, 0x2c458020, 0x2e45c020, 
-    0x30460021, 0x32464021, 0x34468021, 0x3646c021, 0x38470021, 0x3a474021, 0x3c478021, 0x3e47c021, 
-    0x40480026, 0x42484026, 0x44488026, 0x4648c026, 0x48490026, 0x4a494026, 0x4c498026, 0x4e49c026, 
-    0x504a0027, 0x524a4027, 0x544a8027, 0x564ac027, 0x584b0027, 0x5a4b4027, 0x5c4b8027, 0x5e4bc027, 
-    0x604c0024, 0x624c4024, 0x644c8024, 0x664cc024, 0x684d0024, 0x6a4d4024, 0x6c4d8024, 0x6e4dc024, 
-    0x704e0025, 0x724e4025, 0x744e8025, 0x764ec025, 0x784f0025, 0x7a4f4025, 0x7c4f8025, 0x7e4fc025, 
-    0x8050002a, 0x8250402a, 0x8450802a, 0x8650c02a, 0x8851002a, 0x8a51402a, 0x8c51802a, 0x8e51c02a, 
-    0x9052002b, 0x9252402b, 0x9452802b, 0x9652c02b, 0x9853002b, 0x9a53402b, 0x9c53802b, 0x9e53c02b, 
-    0xa0540028, 0xa2544028, 0xa4548028, 0xa654c028, 0xa8550028, 0xaa554028, 0xac558028, 0xae55c028, 
-    0xb0560029, 0xb2564029, 0xb4568029, 0xb656c029, 0xb8570029, 0xba574029, 0xbc578029, 0xbe57c029, 
-    0xc058002e, 0xc258402e, 0xc458802e, 0xc658c02e, 0xc859002e, 0xca59402e, 0xcc59802e, 0xce59c02e, 
-    0xd05a002f, 0xd25a402f, 0xd45a802f, 0xd65ac02f, 0xd85b002f, 0xda5b402f, 0xdc5b802f, 0xde5bc02f, 
-    0xe05c002c, 0xe25c402c, 0xe45c802c, 0xe65cc02c, 0xe85d002c, 0xea5d402c, 0xec5d802c, 0xee5dc02c, 
-    0xf05e002d, 0xf25e402d, 0xf45e802d, 0xf65ec02d, 0xf85f002d, 0xfa5f402d, 0xfc5f802d, 0xfe5fc02d, 
-    0x00600033, 0x02604033, 0x04608033, 0x0660c033, 0x08610033, 0x0a614033, 0x0c618033, 0x0e61c033, 
-    0x10620032, 0x12624032, 0x14628032, 0x1662c032, 0x18630032, 0x1a634032, 0x1c638032, 0x1e63c032, 
-    0x20640031, 0x22644031, 0x24648031, 0x2664c031, 0x28650031, 0x2a654031, 0x2c658031, 0x2e65c031, 
-    0x30660030, 0x32664030, 0x34668030, 0x3666c030, 0x38670030, 0x3a674030, 0x3c678030, 0x3e67c030, 
-    0x40680037, 0x42684037, 0x44688037, 0x4668c037, 0x48690037, 0x4a694037, 0x4c698037, 0x4e69c037, 
-    0x506a0036, 0x526a4036, 0x546a8036, 0x566ac036, 0x586b0036, 0x5a6b4036, 0x5c6b8036, 0x5e6bc036, 
-    0x606c0035, 0x626c4035, 0x646c8035, 0x666cc035, 0x686d0035, 0x6a6d4035, 0x6c6d8035, 0x6e6dc035, 
-    0x706e0034, 0x726e4034, 0x746e8034, 0x766ec034, 0x786f0034, 0x7a6f4034, 0x7c6f8034, 0x7e6fc034, 
-    0x8070003b, 0x8270403b, 0x8470803b, 0x8670c03b, 0x8871003b, 0x8a71403b, 0x8c71803b, 0x8e71c03b, 
-    0x9072003a, 0x9272403a, 0x9472803a, 0x9672c03a, 0x9873003a, 0x9a73403a, 0x9c73803a, 0x9e73c03a, 
-    0xa0740039, 0xa2744039, 0xa4748039, 0xa674c039, 0xa8750039, 0xaa754039, 0xac758039, 0xae75c039, 
-    0xb0760038, 0xb2764038, 0xb4768038, 0xb676c038, 0xb8770038, 0xba774038, 0xbc778038, 0xbe77c038, 
-    0xc078003f, 0xc278403f, 0xc478803f, 0xc678c03f, 0xc879003f, 0xca79403f, 0xcc79803f, 0xce79c03f, 
-    0xd07a003e, 0xd27a403e, 0xd47a803e, 0xd67ac03e, 0xd87b003e, 0xda7b403e, 0xdc7b803e, 0xde7bc03e, 
-    0xe07c003d, 0xe27c403d, 0xe47c803d, 0xe67cc03d, 0xe87d003d, 0xea7d403d, 0xec7d803d, 0xee7dc03d, 
-    0xf07e003c, 0xf27e403c, 0xf47e803c, 0xf67ec03c, 0xf87f003c, 0xfa7f403c, 0xfc7f803c, 0xfe7fc03c, 
-    0x00800044, 0x02804044, 0x04808044, 0x0680c044, 0x08810044, 0x0a814044, 0x0c818044, 0x0e81c044, 
-    0x10820045, 0x12824045, 0x14828045, 0x1682c045, 0x18830045, 0x1a834045, 0x1c838045, 0x1e83c045, 
-    0x20840046, 0x22844046, 0x24848046, 0x2684c046, 0x28850046, 0x2a854046, 0x2c858046, 0x2e85c046, 
-    0x30860047, 0x32864047, 0x34868047, 0x3686c047, 0x38870047, 0x3a874047, 0x3c878047, 0x3e87c047, 
-    0x40880040, 0x42884040, 0x44888040, 0x4688c040, 0x48890040, 0x4a894040, 0x4c898040, 0x4e89c040, 
-    0x508a0041, 0x528a4041, 0x548a8041, 0x568ac041, 0x588b0041, 0x5a8b4041, 0x5c8b8041, 0x5e8bc041, 
-    0x608c0042, 0x628c4042, 0x648c8042, 0x668cc042, 0x688d0042, 0x6a8d4042, 0x6c8d8042, 0x6e8dc042, 
-    0x708e0043, 0x728e4043, 0x748e8043, 0x768ec043, 0x788f0043, 0x7a8f4043, 0x7c8f8043, 0x7e8fc043, 
-    0x8090004c, 0x8290404c, 0x8490804c, 0x8690c04c, 0x8891004c, 0x8a91404c, 0x8c91804c, 0x8e91c04c, 
-    0x9092004d, 0x9292404d, 0x9492804d, 0x9692c04d, 0x9893004d, 0x9a93404d, 0x9c93804d, 0x9e93c04d, 
-    0xa094004e, 0xa294404e, 0xa494804e, 0xa694c04e, 0xa895004e, 0xaa95404e, 0xac95804e, 0xae95c04e, 
-    0xb096004f, 0xb296404f, 0xb496804f, 0xb696c04f, 0xb897004f, 0xba97404f, 0xbc97804f, 0xbe97c04f, 
-    0xc0980048, 0xc2984048, 0xc4988048, 0xc698c048, 0xc8990048, 0xca994048, 0xcc998048, 0xce99c048, 
-    0xd09a0049, 0xd29a4049, 0xd49a8049, 0xd69ac049, 0xd89b0049, 0xda9b4049, 0xdc9b8049, 0xde9bc049, 
-    0xe09c004a, 0xe29c404a, 0xe49c804a, 0xe69cc04a, 0xe89d004a, 0xea9d404a, 0xec9d804a, 0xee9dc04a, 
-    0xf09e004b, 0xf29e404b, 0xf49e804b, 0xf69ec04b, 0xf89f004b, 0xfa9f404b, 0xfc9f804b, 0xfe9fc04b, 
-    0x00a00055, 0x02a04055, 0x04a08055, 0x06a0c055, 0x08a10055, 0x0aa14055, 0x0ca18055, 0x0ea1c055, 
-    0x10a20054, 0x12a24054, 0x14a28054, 0x16a2c054, 0x18a30054, 0x1aa34054, 0x1ca38054, 0x1ea3c054, 
-    0x20a40057, 0x22a44057, 0x24a48057, 0x26a4c057, 0x28a50057, 0x2aa54057, 0x2ca58057, 0x2ea5c057, 
-    0x30a60056, 0x32a64056, 0x34a68056, 0x36a6c056, 0x38a70056, 0x3aa74056, 0x3ca78056, 0x3ea7c056, 
-    0x40a80051, 0x42a84051, 0x44a88051, 0x46a8c051, 0x48a90051, 0x4aa94051, 0x4ca98051, 0x4ea9c051, 
-    0x50aa0050, 0x52aa4050, 0x54aa8050, 0x56aac050, 0x58ab0050, 0x5aab4050, 0x5cab8050, 0x5eabc050, 
-    0x60ac0053, 0x62ac4053, 0x64ac8053, 0x66acc053, 0x68ad0053, 0x6aad4053, 0x6cad8053, 0x6eadc053, 
-    0x70ae0052, 0x72ae4052, 0x74ae8052, 0x76aec052, 0x78af0052, 0x7aaf4052, 0x7caf8052, 0x7eafc052, 
-    0x80b0005d, 0x82b0405d, 0x84b0805d, 0x86b0c05d, 0x88b1005d, 0x8ab1405d, 0x8cb1805d, 0x8eb1c05d, 
-    0x90b2005c, 0x92b2405c, 0x94b2805c, 0x96b2c05c, 0x98b3005c, 0x9ab3405c, 0x9cb3805c, 0x9eb3c05c, 
-    0xa0b4005f, 0xa2b4405f, 0xa4b4805f, 0xa6b4c05f, 0xa8b5005f, 0xaab5405f, 0xacb5805f, 0xaeb5c05f, 
-    0xb0b6005e, 0xb2b6405e, 0xb4b6805e, 0xb6b6c05e, 0xb8b7005e, 0xbab7405e, 0xbcb7805e, 0xbeb7c05e, 
-    0xc0b80059, 0xc2b84059, 0xc4b88059, 0xc6b8c059, 0xc8b90059, 0xcab94059, 0xccb98059, 0xceb9c059, 
-    0xd0ba0058, 0xd2ba4058, 0xd4ba8058, 0xd6bac058, 0xd8bb0058, 0xdabb4058, 0xdcbb8058, 0xdebbc058, 
-    0xe0bc005b, 0xe2bc405b, 0xe4bc805b, 0xe6bcc05b, 0xe8bd005b, 0xeabd405b, 0xecbd805b, 0xeebdc05b, 
-    0xf0be005a, 0xf2be405a, 0xf4be805a, 0xf6bec05a, 0xf8bf005a, 0xfabf405a, 0xfcbf805a, 0xfebfc05a, 
-    0x00c00066, 0x02c04066, 0x04c08066, 0x06c0c066, 0x08c10066, 0x0ac14066, 0x0cc18066, 0x0ec1c066, 
-    0x10c20067, 0x12c24067, 0x14c28067, 0x16c2c067, 0x18c30067, 0x1ac34067, 0x1cc38067, 0x1ec3c067, 
-    0x20c40064, 0x22c44064, 0x24c48064, 0x26c4c064, 0x28c50064, 0x2ac54064, 0x2cc58064, 0x2ec5c064, 
-    0x30c60065, 0x32c64065, 0x34c68065, 0x36c6c065, 0x38c70065, 0x3ac74065, 0x3cc78065, 0x3ec7c065, 
-    0x40c80062, 0x42c84062, 0x44c88062, 0x46c8c062, 0x48c90062, 0x4ac94062, 0x4cc98062, 0x4ec9c062, 
-    0x50ca0063, 0x52ca4063, 0x54ca8063, 0x56cac063, 0x58cb0063, 0x5acb4063, 0x5ccb8063, 0x5ecbc063, 
-    0x60cc0060, 0x62cc4060, 0x64cc8060, 0x66ccc060, 0x68cd0060, 0x6acd4060, 0x6ccd8060, 0x6ecdc060, 
-    0x70ce0061, 0x72ce4061, 0x74ce8061, 0x76cec061, 0x78cf0061, 0x7acf4061, 0x7ccf8061, 0x7ecfc061, 
-    0x80d0006e, 0x82d0406e, 0x84d0806e, 0x86d0c06e, 0x88d1006e, 0x8ad1406e, 0x8cd1806e, 0x8ed1c06e, 
-    0x90d2006f, 0x92d2406f, 0x94d2806f, 0x96d2c06f, 0x98d3006f, 0x9ad3406f, 0x9cd3806f, 0x9ed3c06f, 
-    0xa0d4006c, 0xa2d4406c, 0xa4d4806c, 0xa6d4c06c, 0xa8d5006c, 0xaad5406c, 0xacd5806c, 0xaed5c06c, 
-    0xb0d6006d, 0xb2d6406d, 0xb4d6806d, 0xb6d6c06d, 0xb8d7006d, 0xbad7406d, 0xbcd7806d, 0xbed7c06d, 
-    0xc0d8006a, 0xc2d8406a, 0xc4d8806a, 0xc6d8c06a, 0xc8d9006a, 0xcad9406a, 0xccd9806a, 0xced9c06a, 
-    0xd0da006b, 0xd2da406b, 0xd4da806b, 0xd6dac06b, 0xd8db006b, 0xdadb406b, 0xdcdb806b, 0xdedbc06b, 
-    0xe0dc0068, 0xe2dc4068, 0xe4dc8068, 0xe6dcc068, 0xe8dd0068, 0xeadd4068, 0xecdd8068, 0xeeddc068, 
-    0xf0de0069, 0xf2de4069, 0xf4de8069, 0xf6dec069, 0xf8df0069, 0xfadf4069, 0xfcdf8069, 0xfedfc069, 
-    0x00e00077, 0x02e04077, 0x04e08077, 0x06e0c077, 0x08e10077, 0x0ae14077, 0x0ce18077, 0x0ee1c077, 
-    0x10e20076, 0x12e24076, 0x14e28076, 0x16e2c076, 0x18e30076, 0x1ae34076, 0x1ce38076, 0x1ee3c076, 
-    0x20e40075, 0x22e44075, 0x24e48075, 0x26e4c075, 0x28e50075, 0x2ae54075, 0x2ce58075, 0x2ee5c075, 
-    0x30e60074, 0x32e64074, 0x34e68074, 0x36e6c074, 0x38e70074, 0x3ae74074, 0x3ce78074, 0x3ee7c074, 
-    0x40e80073, 0x42e84073, 0x44e88073, 0x46e8c073, 0x48e90073, 0x4ae94073, 0x4ce98073, 0x4ee9c073, 
-    0x50ea0072, 0x52ea4072, 0x54ea8072, 0x56eac072, 0x58eb0072, 0x5aeb4072, 0x5ceb8072, 0x5eebc072, 
-    0x60ec0071, 0x62ec4071, 0x64ec8071, 0x66ecc071, 0x68ed0071, 0x6aed4071, 0x6ced8071, 0x6eedc071, 
-    0x70ee0070, 0x72ee4070, 0x74ee8070, 0x76eec070, 0x78ef0070, 0x7aef4070, 0x7cef8070, 0x7eefc070, 
-    0x80f0007f, 0x82f0407f, 0x84f0807f, 0x86f0c07f, 0x88f1007f, 0x8af1407f, 0x8cf1807f, 0x8ef1c07f, 
-    0x90f2007e, 0x92f2407e, 0x94f2807e, 0x96f2c07e, 0x98f3007e, 0x9af3407e, 0x9cf3807e, 0x9ef3c07e, 
-    0xa0f4007d, 0xa2f4407d, 0xa4f4807d, 0xa6f4c07d, 0xa8f5007d, 0xaaf5407d, 0xacf5807d, 0xaef5c07d, 
-    0xb0f6007c, 0xb2f6407c, 0xb4f6807c, 0xb6f6c07c, 0xb8f7007c, 0xbaf7407c, 0xbcf7807c, 0xbef7c07c, 
-    0xc0f8007b, 0xc2f8407b, 0xc4f8807b, 0xc6f8c07b, 0xc8f9007b, 0xcaf9407b, 0xccf9807b, 0xcef9c07b, 
-    0xd0fa007a, 0xd2fa407a, 0xd4fa807a, 0xd6fac07a, 0xd8fb007a, 0xdafb407a, 0xdcfb807a, 0xdefbc07a, 
-    0xe0fc0079, 0xe2fc4079, 0xe4fc8079, 0xe6fcc079, 0xe8fd0079, 0xeafd4079, 0xecfd8079, 0xeefdc079, 
-    0xf0fe0078, 0xf2fe4078, 0xf4fe8078, 0xf6fec078, 0xf8ff0078, 0xfaff4078, 0xfcff8078, 0xfeffc078, 
-    0x01000088, 0x03004088, 0x05008088, 0x0700c088, 0x09010088, 0x0b014088, 0x0d018088, 0x0f01c088, 
-    0x11020089, 0x13024089, 0x15028089, 0x1702c089, 0x19030089, 0x1b034089, 0x1d038089, 0x1f03c089, 
-    0x2104008a, 0x2304408a, 0x2504808a, 0x2704c08a, 0x2905008a, 0x2b05408a, 0x2d05808a, 0x2f05c08a, 
-    0x3106008b, 0x3306408b, 0x3506808b, 0x3706c08b, 0x3907008b, 0x3b07408b, 0x3d07808b, 0x3f07c08b, 
-    0x4108008c, 0x4308408c, 0x4508808c, 0x4708c08c, 0x4909008c, 0x4b09408c, 0x4d09808c, 0x4f09c08c, 
-    0x510a008d, 0x530a408d, 0x550a808d, 0x570ac08d, 0x590b008d, 0x5b0b408d, 0x5d0b808d, 0x5f0bc08d, 
-    0x610c008e, 0x630c408e, 0x650c808e, 0x670cc08e, 0x690d008e, 0x6b0d408e, 0x6d0d808e, 0x6f0dc08e, 
-    0x710e008f, 0x730e408f, 0x750e808f, 0x770ec08f, 0x790f008f, 0x7b0f408f, 0x7d0f808f, 0x7f0fc08f, 
-    0x81100080, 0x83104080, 0x85108080, 0x8710c080, 0x89110080, 0x8b114080, 0x8d118080, 0x8f11c080, 
-    0x91120081, 0x93124081, 0x95128081, 0x9712c081, 0x99130081, 0x9b134081, 0x9d138081, 0x9f13c081, 
-    0xa1140082, 0xa3144082, 0xa5148082, 0xa714c082, 0xa9150082, 0xab154082, 0xad158082, 0xaf15c082, 
-    0xb1160083, 0xb3164083, 0xb5168083, 0xb716c083, 0xb9170083, 0xbb174083, 0xbd178083, 0xbf17c083, 
-    0xc1180084, 0xc3184084, 0xc5188084, 0xc718c084, 0xc9190084, 0xcb194084, 0xcd198084, 0xcf19c084, 
-    0xd11a0085, 0xd31a4085, 0xd51a8085, 0xd71ac085, 0xd91b0085, 0xdb1b4085, 0xdd1b8085, 0xdf1bc085, 
-    0xe11c0086, 0xe31c4086, 0xe51c8086, 0xe71cc086, 0xe91d0086, 0xeb1d4086, 0xed1d8086, 0xef1dc086, 
-    0xf11e0087, 0xf31e4087, 0xf51e8087, 0xf71ec087, 0xf91f0087, 0xfb1f4087, 0xfd1f8087, 0xff1fc087, 
-    0x01200099, 0x03204099, 0x05208099, 0x0720c099, 0x09210099, 0x0b214099, 0x0d218099, 0x0f21c099, 
-    0x11220098, 0x13224098, 0x15228098, 0x1722c098, 0x19230098, 0x1b234098, 0x1d238098, 0x1f23c098, 
-    0x2124009b, 0x2324409b, 0x2524809b, 0x2724c09b, 0x2925009b, 0x2b25409b, 0x2d25809b, 0x2f25c09b, 
-    0x3126009a, 0x3326409a, 0x3526809a, 0x3726c09a, 0x3927009a, 0x3b27409a, 0x3d27809a, 0x3f27c09a, 
-    0x4128009d, 0x4328409d, 0x4528809d, 0x4728c09d, 0x4929009d, 0x4b29409d, 0x4d29809d, 0x4f29c09d, 
-    0x512a009c, 0x532a409c, 0x552a809c, 0x572ac09c, 0x592b009c, 0x5b2b409c, 0x5d2b809c, 0x5f2bc09c, 
-    0x612c009f, 0x632c409f, 0x652c809f, 0x672cc09f, 0x692d009f, 0x6b2d409f, 0x6d2d809f, 0x6f2dc09f, 
-    0x712e009e, 0x732e409e, 0x752e809e, 0x772ec09e, 0x792f009e, 0x7b2f409e, 0x7d2f809e, 0x7f2fc09e, 
-    0x81300091, 0x83304091, 0x85308091, 0x8730c091, 0x89310091, 0x8b314091, 0x8d318091, 0x8f31c091, 
-    0x91320090, 0x93324090, 0x95328090, 0x9732c090, 0x99330090, 0x9b334090, 0x9d338090, 0x9f33c090, 
-    0xa1340093, 0xa3344093, 0xa5348093, 0xa734c093, 0xa9350093, 0xab354093, 0xad358093, 0xaf35c093, 
-    0xb1360092, 0xb3364092, 0xb5368092, 0xb736c092, 0xb9370092, 0xbb374092, 0xbd378092, 0xbf37c092, 
-    0xc1380095, 0xc3384095, 0xc5388095, 0xc738c095, 0xc9390095, 0xcb394095, 0xcd398095, 0xcf39c095, 
-    0xd13a0094, 0xd33a4094, 0xd53a8094, 0xd73ac094, 0xd93b0094, 0xdb3b4094, 0xdd3b8094, 0xdf3bc094, 
-    0xe13c0097, 0xe33c4097, 0xe53c8097, 0xe73cc097, 0xe93d0097, 0xeb3d4097, 0xed3d8097, 0xef3dc097, 
-    0xf13e0096, 0xf33e4096, 0xf53e8096, 0xf73ec096, 0xf93f0096, 0xfb3f4096, 0xfd3f8096, 0xff3fc096, 
-    0x014000aa, 0x034040aa, 0x054080aa, 0x0740c0aa, 0x094100aa, 0x0b4140aa, 0x0d4180aa, 0x0f41c0aa, 
-    0x114200ab, 0x134240ab, 0x154280ab, 0x1742c0ab, 0x194300ab, 0x1b4340ab, 0x1d4380ab, 0x1f43c0ab, 
-    0x214400a8, 0x234440a8, 0x254480a8, 0x2744c0a8, 0x294500a8, 0x2b4540a8, 0x2d4580a8, 0x2f45c0a8, 
-    0x314600a9, 0x334640a9, 0x354680a9, 0x3746c0a9, 0x394700a9, 0x3b4740a9, 0x3d4780a9, 0x3f47c0a9, 
-    0x414800ae, 0x434840ae, 0x454880ae, 0x4748c0ae, 0x494900ae, 0x4b4940ae, 0x4d4980ae, 0x4f49c0ae, 
-    0x514a00af, 0x534a40af, 0x554a80af, 0x574ac0af, 0x594b00af, 0x5b4b40af, 0x5d4b80af, 0x5f4bc0af, 
-    0x614c00ac, 0x634c40ac, 0x654c80ac, 0x674cc0ac, 0x694d00ac, 0x6b4d40ac, 0x6d4d80ac, 0x6f4dc0ac, 
-    0x714e00ad, 0x734e40ad, 0x754e80ad, 0x774ec0ad, 0x794f00ad, 0x7b4f40ad, 0x7d4f80ad, 0x7f4fc0ad, 
-    0x815000a2, 0x835040a2, 0x855080a2, 0x8750c0a2, 0x895100a2, 0x8b5140a2, 0x8d5180a2, 0x8f51c0a2, 
-    0x915200a3, 0x935240a3, 0x955280a3, 0x9752c0a3, 0x995300a3, 0x9b5340a3, 0x9d5380a3, 0x9f53c0a3, 
-    0xa15400a0, 0xa35440a0, 0xa55480a0, 0xa754c0a0, 0xa95500a0, 0xab5540a0, 0xad5580a0, 0xaf55c0a0, 
-    0xb15600a1, 0xb35640a1, 0xb55680a1, 0xb756c0a1, 0xb95700a1, 0xbb5740a1, 0xbd5780a1, 0xbf57c0a1, 
-    0xc15800a6, 0xc35840a6, 0xc55880a6, 0xc758c0a6, 0xc95900a6, 0xcb5940a6, 0xcd5980a6, 0xcf59c0a6, 
-    0xd15a00a7, 0xd35a40a7, 0xd55a80a7, 0xd75ac0a7, 0xd95b00a7, 0xdb5b40a7, 0xdd5b80a7, 0xdf5bc0a7, 
-    0xe15c00a4, 0xe35c40a4, 0xe55c80a4, 0xe75cc0a4, 0xe95d00a4, 0xeb5d40a4, 0xed5d80a4, 0xef5dc0a4, 
-    0xf15e00a5, 0xf35e40a5, 0xf55e80a5, 0xf75ec0a5, 0xf95f00a5, 0xfb5f40a5, 0xfd5f80a5, 0xff5fc0a5, 
-    0x016000bb, 0x036040bb, 0x056080bb, 0x0760c0bb, 0x096100bb, 0x0b6140bb, 0x0d6180bb, 0x0f61c0bb, 
-    0x116200ba, 0x136240ba, 0x156280ba, 0x1762c0ba, 0x196300ba, 0x1b6340ba, 0x1d6380ba, 0x1f63c0ba, 
-    0x216400b9, 0x236440b9, 0x256480b9, 0x2764c0b9, 0x296500b9, 0x2b6540b9, 0x2d6580b9, 0x2f65c0b9, 
-    0x316600b8, 0x336640b8, 0x356680b8, 0x3766c0b8, 0x396700b8, 0x3b6740b8, 0x3d6780b8, 0x3f67c0b8, 
-    0x416800bf, 0x436840bf, 0x456880bf, 0x4768c0bf, 0x496900bf, 0x4b6940bf, 0x4d6980bf, 0x4f69c0bf, 
-    0x516a00be, 0x536a40be, 0x556a80be, 0x576ac0be, 0x596b00be, 0x5b6b40be, 0x5d6b80be, 0x5f6bc0be, 
-    0x616c00bd, 0x636c40bd, 0x656c80bd, 0x676cc0bd, 0x696d00bd, 0x6b6d40bd, 0x6d6d80bd, 0x6f6dc0bd, 
-    0x716e00bc, 0x736e40bc, 0x756e80bc, 0x776ec0bc, 0x796f00bc, 0x7b6f40bc, 0x7d6f80bc, 0x7f6fc0bc, 
-    0x817000b3, 0x837040b3, 0x857080b3, 0x8770c0b3, 0x897100b3, 0x8b7140b3, 0x8d7180b3, 0x8f71c0b3, 
-    0x917200b2, 0x937240b2, 0x957280b2, 0x9772c0b2, 0x997300b2, 0x9b7340b2, 0x9d7380b2, 0x9f73c0b2, 
-    0xa17400b1, 0xa37440b1, 0xa57480b1, 0xa774c0b1, 0xa97500b1, 0xab7540b1, 0xad7580b1, 0xaf75c0b1, 
-    0xb17600b0, 0xb37640b0, 0xb57680b0, 0xb776c0b0, 0xb97700b0, 0xbb7740b0, 0xbd7780b0, 0xbf77c0b0, 
-    0xc17800b7, 0xc37840b7, 0xc57880b7, 0xc778c0b7, 0xc97900b7, 0xcb7940b7, 0xcd7980b7, 0xcf79c0b7, 
-    0xd17a00b6, 0xd37a40b6, 0xd57a80b6, 0xd77ac0b6, 0xd97b00b6, 0xdb7b40b6, 0xdd7b80b6, 0xdf7bc0b6, 
-    0xe17c00b5, 0xe37c40b5, 0xe57c80b5, 0xe77cc0b5, 0xe97d00b5, 0xeb7d40b5, 0xed7d80b5, 0xef7dc0b5, 
-    0xf17e00b4, 0xf37e40b4, 0xf57e80b4, 0xf77ec0b4, 0xf97f00b4, 0xfb7f40b4, 0xfd7f80b4, 0xff7fc0b4, 
-    0x018000cc, 0x038040cc, 0x058080cc, 0x0780c0cc, 0x098100cc, 0x0b8140cc, 0x0d8180cc, 0x0f81c0cc, 
-    0x118200cd, 0x138240cd, 0x158280cd, 0x1782c0cd, 0x198300cd, 0x1b8340cd, 0x1d8380cd, 0x1f83c0cd, 
-    0x218400ce, 0x238440ce, 0x258480ce, 0x2784c0ce, 0x298500ce, 0x2b8540ce, 0x2d8580ce, 0x2f85c0ce, 
-    0x318600cf, 0x338640cf, 0x358680cf, 0x3786c0cf, 0x398700cf, 0x3b8740cf, 0x3d8780cf, 0x3f87c0cf, 
-    0x418800c8, 0x438840c8, 0x458880c8, 0x4788c0c8, 0x498900c8, 0x4b8940c8, 0x4d8980c8, 0x4f89c0c8, 
-    0x518a00c9, 0x538a40c9, 0x558a80c9, 0x578ac0c9, 0x598b00c9, 0x5b8b40c9, 0x5d8b80c9, 0x5f8bc0c9, 
-    0x618c00ca, 0x638c40ca, 0x658c80ca, 0x678cc0ca, 0x698d00ca, 0x6b8d40ca, 0x6d8d80ca, 0x6f8dc0ca, 
-    0x718e00cb, 0x738e40cb, 0x758e80cb, 0x778ec0cb, 0x798f00cb, 0x7b8f40cb, 0x7d8f80cb, 0x7f8fc0cb, 
-    0x819000c4, 0x839040c4, 0x859080c4, 0x8790c0c4, 0x899100c4, 0x8b9140c4, 0x8d9180c4, 0x8f91c0c4, 
-    0x919200c5, 0x939240c5, 0x959280c5, 0x9792c0c5, 0x999300c5, 0x9b9340c5, 0x9d9380c5, 0x9f93c0c5, 
-    0xa19400c6, 0xa39440c6, 0xa59480c6, 0xa794c0c6, 0xa99500c6, 0xab9540c6, 0xad9580c6, 0xaf95c0c6, 
-    0xb19600c7, 0xb39640c7, 0xb59680c7, 0xb796c0c7, 0xb99700c7, 0xbb9740c7, 0xbd9780c7, 0xbf97c0c7, 
-    0xc19800c0, 0xc39840c0, 0xc59880c0, 0xc798c0c0, 0xc99900c0, 0xcb9940c0, 0xcd9980c0, 0xcf99c0c0, 
-    0xd19a00c1, 0xd39a40c1, 0xd59a80c1, 0xd79ac0c1, 0xd99b00c1, 0xdb9b40c1, 0xdd9b80c1, 0xdf9bc0c1, 
-    0xe19c00c2, 0xe39c40c2, 0xe59c80c2, 0xe79cc0c2, 0xe99d00c2, 0xeb9d40c2, 0xed9d80c2, 0xef9dc0c2, 
-    0xf19e00c3, 0xf39e40c3, 0xf59e80c3, 0xf79ec0c3, 0xf99f00c3, 0xfb9f40c3, 0xfd9f80c3, 0xff9fc0c3, 
-    0x01a000dd, 0x03a040dd, 0x05a080dd, 0x07a0c0dd, 0x09a100dd, 0x0ba140dd, 0x0da180dd, 0x0fa1c0dd, 
-    0x11a200dc, 0x13a240dc, 0x15a280dc, 0x17a2c0dc, 0x19a300dc, 0x1ba340dc, 0x1da380dc, 0x1fa3c0dc, 
-    0x21a400df, 0x23a440df, 0x25a480df, 0x27a4c0df, 0x29a500df, 0x2ba540df, 0x2da580df, 0x2fa5c0df, 
-    0x31a600de, 0x33a640de, 0x35a680de, 0x37a6c0de, 0x39a700de, 0x3ba740de, 0x3da780de, 0x3fa7c0de, 
-    0x41a800d9, 0x43a840d9, 0x45a880d9, 0x47a8c0d9, 0x49a900d9, 0x4ba940d9, 0x4da980d9, 0x4fa9c0d9, 
-    0x51aa00d8, 0x53aa40d8, 0x55aa80d8, 0x57aac0d8, 0x59ab00d8, 0x5bab40d8, 0x5dab80d8, 0x5fabc0d8, 
-    0x61ac00db, 0x63ac40db, 0x65ac80db, 0x67acc0db, 0x69ad00db, 0x6bad40db, 0x6dad80db, 0x6fadc0db, 
-    0x71ae00da, 0x73ae40da, 0x75ae80da, 0x77aec0da, 0x79af00da, 0x7baf40da, 0x7daf80da, 0x7fafc0da, 
-    0x81b000d5, 0x83b040d5, 0x85b080d5, 0x87b0c0d5, 0x89b100d5, 0x8bb140d5, 0x8db180d5, 0x8fb1c0d5, 
-    0x91b200d4, 0x93b240d4, 0x95b280d4, 0x97b2c0d4, 0x99b300d4, 0x9bb340d4, 0x9db380d4, 0x9fb3c0d4, 
-    0xa1b400d7, 0xa3b440d7, 0xa5b480d7, 0xa7b4c0d7, 0xa9b500d7, 0xabb540d7, 0xadb580d7, 0xafb5c0d7, 
-    0xb1b600d6, 0xb3b640d6, 0xb5b680d6, 0xb7b6c0d6, 0xb9b700d6, 0xbbb740d6, 0xbdb780d6, 0xbfb7c0d6, 
-    0xc1b800d1, 0xc3b840d1, 0xc5b880d1, 0xc7b8c0d1, 0xc9b900d1, 0xcbb940d1, 0xcdb980d1, 0xcfb9c0d1, 
-    0xd1ba00d0, 0xd3ba40d0, 0xd5ba80d0, 0xd7bac0d0, 0xd9bb00d0, 0xdbbb40d0, 0xddbb80d0, 0xdfbbc0d0, 
-    0xe1bc00d3, 0xe3bc40d3, 0xe5bc80d3, 0xe7bcc0d3, 0xe9bd00d3, 0xebbd40d3, 0xedbd80d3, 0xefbdc0d3, 
-    0xf1be00d2, 0xf3be40d2, 0xf5be80d2, 0xf7bec0d2, 0xf9bf00d2, 0xfbbf40d2, 0xfdbf80d2, 0xffbfc0d2, 
-    0x01c000ee, 0x03c040ee, 0x05c080ee, 0x07c0c0ee, 0x09c100ee, 0x0bc140ee, 0x0dc180ee, 0x0fc1c0ee, 
-    0x11c200ef, 0x13c240ef, 0x15c280ef, 0x17c2c0ef, 0x19c300ef, 0x1bc340ef, 0x1dc380ef, 0x1fc3c0ef, 
-    0x21c400ec, 0x23c440ec, 0x25c480ec, 0x27c4c0ec, 0x29c500ec, 0x2bc540ec, 0x2dc580ec, 0x2fc5c0ec, 
-    0x31c600ed, 0x33c640ed, 0x35c680ed, 0x37c6c0ed, 0x39c700ed, 0x3bc740ed, 0x3dc780ed, 0x3fc7c0ed, 
-    0x41c800ea, 0x43c840ea, 0x45c880ea, 0x47c8c0ea, 0x49c900ea, 0x4bc940ea, 0x4dc980ea, 0x4fc9c0ea, 
-    0x51ca00eb, 0x53ca40eb, 0x55ca80eb, 0x57cac0eb, 0x59cb00eb, 0x5bcb40eb, 0x5dcb80eb, 0x5fcbc0eb, 
-    0x61cc00e8, 0x63cc40e8, 0x65cc80e8, 0x67ccc0e8, 0x69cd00e8, 0x6bcd40e8, 0x6dcd80e8, 0x6fcdc0e8, 
-    0x71ce00e9, 0x73ce40e9, 0x75ce80e9, 0x77cec0e9, 0x79cf00e9, 0x7bcf40e9, 0x7dcf80e9, 0x7fcfc0e9, 
-    0x81d000e6, 0x83d040e6, 0x85d080e6, 0x87d0c0e6, 0x89d100e6, 0x8bd140e6, 0x8dd180e6, 0x8fd1c0e6, 
-    0x91d200e7, 0x93d240e7, 0x95d280e7, 0x97d2c0e7, 0x99d300e7, 0x9bd340e7, 0x9dd380e7, 0x9fd3c0e7, 
-    0xa1d400e4, 0xa3d440e4, 0xa5d480e4, 0xa7d4c0e4, 0xa9d500e4, 0xabd540e4, 0xadd580e4, 0xafd5c0e4, 
-    0xb1d600e5, 0xb3d640e5, 0xb5d680e5, 0xb7d6c0e5, 0xb9d700e5, 0xbbd740e5, 0xbdd780e5, 0xbfd7c0e5, 
-    0xc1d800e2, 0xc3d840e2, 0xc5d880e2, 0xc7d8c0e2, 0xc9d900e2, 0xcbd940e2, 0xcdd980e2, 0xcfd9c0e2, 
-    0xd1da00e3, 0xd3da40e3, 0xd5da80e3, 0xd7dac0e3, 0xd9db00e3, 0xdbdb40e3, 0xdddb80e3, 0xdfdbc0e3, 
-    0xe1dc00e0, 0xe3dc40e0, 0xe5dc80e0, 0xe7dcc0e0, 0xe9dd00e0, 0xebdd40e0, 0xeddd80e0, 0xefddc0e0, 
-    0xf1de00e1, 0xf3de40e1, 0xf5de80e1, 0xf7dec0e1, 0xf9df00e1, 0xfbdf40e1, 0xfddf80e1, 0xffdfc0e1, 
-    0x01e000ff, 0x03e040ff, 0x05e080ff, 0x07e0c0ff, 0x09e100ff, 0x0be140ff, 0x0de180ff, 0x0fe1c0ff, 
-    0x11e200fe, 0x13e240fe, 0x15e280fe, 0x17e2c0fe, 0x19e300fe, 0x1be340fe, 0x1de380fe, 0x1fe3c0fe, 
-    0x21e400fd, 0x23e440fd, 0x25e480fd, 0x27e4c0fd, 0x29e500fd, 0x2be540fd, 0x2de580fd, 0x2fe5c0fd, 
-    0x31e600fc, 0x33e640fc, 0x35e680fc, 0x37e6c0fc, 0x39e700fc, 0x3be740fc, 0x3de780fc, 0x3fe7c0fc, 
-    0x41e800fb, 0x43e840fb, 0x45e880fb, 0x47e8c0fb, 0x49e900fb, 0x4be940fb, 0x4de980fb, 0x4fe9c0fb, 
-    0x51ea00fa, 0x53ea40fa, 0x55ea80fa, 0x57eac0fa, 0x59eb00fa, 0x5beb40fa, 0x5deb80fa, 0x5febc0fa, 
-    0x61ec00f9, 0x63ec40f9, 0x65ec80f9, 0x67ecc0f9, 0x69ed00f9, 0x6bed40f9, 0x6ded80f9, 0x6fedc0f9, 
-    0x71ee00f8, 0x73ee40f8, 0x75ee80f8, 0x77eec0f8, 0x79ef00f8, 0x7bef40f8, 0x7def80f8, 0x7fefc0f8, 
-    0x81f000f7, 0x83f040f7, 0x85f080f7, 0x87f0c0f7, 0x89f100f7, 0x8bf140f7, 0x8df180f7, 0x8ff1c0f7, 
-    0x91f200f6, 0x93f240f6, 0x95f280f6, 0x97f2c0f6, 0x99f300f6, 0x9bf340f6, 0x9df380f6, 0x9ff3c0f6, 
-    0xa1f400f5, 0xa3f440f5, 0xa5f480f5, 0xa7f4c0f5, 0xa9f500f5, 0xabf540f5, 0xadf580f5, 0xaff5c0f5, 
-    0xb1f600f4, 0xb3f640f4, 0xb5f680f4, 0xb7f6c0f4, 0xb9f700f4, 0xbbf740f4, 0xbdf780f4, 0xbff7c0f4, 
-    0xc1f800f3, 0xc3f840f3, 0xc5f880f3, 0xc7f8c0f3, 0xc9f900f3, 0xcbf940f3, 0xcdf980f3, 0xcff9c0f3, 
-    0xd1fa00f2, 0xd3fa40f2, 0xd5fa80f2, 0xd7fac0f2, 0xd9fb00f2, 0xdbfb40f2, 0xddfb80f2, 0xdffbc0f2, 
-    0xe1fc00f1, 0xe3fc40f1, 0xe5fc80f1, 0xe7fcc0f1, 0xe9fd00f1, 0xebfd40f1, 0xedfd80f1, 0xeffdc0f1, 
-    0xf1fe00f0, 0xf3fe40f0, 0xf5fe80f0, 0xf7fec0f0, 0xf9ff00f0, 0xfbff40f0, 0xfdff80f0, 0xffffc0f0, 
-    0x02000110, 0x00004110, 0x06008110, 0x0400c110, 0x0a010110, 0x08014110, 0x0e018110, 0x0c01c110, 
-    0x12020111, 0x10024111, 0x16028111, 0x1402c111, 0x1a030111, 0x18034111, 0x1e038111, 0x1c03c111, 
-    0x22040112, 0x20044112, 0x26048112, 0x2404c112, 0x2a050112, 0x28054112, 0x2e058112, 0x2c05c112, 
-    0x32060113, 0x30064113, 0x36068113, 0x3406c113, 0x3a070113, 0x38074113, 0x3e078113, 0x3c07c113, 
-    0x42080114, 0x40084114, 0x46088114, 0x4408c114, 0x4a090114, 0x48094114, 0x4e098114, 0x4c09c114, 
-    0x520a0115, 0x500a4115, 0x560a8115, 0x540ac115, 0x5a0b0115, 0x580b4115, 0x5e0b8115, 0x5c0bc115, 
-    0x620c0116, 0x600c4116, 0x660c8116, 0x640cc116, 0x6a0d0116, 0x680d4116, 0x6e0d8116, 0x6c0dc116, 
-    0x720e0117, 0x700e4117, 0x760e8117, 0x740ec117, 0x7a0f0117, 0x780f4117, 0x7e0f8117, 0x7c0fc117, 
-    0x82100118, 0x80104118, 0x86108118, 0x8410c118, 0x8a110118, 0x88114118, 0x8e118118, 0x8c11c118, 
-    0x92120119, 0x90124119, 0x96128119, 0x9412c119, 0x9a130119, 0x98134119, 0x9e138119, 0x9c13c119, 
-    0xa214011a, 0xa014411a, 0xa614811a, 0xa414c11a, 0xaa15011a, 0xa815411a, 0xae15811a, 0xac15c11a, 
-    0xb216011b, 0xb016411b, 0xb616811b, 0xb416c11b, 0xba17011b, 0xb817411b, 0xbe17811b, 0xbc17c11b, 
-    0xc218011c, 0xc018411c, 0xc618811c, 0xc418c11c, 0xca19011c, 0xc819411c, 0xce19811c, 0xcc19c11c, 
-    0xd21a011d, 0xd01a411d, 0xd61a811d, 0xd41ac11d, 0xda1b011d, 0xd81b411d, 0xde1b811d, 0xdc1bc11d, 
-    0xe21c011e, 0xe01c411e, 0xe61c811e, 0xe41cc11e, 0xea1d011e, 0xe81d411e, 0xee1d811e, 0xec1dc11e, 
-    0xf21e011f, 0xf01e411f, 0xf61e811f, 0xf41ec11f, 0xfa1f011f, 0xf81f411f, 0xfe1f811f, 0xfc1fc11f, 
-    0x02200101, 0x00204101, 0x06208101, 0x0420c101, 0x0a210101, 0x08214101, 0x0e218101, 0x0c21c101, 
-    0x12220100, 0x10224100, 0x16228100, 0x1422c100, 0x1a230100, 0x18234100, 0x1e238100, 0x1c23c100, 
-    0x22240103, 0x20244103, 0x26248103, 0x2424c103, 0x2a250103, 0x28254103, 0x2e258103, 0x2c25c103, 
-    0x32260102, 0x30264102, 0x36268102, 0x3426c102, 0x3a270102, 0x38274102, 0x3e278102, 0x3c27c102, 
-    0x42280105, 0x40284105, 0x46288105, 0x4428c105, 0x4a290105, 0x48294105, 0x4e298105, 0x4c29c105, 
-    0x522a0104, 0x502a4104, 0x562a8104, 0x542ac104, 0x5a2b0104, 0x582b4104, 0x5e2b8104, 0x5c2bc104, 
-    0x622c0107, 0x602c4107, 0x662c8107, 0x642cc107, 0x6a2d0107, 0x682d4107, 0x6e2d8107, 0x6c2dc107, 
-    0x722e0106, 0x702e4106, 0x762e8106, 0x742ec106, 0x7a2f0106, 0x782f4106, 0x7e2f8106, 0x7c2fc106, 
-    0x82300109, 0x80304109, 0x86308109, 0x8430c109, 0x8a310109, 0x88314109, 0x8e318109, 0x8c31c109, 
-    0x92320108, 0x90324108, 0x96328108, 0x9432c108, 0x9a330108, 0x98334108, 0x9e338108, 0x9c33c108, 
-    0xa234010b, 0xa034410b, 0xa634810b, 0xa434c10b, 0xaa35010b, 0xa835410b, 0xae35810b, 0xac35c10b, 
-    0xb236010a, 0xb036410a, 0xb636810a, 0xb436c10a, 0xba37010a, 0xb837410a, 0xbe37810a, 0xbc37c10a, 
-    0xc238010d, 0xc038410d, 0xc638810d, 0xc438c10d, 0xca39010d, 0xc839410d, 0xce39810d, 0xcc39c10d, 
-    0xd23a010c, 0xd03a410c, 0xd63a810c, 0xd43ac10c, 0xda3b010c, 0xd83b410c, 0xde3b810c, 0xdc3bc10c, 
-    0xe23c010f, 0xe03c410f, 0xe63c810f, 0xe43cc10f, 0xea3d010f, 0xe83d410f, 0xee3d810f, 0xec3dc10f, 
-    0xf23e010e, 0xf03e410e, 0xf63e810e, 0xf43ec10e, 0xfa3f010e, 0xf83f410e, 0xfe3f810e, 0xfc3fc10e, 
-    0x02400132, 0x00404132, 0x06408132, 0x0440c132, 0x0a410132, 0x08414132, 0x0e418132, 0x0c41c132, 
-    0x12420133, 0x10424133, 0x16428133, 0x1442c133, 0x1a430133, 0x18434133, 0x1e438133, 0x1c43c133, 
-    0x22440130, 0x20444130, 0x26448130, 0x2444c130, 0x2a450130, 0x28454130, 0x2e458130, 0x2c45c130, 
-    0x32460131, 0x30464131, 0x36468131, 0x3446c131, 0x3a470131, 0x38474131, 0x3e478131, 0x3c47c131, 
-    0x42480136, 0x40484136, 0x46488136, 0x4448c136, 0x4a490136, 0x48494136, 0x4e498136, 0x4c49c136, 
-    0x524a0137, 0x504a4137, 0x564a8137, 0x544ac137, 0x5a4b0137, 0x584b4137, 0x5e4b8137, 0x5c4bc137, 
-    0x624c0134, 0x604c4134, 0x664c8134, 0x644cc134, 0x6a4d0134, 0x684d4134, 0x6e4d8134, 0x6c4dc134, 
-    0x724e0135, 0x704e4135, 0x764e8135, 0x744ec135, 0x7a4f0135, 0x784f4135, 0x7e4f8135, 0x7c4fc135, 
-    0x8250013a, 0x8050413a, 0x8650813a, 0x8450c13a, 0x8a51013a, 0x8851413a, 0x8e51813a, 0x8c51c13a, 
-    0x9252013b, 0x9052413b, 0x9652813b, 0x9452c13b, 0x9a53013b, 0x9853413b, 0x9e53813b, 0x9c53c13b, 
-    0xa2540138, 0xa0544138, 0xa6548138, 0xa454c138, 0xaa550138, 0xa8554138, 0xae558138, 0xac55c138, 
-    0xb2560139, 0xb0564139, 0xb6568139, 0xb456c139, 0xba570139, 0xb8574139, 0xbe578139, 0xbc57c139, 
-    0xc258013e, 0xc058413e, 0xc658813e, 0xc458c13e, 0xca59013e, 0xc859413e, 0xce59813e, 0xcc59c13e, 
-    0xd25a013f, 0xd05a413f, 0xd65a813f, 0xd45ac13f, 0xda5b013f, 0xd85b413f, 0xde5b813f, 0xdc5bc13f, 
-    0xe25c013c, 0xe05c413c, 0xe65c813c, 0xe45cc13c, 0xea5d013c, 0xe85d413c, 0xee5d813c, 0xec5dc13c, 
-    0xf25e013d, 0xf05e413d, 0xf65e813d, 0xf45ec13d, 0xfa5f013d, 0xf85f413d, 0xfe5f813d, 0xfc5fc13d, 
-    0x02600123, 0x00604123, 0x06608123, 0x0460c123, 0x0a610123, 0x08614123, 0x0e618123, 0x0c61c123, 
-    0x12620122, 0x10624122, 0x16628122, 0x1462c122, 0x1a630122, 0x18634122, 0x1e638122, 0x1c63c122, 
-    0x22640121, 0x20644121, 0x26648121, 0x2464c121, 0x2a650121, 0x28654121, 0x2e658121, 0x2c65c121, 
-    0x32660120, 0x30664120, 0x36668120, 0x3466c120, 0x3a670120, 0x38674120, 0x3e678120, 0x3c67c120, 
-    0x42680127, 0x40684127, 0x46688127, 0x4468c127, 0x4a690127, 0x48694127, 0x4e698127, 0x4c69c127, 
-    0x526a0126, 0x506a4126, 0x566a8126, 0x546ac126, 0x5a6b0126, 0x586b4126, 0x5e6b8126, 0x5c6bc126, 
-    0x626c0125, 0x606c4125, 0x666c8125, 0x646cc125, 0x6a6d0125, 0x686d4125, 0x6e6d8125, 0x6c6dc125, 
-    0x726e0124, 0x706e4124, 0x766e8124, 0x746ec124, 0x7a6f0124, 0x786f4124, 0x7e6f8124, 0x7c6fc124, 
-    0x8270012b, 0x8070412b, 0x8670812b, 0x8470c12b, 0x8a71012b, 0x8871412b, 0x8e71812b, 0x8c71c12b, 
-    0x9272012a, 0x9072412a, 0x9672812a, 0x9472c12a, 0x9a73012a, 0x9873412a, 0x9e73812a, 0x9c73c12a, 
-    0xa2740129, 0xa0744129, 0xa6748129, 0xa474c129, 0xaa750129, 0xa8754129, 0xae758129, 0xac75c129, 
-    0xb2760128, 0xb0764128, 0xb6768128, 0xb476c128, 0xba770128, 0xb8774128, 0xbe778128, 0xbc77c128, 
-    0xc278012f, 0xc078412f, 0xc678812f, 0xc478c12f, 0xca79012f, 0xc879412f, 0xce79812f, 0xcc79c12f, 
-    0xd27a012e, 0xd07a412e, 0xd67a812e, 0xd47ac12e, 0xda7b012e, 0xd87b412e, 0xde7b812e, 0xdc7bc12e, 
-    0xe27c012d, 0xe07c412d, 0xe67c812d, 0xe47cc12d, 0xea7d012d, 0xe87d412d, 0xee7d812d, 0xec7dc12d, 
-    0xf27e012c, 0xf07e412c, 0xf67e812c, 0xf47ec12c, 0xfa7f012c, 0xf87f412c, 0xfe7f812c, 0xfc7fc12c, 
-    0x02800154, 0x00804154, 0x06808154, 0x0480c154, 0x0a810154, 0x08814154, 0x0e818154, 0x0c81c154, 
-    0x12820155, 0x10824155, 0x16828155, 0x1482c155, 0x1a830155, 0x18834155, 0x1e838155, 0x1c83c155, 
-    0x22840156, 0x20844156, 0x26848156, 0x2484c156, 0x2a850156, 0x28854156, 0x2e858156, 0x2c85c156, 
-    0x32860157, 0x30864157, 0x36868157, 0x3486c157, 0x3a870157, 0x38874157, 0x3e878157, 0x3c87c157, 
-    0x42880150, 0x40884150, 0x46888150, 0x4488c150, 0x4a890150, 0x48894150, 0x4e898150, 0x4c89c150, 
-    0x528a0151, 0x508a4151, 0x568a8151, 0x548ac151, 0x5a8b0151, 0x588b4151, 0x5e8b8151, 0x5c8bc151, 
-    0x628c0152, 0x608c4152, 0x668c8152, 0x648cc152, 0x6a8d0152, 0x688d4152, 0x6e8d8152, 0x6c8dc152, 
-    0x728e0153, 0x708e4153, 0x768e8153, 0x748ec153, 0x7a8f0153, 0x788f4153, 0x7e8f8153, 0x7c8fc153, 
-    0x8290015c, 0x8090415c, 0x8690815c, 0x8490c15c, 0x8a91015c, 0x8891415c, 0x8e91815c, 0x8c91c15c, 
-    0x9292015d, 0x9092415d, 0x9692815d, 0x9492c15d, 0x9a93015d, 0x9893415d, 0x9e93815d, 0x9c93c15d, 
-    0xa294015e, 0xa094415e, 0xa694815e, 0xa494c15e, 0xaa95015e, 0xa895415e, 0xae95815e, 0xac95c15e, 
-    0xb296015f, 0xb096415f, 0xb696815f, 0xb496c15f, 0xba97015f, 0xb897415f, 0xbe97815f, 0xbc97c15f, 
-    0xc2980158, 0xc0984158, 0xc6988158, 0xc498c158, 0xca990158, 0xc8994158, 0xce998158, 0xcc99c158, 
-    0xd29a0159, 0xd09a4159, 0xd69a8159, 0xd49ac159, 0xda9b0159, 0xd89b4159, 0xde9b8159, 0xdc9bc159, 
-    0xe29c015a, 0xe09c415a, 0xe69c815a, 0xe49cc15a, 0xea9d015a, 0xe89d415a, 0xee9d815a, 0xec9dc15a, 
-    0xf29e015b, 0xf09e415b, 0xf69e815b, 0xf49ec15b, 0xfa9f015b, 0xf89f415b, 0xfe9f815b, 0xfc9fc15b, 
-    0x02a00145, 0x00a04145, 0x06a08145, 0x04a0c145, 0x0aa10145, 0x08a14145, 0x0ea18145, 0x0ca1c145, 
-    0x12a20144, 0x10a24144, 0x16a28144, 0x14a2c144, 0x1aa30144, 0x18a34144, 0x1ea38144, 0x1ca3c144, 
-    0x22a40147, 0x20a44147, 0x26a48147, 0x24a4c147, 0x2aa50147, 0x28a54147, 0x2ea58147, 0x2ca5c147, 
-    0x32a60146, 0x30a64146, 0x36a68146, 0x34a6c146, 0x3aa70146, 0x38a74146, 0x3ea78146, 0x3ca7c146, 
-    0x42a80141, 0x40a84141, 0x46a88141, 0x44a8c141, 0x4aa90141, 0x48a94141, 0x4ea98141, 0x4ca9c141, 
-    0x52aa0140, 0x50aa4140, 0x56aa8140, 0x54aac140, 0x5aab0140, 0x58ab4140, 0x5eab8140, 0x5cabc140, 
-    0x62ac0143, 0x60ac4143, 0x66ac8143, 0x64acc143, 0x6aad0143, 0x68ad4143, 0x6ead8143, 0x6cadc143, 
-    0x72ae0142, 0x70ae4142, 0x76ae8142, 0x74aec142, 0x7aaf0142, 0x78af4142, 0x7eaf8142, 0x7cafc142, 
-    0x82b0014d, 0x80b0414d, 0x86b0814d, 0x84b0c14d, 0x8ab1014d, 0x88b1414d, 0x8eb1814d, 0x8cb1c14d, 
-    0x92b2014c, 0x90b2414c, 0x96b2814c, 0x94b2c14c, 0x9ab3014c, 0x98b3414c, 0x9eb3814c, 0x9cb3c14c, 
-    0xa2b4014f, 0xa0b4414f, 0xa6b4814f, 0xa4b4c14f, 0xaab5014f, 0xa8b5414f, 0xaeb5814f, 0xacb5c14f, 
-    0xb2b6014e, 0xb0b6414e, 0xb6b6814e, 0xb4b6c14e, 0xbab7014e, 0xb8b7414e, 0xbeb7814e, 0xbcb7c14e, 
-    0xc2b80149, 0xc0b84149, 0xc6b88149, 0xc4b8c149, 0xcab90149, 0xc8b94149, 0xceb98149, 0xccb9c149, 
-    0xd2ba0148, 0xd0ba4148, 0xd6ba8148, 0xd4bac148, 0xdabb0148, 0xd8bb4148, 0xdebb8148, 0xdcbbc148, 
-    0xe2bc014b, 0xe0bc414b, 0xe6bc814b, 0xe4bcc14b, 0xeabd014b, 0xe8bd414b, 0xeebd814b, 0xecbdc14b, 
-    0xf2be014a, 0xf0be414a, 0xf6be814a, 0xf4bec14a, 0xfabf014a, 0xf8bf414a, 0xfebf814a, 0xfcbfc14a, 
-    0x02c00176, 0x00c04176, 0x06c08176, 0x04c0c176, 0x0ac10176, 0x08c14176, 0x0ec18176, 0x0cc1c176, 
-    0x12c20177, 0x10c24177, 0x16c28177, 0x14c2c177, 0x1ac30177, 0x18c34177, 0x1ec38177, 0x1cc3c177, 
-    0x22c40174, 0x20c44174, 0x26c48174, 0x24c4c174, 0x2ac50174, 0x28c54174, 0x2ec58174, 0x2cc5c174, 
-    0x32c60175, 0x30c64175, 0x36c68175, 0x34c6c175, 0x3ac70175, 0x38c74175, 0x3ec78175, 0x3cc7c175, 
-    0x42c80172, 0x40c84172, 0x46c88172, 0x44c8c172, 0x4ac90172, 0x48c94172, 0x4ec98172, 0x4cc9c172, 
-    0x52ca0173, 0x50ca4173, 0x56ca8173, 0x54cac173, 0x5acb0173, 0x58cb4173, 0x5ecb8173, 0x5ccbc173, 
-    0x62cc0170, 0x60cc4170, 0x66cc8170, 0x64ccc170, 0x6acd0170, 0x68cd4170, 0x6ecd8170, 0x6ccdc170, 
-    0x72ce0171, 0x70ce4171, 0x76ce8171, 0x74cec171, 0x7acf0171, 0x78cf4171, 0x7ecf8171, 0x7ccfc171, 
-    0x82d0017e, 0x80d0417e, 0x86d0817e, 0x84d0c17e, 0x8ad1017e, 0x88d1417e, 0x8ed1817e, 0x8cd1c17e, 
-    0x92d2017f, 0x90d2417f, 0x96d2817f, 0x94d2c17f, 0x9ad3017f, 0x98d3417f, 0x9ed3817f, 0x9cd3c17f, 
-    0xa2d4017c, 0xa0d4417c, 0xa6d4817c, 0xa4d4c17c, 0xaad5017c, 0xa8d5417c, 0xaed5817c, 0xacd5c17c, 
-    0xb2d6017d, 0xb0d6417d, 0xb6d6817d, 0xb4d6c17d, 0xbad7017d, 0xb8d7417d, 0xbed7817d, 0xbcd7c17d, 
-    0xc2d8017a, 0xc0d8417a, 0xc6d8817a, 0xc4d8c17a, 0xcad9017a, 0xc8d9417a, 0xced9817a, 0xccd9c17a, 
-    0xd2da017b, 0xd0da417b, 0xd6da817b, 0xd4dac17b, 0xdadb017b, 0xd8db417b, 0xdedb817b, 0xdcdbc17b, 
-    0xe2dc0178, 0xe0dc4178, 0xe6dc8178, 0xe4dcc178, 0xeadd0178, 0xe8dd4178, 0xeedd8178, 0xecddc178, 
-    0xf2de0179, 0xf0de4179, 0xf6de8179, 0xf4dec179, 0xfadf0179, 0xf8df4179, 0xfedf8179, 0xfcdfc179, 
-    0x02e00167, 0x00e04167, 0x06e08167, 0x04e0c167, 0x0ae10167, 0x08e14167, 0x0ee18167, 0x0ce1c167, 
-    0x12e20166, 0x10e24166, 0x16e28166, 0x14e2c166, 0x1ae30166, 0x18e34166, 0x1ee38166, 0x1ce3c166, 
-    0x22e40165, 0x20e44165, 0x26e48165, 0x24e4c165, 0x2ae50165, 0x28e54165, 0x2ee58165, 0x2ce5c165, 
-    0x32e60164, 0x30e64164, 0x36e68164, 0x34e6c164, 0x3ae70164, 0x38e74164, 0x3ee78164, 0x3ce7c164, 
-    0x42e80163, 0x40e84163, 0x46e88163, 0x44e8c163, 0x4ae90163, 0x48e94163, 0x4ee98163, 0x4ce9c163, 
-    0x52ea0162, 0x50ea4162, 0x56ea8162, 0x54eac162, 0x5aeb0162, 0x58eb4162, 0x5eeb8162, 0x5cebc162, 
-    0x62ec0161, 0x60ec4161, 0x66ec8161, 0x64ecc161, 0x6aed0161, 0x68ed4161, 0x6eed8161, 0x6cedc161, 
-    0x72ee0160, 0x70ee4160, 0x76ee8160, 0x74eec160, 0x7aef0160, 0x78ef4160, 0x7eef8160, 0x7cefc160, 
-    0x82f0016f, 0x80f0416f, 0x86f0816f, 0x84f0c16f, 0x8af1016f, 0x88f1416f, 0x8ef1816f, 0x8cf1c16f, 
-    0x92f2016e, 0x90f2416e, 0x96f2816e, 0x94f2c16e, 0x9af3016e, 0x98f3416e, 0x9ef3816e, 0x9cf3c16e, 
-    0xa2f4016d, 0xa0f4416d, 0xa6f4816d, 0xa4f4c16d, 0xaaf5016d, 0xa8f5416d, 0xaef5816d, 0xacf5c16d, 
-    0xb2f6016c, 0xb0f6416c, 0xb6f6816c, 0xb4f6c16c, 0xbaf7016c, 0xb8f7416c, 0xbef7816c, 0xbcf7c16c, 
-    0xc2f8016b, 0xc0f8416b, 0xc6f8816b, 0xc4f8c16b, 0xcaf9016b, 0xc8f9416b, 0xcef9816b, 0xccf9c16b, 
-    0xd2fa016a, 0xd0fa416a, 0xd6fa816a, 0xd4fac16a, 0xdafb016a, 0xd8fb416a, 0xdefb816a, 0xdcfbc16a, 
-    0xe2fc0169, 0xe0fc4169, 0xe6fc8169, 0xe4fcc169, 0xeafd0169, 0xe8fd4169, 0xeefd8169, 0xecfdc169, 
-    0xf2fe0168, 0xf0fe4168, 0xf6fe8168, 0xf4fec168, 0xfaff0168, 0xf8ff4168, 0xfeff8168, 0xfcffc168, 
-    0x03000198, 0x01004198, 0x07008198, 0x0500c198, 0x0b010198, 0x09014198, 0x0f018198, 0x0d01c198, 
-    0x13020199, 0x11024199, 0x17028199, 0x1502c199, 0x1b030199, 0x19034199, 0x1f038199, 0x1d03c199, 
-    0x2304019a, 0x2104419a, 0x2704819a, 0x2504c19a, 0x2b05019a, 0x2905419a, 0x2f05819a, 0x2d05c19a, 
-    0x3306019b, 0x3106419b, 0x3706819b, 0x3506c19b, 0x3b07019b, 0x3907419b, 0x3f07819b, 0x3d07c19b, 
-    0x4308019c, 0x4108419c, 0x4708819c, 0x4508c19c, 0x4b09019c, 0x4909419c, 0x4f09819c, 0x4d09c19c, 
-    0x530a019d, 0x510a419d, 0x570a819d, 0x550ac19d, 0x5b0b019d, 0x590b419d, 0x5f0b819d, 0x5d0bc19d, 
-    0x630c019e, 0x610c419e, 0x670c819e, 0x650cc19e, 0x6b0d019e, 0x690d419e, 0x6f0d819e, 0x6d0dc19e, 
-    0x730e019f, 0x710e419f, 0x770e819f, 0x750ec19f, 0x7b0f019f, 0x790f419f, 0x7f0f819f, 0x7d0fc19f, 
-    0x83100190, 0x81104190, 0x87108190, 0x8510c190, 0x8b110190, 0x89114190, 0x8f118190, 0x8d11c190, 
-    0x93120191, 0x91124191, 0x97128191, 0x9512c191, 0x9b130191, 0x99134191, 0x9f138191, 0x9d13c191, 
-    0xa3140192, 0xa1144192, 0xa7148192, 0xa514c192, 0xab150192, 0xa9154192, 0xaf158192, 0xad15c192, 
-    0xb3160193, 0xb1164193, 0xb7168193, 0xb516c193, 0xbb170193, 0xb9174193, 0xbf178193, 0xbd17c193, 
-    0xc3180194, 0xc1184194, 0xc7188194, 0xc518c194, 0xcb190194, 0xc9194194, 0xcf198194, 0xcd19c194, 
-    0xd31a0195, 0xd11a4195, 0xd71a8195, 0xd51ac195, 0xdb1b0195, 0xd91b4195, 0xdf1b8195, 0xdd1bc195, 
-    0xe31c0196, 0xe11c4196, 0xe71c8196, 0xe51cc196, 0xeb1d0196, 0xe91d4196, 0xef1d8196, 0xed1dc196, 
-    0xf31e0197, 0xf11e4197, 0xf71e8197, 0xf51ec197, 0xfb1f0197, 0xf91f4197, 0xff1f8197, 0xfd1fc197, 
-    0x03200189, 0x01204189, 0x07208189, 0x0520c189, 0x0b210189, 0x09214189, 0x0f218189, 0x0d21c189, 
-    0x13220188, 0x11224188, 0x17228188, 0x1522c188, 0x1b230188, 0x19234188, 0x1f238188, 0x1d23c188, 
-    0x2324018b, 0x2124418b, 0x2724818b, 0x2524c18b, 0x2b25018b, 0x2925418b, 0x2f25818b, 0x2d25c18b, 
-    0x3326018a, 0x3126418a, 0x3726818a, 0x3526c18a, 0x3b27018a, 0x3927418a, 0x3f27818a, 0x3d27c18a, 
-    0x4328018d, 0x4128418d, 0x4728818d, 0x4528c18d, 0x4b29018d, 0x4929418d, 0x4f29818d, 0x4d29c18d, 
-    0x532a018c, 0x512a418c, 0x572a818c, 0x552ac18c, 0x5b2b018c, 0x592b418c, 0x5f2b818c, 0x5d2bc18c, 
-    0x632c018f, 0x612c418f, 0x672c818f, 0x652cc18f, 0x6b2d018f, 0x692d418f, 0x6f2d818f, 0x6d2dc18f, 
-    0x732e018e, 0x712e418e, 0x772e818e, 0x752ec18e, 0x7b2f018e, 0x792f418e, 0x7f2f818e, 0x7d2fc18e, 
-    0x83300181, 0x81304181, 0x87308181, 0x8530c181, 0x8b310181, 0x89314181, 0x8f318181, 0x8d31c181, 
-    0x93320180, 0x91324180, 0x97328180, 0x9532c180, 0x9b330180, 0x99334180, 0x9f338180, 0x9d33c180, 
-    0xa3340183, 0xa1344183, 0xa7348183, 0xa534c183, 0xab350183, 0xa9354183, 0xaf358183, 0xad35c183, 
-    0xb3360182, 0xb1364182, 0xb7368182, 0xb536c182, 0xbb370182, 0xb9374182, 0xbf378182, 0xbd37c182, 
-    0xc3380185, 0xc1384185, 0xc7388185, 0xc538c185, 0xcb390185, 0xc9394185, 0xcf398185, 0xcd39c185, 
-    0xd33a0184, 0xd13a4184, 0xd73a8184, 0xd53ac184, 0xdb3b0184, 0xd93b4184, 0xdf3b8184, 0xdd3bc184, 
-    0xe33c0187, 0xe13c4187, 0xe73c8187, 0xe53cc187, 0xeb3d0187, 0xe93d4187, 0xef3d8187, 0xed3dc187, 
-    0xf33e0186, 0xf13e4186, 0xf73e8186, 0xf53ec186, 0xfb3f0186, 0xf93f4186, 0xff3f8186, 0xfd3fc186, 
-    0x034001ba, 0x014041ba, 0x074081ba, 0x0540c1ba, 0x0b4101ba, 0x094141ba, 0x0f4181ba, 0x0d41c1ba, 
-    0x134201bb, 0x114241bb, 0x174281bb, 0x1542c1bb, 0x1b4301bb, 0x194341bb, 0x1f4381bb, 0x1d43c1bb, 
-    0x234401b8, 0x214441b8, 0x274481b8, 0x2544c1b8, 0x2b4501b8, 0x294541b8, 0x2f4581b8, 0x2d45c1b8, 
-    0x334601b9, 0x314641b9, 0x374681b9, 0x3546c1b9, 0x3b4701b9, 0x394741b9, 0x3f4781b9, 0x3d47c1b9, 
-    0x434801be, 0x414841be, 0x474881be, 0x4548c1be, 0x4b4901be, 0x494941be, 0x4f4981be, 0x4d49c1be, 
-    0x534a01bf, 0x514a41bf, 0x574a81bf, 0x554ac1bf, 0x5b4b01bf, 0x594b41bf, 0x5f4b81bf, 0x5d4bc1bf, 
-    0x634c01bc, 0x614c41bc, 0x674c81bc, 0x654cc1bc, 0x6b4d01bc, 0x694d41bc, 0x6f4d81bc, 0x6d4dc1bc, 
-    0x734e01bd, 0x714e41bd, 0x774e81bd, 0x754ec1bd, 0x7b4f01bd, 0x794f41bd, 0x7f4f81bd, 0x7d4fc1bd, 
-    0x835001b2, 0x815041b2, 0x875081b2, 0x8550c1b2, 0x8b5101b2, 0x895141b2, 0x8f5181b2, 0x8d51c1b2, 
-    0x935201b3, 0x915241b3, 0x975281b3, 0x9552c1b3, 0x9b5301b3, 0x995341b3, 0x9f5381b3, 0x9d53c1b3, 
-    0xa35401b0, 0xa15441b0, 0xa75481b0, 0xa554c1b0, 0xab5501b0, 0xa95541b0, 0xaf5581b0, 0xad55c1b0, 
-    0xb35601b1, 0xb15641b1, 0xb75681b1, 0xb556c1b1, 0xbb5701b1, 0xb95741b1, 0xbf5781b1, 0xbd57c1b1, 
-    0xc35801b6, 0xc15841b6, 0xc75881b6, 0xc558c1b6, 0xcb5901b6, 0xc95941b6, 0xcf5981b6, 0xcd59c1b6, 
-    0xd35a01b7, 0xd15a41b7, 0xd75a81b7, 0xd55ac1b7, 0xdb5b01b7, 0xd95b41b7, 0xdf5b81b7, 0xdd5bc1b7, 
-    0xe35c01b4, 0xe15c41b4, 0xe75c81b4, 0xe55cc1b4, 0xeb5d01b4, 0xe95d41b4, 0xef5d81b4, 0xed5dc1b4, 
-    0xf35e01b5, 0xf15e41b5, 0xf75e81b5, 0xf55ec1b5, 0xfb5f01b5, 0xf95f41b5, 0xff5f81b5, 0xfd5fc1b5, 
-    0x036001ab, 0x016041ab, 0x076081ab, 0x0560c1ab, 0x0b6101ab, 0x096141ab, 0x0f6181ab, 0x0d61c1ab, 
-    0x136201aa, 0x116241aa, 0x176281aa, 0x1562c1aa, 0x1b6301aa, 0x196341aa, 0x1f6381aa, 0x1d63c1aa, 
-    0x236401a9, 0x216441a9, 0x276481a9, 0x2564c1a9, 0x2b6501a9, 0x296541a9, 0x2f6581a9, 0x2d65c1a9, 
-    0x336601a8, 0x316641a8, 0x376681a8, 0x3566c1a8, 0x3b6701a8, 0x396741a8, 0x3f6781a8, 0x3d67c1a8, 
-    0x436801af, 0x416841af, 0x476881af, 0x4568c1af, 0x4b6901af, 0x496941af, 0x4f6981af, 0x4d69c1af, 
-    0x536a01ae, 0x516a41ae, 0x576a81ae, 0x556ac1ae, 0x5b6b01ae, 0x596b41ae, 0x5f6b81ae, 0x5d6bc1ae, 
-    0x636c01ad, 0x616c41ad, 0x676c81ad, 0x656cc1ad, 0x6b6d01ad, 0x696d41ad, 0x6f6d81ad, 0x6d6dc1ad, 
-    0x736e01ac, 0x716e41ac, 0x776e81ac, 0x756ec1ac, 0x7b6f01ac, 0x796f41ac, 0x7f6f81ac, 0x7d6fc1ac, 
-    0x837001a3, 0x817041a3, 0x877081a3, 0x8570c1a3, 0x8b7101a3, 0x897141a3, 0x8f7181a3, 0x8d71c1a3, 
-    0x937201a2, 0x917241a2, 0x977281a2, 0x9572c1a2, 0x9b7301a2, 0x997341a2, 0x9f7381a2, 0x9d73c1a2, 
-    0xa37401a1, 0xa17441a1, 0xa77481a1, 0xa574c1a1, 0xab7501a1, 0xa97541a1, 0xaf7581a1, 0xad75c1a1, 
-    0xb37601a0, 0xb17641a0, 0xb77681a0, 0xb576c1a0, 0xbb7701a0, 0xb97741a0, 0xbf7781a0, 0xbd77c1a0, 
-    0xc37801a7, 0xc17841a7, 0xc77881a7, 0xc578c1a7, 0xcb7901a7, 0xc97941a7, 0xcf7981a7, 0xcd79c1a7, 
-    0xd37a01a6, 0xd17a41a6, 0xd77a81a6, 0xd57ac1a6, 0xdb7b01a6, 0xd97b41a6, 0xdf7b81a6, 0xdd7bc1a6, 
-    0xe37c01a5, 0xe17c41a5, 0xe77c81a5, 0xe57cc1a5, 0xeb7d01a5, 0xe97d41a5, 0xef7d81a5, 0xed7dc1a5, 
-    0xf37e01a4, 0xf17e41a4, 0xf77e81a4, 0xf57ec1a4, 0xfb7f01a4, 0xf97f41a4, 0xff7f81a4, 0xfd7fc1a4, 
-    0x038001dc, 0x018041dc, 0x078081dc, 0x0580c1dc, 0x0b8101dc, 0x098141dc, 0x0f8181dc, 0x0d81c1dc, 
-    0x138201dd, 0x118241dd, 0x178281dd, 0x1582c1dd, 0x1b8301dd, 0x198341dd, 0x1f8381dd, 0x1d83c1dd, 
-    0x238401de, 0x218441de, 0x278481de, 0x2584c1de, 0x2b8501de, 0x298541de, 0x2f8581de, 0x2d85c1de, 
-    0x338601df, 0x318641df, 0x378681df, 0x3586c1df, 0x3b8701df, 0x398741df, 0x3f8781df, 0x3d87c1df, 
-    0x438801d8, 0x418841d8, 0x478881d8, 0x4588c1d8, 0x4b8901d8, 0x498941d8, 0x4f8981d8, 0x4d89c1d8, 
-    0x538a01d9, 0x518a41d9, 0x578a81d9, 0x558ac1d9, 0x5b8b01d9, 0x598b41d9, 0x5f8b81d9, 0x5d8bc1d9, 
-    0x638c01da, 0x618c41da, 0x678c81da, 0x658cc1da, 0x6b8d01da, 0x698d41da, 0x6f8d81da, 0x6d8dc1da, 
-    0x738e01db, 0x718e41db, 0x778e81db, 0x758ec1db, 0x7b8f01db, 0x798f41db, 0x7f8f81db, 0x7d8fc1db, 
-    0x839001d4, 0x819041d4, 0x879081d4, 0x8590c1d4, 0x8b9101d4, 0x899141d4, 0x8f9181d4, 0x8d91c1d4, 
-    0x939201d5, 0x919241d5, 0x979281d5, 0x9592c1d5, 0x9b9301d5, 0x999341d5, 0x9f9381d5, 0x9d93c1d5, 
-    0xa39401d6, 0xa19441d6, 0xa79481d6, 0xa594c1d6, 0xab9501d6, 0xa99541d6, 0xaf9581d6, 0xad95c1d6, 
-    0xb39601d7, 0xb19641d7, 0xb79681d7, 0xb596c1d7, 0xbb9701d7, 0xb99741d7, 0xbf9781d7, 0xbd97c1d7, 
-    0xc39801d0, 0xc19841d0, 0xc79881d0, 0xc598c1d0, 0xcb9901d0, 0xc99941d0, 0xcf9981d0, 0xcd99c1d0, 
-    0xd39a01d1, 0xd19a41d1, 0xd79a81d1, 0xd59ac1d1, 0xdb9b01d1, 0xd99b41d1, 0xdf9b81d1, 0xdd9bc1d1, 
-    0xe39c01d2, 0xe19c41d2, 0xe79c81d2, 0xe59cc1d2, 0xeb9d01d2, 0xe99d41d2, 0xef9d81d2, 0xed9dc1d2, 
-    0xf39e01d3, 0xf19e41d3, 0xf79e81d3, 0xf59ec1d3, 0xfb9f01d3, 0xf99f41d3, 0xff9f81d3, 0xfd9fc1d3, 
-    0x03a001cd, 0x01a041cd, 0x07a081cd, 0x05a0c1cd, 0x0ba101cd, 0x09a141cd, 0x0fa181cd, 0x0da1c1cd, 
-    0x13a201cc, 0x11a241cc, 0x17a281cc, 0x15a2c1cc, 0x1ba301cc, 0x19a341cc, 0x1fa381cc, 0x1da3c1cc, 
-    0x23a401cf, 0x21a441cf, 0x27a481cf, 0x25a4c1cf, 0x2ba501cf, 0x29a541cf, 0x2fa581cf, 0x2da5c1cf, 
-    0x33a601ce, 0x31a641ce, 0x37a681ce, 0x35a6c1ce, 0x3ba701ce, 0x39a741ce, 0x3fa781ce, 0x3da7c1ce, 
-    0x43a801c9, 0x41a841c9, 0x47a881c9, 0x45a8c1c9, 0x4ba901c9, 0x49a941c9, 0x4fa981c9, 0x4da9c1c9, 
-    0x53aa01c8, 0x51aa41c8, 0x57aa81c8, 0x55aac1c8, 0x5bab01c8, 0x59ab41c8, 0x5fab81c8, 0x5dabc1c8, 
-    0x63ac01cb, 0x61ac41cb, 0x67ac81cb, 0x65acc1cb, 0x6bad01cb, 0x69ad41cb, 0x6fad81cb, 0x6dadc1cb, 
-    0x73ae01ca, 0x71ae41ca, 0x77ae81ca, 0x75aec1ca, 0x7baf01ca, 0x79af41ca, 0x7faf81ca, 0x7dafc1ca, 
-    0x83b001c5, 0x81b041c5, 0x87b081c5, 0x85b0c1c5, 0x8bb101c5, 0x89b141c5, 0x8fb181c5, 0x8db1c1c5, 
-    0x93b201c4, 0x91b241c4, 0x97b281c4, 0x95b2c1c4, 0x9bb301c4, 0x99b341c4, 0x9fb381c4, 0x9db3c1c4, 
-    0xa3b401c7, 0xa1b441c7, 0xa7b481c7, 0xa5b4c1c7, 0xabb501c7, 0xa9b541c7, 0xafb581c7, 0xadb5c1c7, 
-    0xb3b601c6, 0xb1b641c6, 0xb7b681c6, 0xb5b6c1c6, 0xbbb701c6, 0xb9b741c6, 0xbfb781c6, 0xbdb7c1c6, 
-    0xc3b801c1, 0xc1b841c1, 0xc7b881c1, 0xc5b8c1c1, 0xcbb901c1, 0xc9b941c1, 0xcfb981c1, 0xcdb9c1c1, 
-    0xd3ba01c0, 0xd1ba41c0, 0xd7ba81c0, 0xd5bac1c0, 0xdbbb01c0, 0xd9bb41c0, 0xdfbb81c0, 0xddbbc1c0, 
-    0xe3bc01c3, 0xe1bc41c3, 0xe7bc81c3, 0xe5bcc1c3, 0xebbd01c3, 0xe9bd41c3, 0xefbd81c3, 0xedbdc1c3, 
-    0xf3be01c2, 0xf1be41c2, 0xf7be81c2, 0xf5bec1c2, 0xfbbf01c2, 0xf9bf41c2, 0xffbf81c2, 0xfdbfc1c2, 
-    0x03c001fe, 0x01c041fe, 0x07c081fe, 0x05c0c1fe, 0x0bc101fe, 0x09c141fe, 0x0fc181fe, 0x0dc1c1fe, 
-    0x13c201ff, 0x11c241ff, 0x17c281ff, 0x15c2c1ff, 0x1bc301ff, 0x19c341ff, 0x1fc381ff, 0x1dc3c1ff, 
-    0x23c401fc, 0x21c441fc, 0x27c481fc, 0x25c4c1fc, 0x2bc501fc, 0x29c541fc, 0x2fc581fc, 0x2dc5c1fc, 
-    0x33c601fd, 0x31c641fd, 0x37c681fd, 0x35c6c1fd, 0x3bc701fd, 0x39c741fd, 0x3fc781fd, 0x3dc7c1fd, 
-    0x43c801fa, 0x41c841fa, 0x47c881fa, 0x45c8c1fa, 0x4bc901fa, 0x49c941fa, 0x4fc981fa, 0x4dc9c1fa, 
-    0x53ca01fb, 0x51ca41fb, 0x57ca81fb, 0x55cac1fb, 0x5bcb01fb, 0x59cb41fb, 0x5fcb81fb, 0x5dcbc1fb, 
-    0x63cc01f8, 0x61cc41f8, 0x67cc81f8, 0x65ccc1f8, 0x6bcd01f8, 0x69cd41f8, 0x6fcd81f8, 0x6dcdc1f8, 
-    0x73ce01f9, 0x71ce41f9, 0x77ce81f9, 0x75cec1f9, 0x7bcf01f9, 0x79cf41f9, 0x7fcf81f9, 0x7dcfc1f9, 
-    0x83d001f6, 0x81d041f6, 0x87d081f6, 0x85d0c1f6, 0x8bd101f6, 0x89d141f6, 0x8fd181f6, 0x8dd1c1f6, 
-    0x93d201f7, 0x91d241f7, 0x97d281f7, 0x95d2c1f7, 0x9bd301f7, 0x99d341f7, 0x9fd381f7, 0x9dd3c1f7, 
-    0xa3d401f4, 0xa1d441f4, 0xa7d481f4, 0xa5d4c1f4, 0xabd501f4, 0xa9d541f4, 0xafd581f4, 0xadd5c1f4, 
-    0xb3d601f5, 0xb1d641f5, 0xb7d681f5, 0xb5d6c1f5, 0xbbd701f5, 0xb9d741f5, 0xbfd781f5, 0xbdd7c1f5, 
-    0xc3d801f2, 0xc1d841f2, 0xc7d881f2, 0xc5d8c1f2, 0xcbd901f2, 0xc9d941f2, 0xcfd981f2, 0xcdd9c1f2, 
-    0xd3da01f3, 0xd1da41f3, 0xd7da81f3, 0xd5dac1f3, 0xdbdb01f3, 0xd9db41f3, 0xdfdb81f3, 0xdddbc1f3, 
-    0xe3dc01f0, 0xe1dc41f0, 0xe7dc81f0, 0xe5dcc1f0, 0xebdd01f0, 0xe9dd41f0, 0xefdd81f0, 0xedddc1f0, 
-    0xf3de01f1, 0xf1de41f1, 0xf7de81f1, 0xf5dec1f1, 0xfbdf01f1, 0xf9df41f1, 0xffdf81f1, 0xfddfc1f1, 
-    0x03e001ef, 0x01e041ef, 0x07e081ef, 0x05e0c1ef, 0x0be101ef, 0x09e141ef, 0x0fe181ef, 0x0de1c1ef, 
-    0x13e201ee, 0x11e241ee, 0x17e281ee, 0x15e2c1ee, 0x1be301ee, 0x19e341ee, 0x1fe381ee, 0x1de3c1ee, 
-    0x23e401ed, 0x21e441ed, 0x27e481ed, 0x25e4c1ed, 0x2be501ed, 0x29e541ed, 0x2fe581ed, 0x2de5c1ed, 
-    0x33e601ec, 0x31e641ec, 0x37e681ec, 0x35e6c1ec, 0x3be701ec, 0x39e741ec, 0x3fe781ec, 0x3de7c1ec, 
-    0x43e801eb, 0x41e841eb, 0x47e881eb, 0x45e8c1eb, 0x4be901eb, 0x49e941eb, 0x4fe981eb, 0x4de9c1eb, 
-    0x53ea01ea, 0x51ea41ea, 0x57ea81ea, 0x55eac1ea, 0x5beb01ea, 0x59eb41ea, 0x5feb81ea, 0x5debc1ea, 
-    0x63ec01e9, 0x61ec41e9, 0x67ec81e9, 0x65ecc1e9, 0x6bed01e9, 0x69ed41e9, 0x6fed81e9, 0x6dedc1e9, 
-    0x73ee01e8, 0x71ee41e8, 0x77ee81e8, 0x75eec1e8, 0x7bef01e8, 0x79ef41e8, 0x7fef81e8, 0x7defc1e8, 
-    0x83f001e7, 0x81f041e7, 0x87f081e7, 0x85f0c1e7, 0x8bf101e7, 0x89f141e7, 0x8ff181e7, 0x8df1c1e7, 
-    0x93f201e6, 0x91f241e6, 0x97f281e6, 0x95f2c1e6, 0x9bf301e6, 0x99f341e6, 0x9ff381e6, 0x9df3c1e6, 
-    0xa3f401e5, 0xa1f441e5, 0xa7f481e5, 0xa5f4c1e5, 0xabf501e5, 0xa9f541e5, 0xaff581e5, 0xadf5c1e5, 
-    0xb3f601e4, 0xb1f641e4, 0xb7f681e4, 0xb5f6c1e4, 0xbbf701e4, 0xb9f741e4, 0xbff781e4, 0xbdf7c1e4, 
-    0xc3f801e3, 0xc1f841e3, 0xc7f881e3, 0xc5f8c1e3, 0xcbf901e3, 0xc9f941e3, 0xcff981e3, 0xcdf9c1e3, 
-    0xd3fa01e2, 0xd1fa41e2, 0xd7fa81e2, 0xd5fac1e2, 0xdbfb01e2, 0xd9fb41e2, 0xdffb81e2, 0xddfbc1e2, 
-    0xe3fc01e1, 0xe1fc41e1, 0xe7fc81e1, 0xe5fcc1e1, 0xebfd01e1, 0xe9fd41e1, 0xeffd81e1, 0xedfdc1e1, 
-    0xf3fe01e0, 0xf1fe41e0, 0xf7fe81e0, 0xf5fec1e0, 0xfbff01e0, 0xf9ff41e0, 0xffff81e0, 0xfdffc1e0 
-};
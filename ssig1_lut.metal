@@ -1,514 +0,0 @@
-constant uint SSIG1_LUT[4096] = {
-    0x00000000, 0x0000a000, 0x00014000, 0x0001e000, 0x00028000, 0x00022000, 0x0003c000, 0x00036000, 
-    0x00050000, 0x0005a000, 0x00044000, 0x0004e000, 0x00078000, 0x00072000, 0x0006c000, 0x00066000, 
-    0x000a0000, 0x000aa000, 0x000b4000, 0x000be000, 0x00088000, 0x00082000, 0x0009c000, 0x00096000, 
-    0x000f0000, 0x000fa000, 0x000e4000, 0x000ee000, 0x000d8000, 0x000d2000, 0x000cc000, 0x000c6000, 
-    0x00140000, 0x0014a000, 0x00154000, 0x0015e000, 0x00168000, 0x00162000, 0x0017c000, 0x00176000, 
-    0x00110000, 0x0011a000, 0x00104000, 0x0010e000, 0x00138000, 0x00132000, 0x0012c000, 0x00126000, 
-    0x001e0000, 0x001ea000, 0x001f4000, 0x001fe000, 0x001c8000, 0x001c2000, 0x001dc000, 0x001d6000, 
-    0x001b0000, 0x001ba000, 0x001a4000, 0x001ae000, 0x00198000, 0x00192000, 0x0018c000, 0x00186000, 
-    0x00280000, 0x0028a000, 0x00294000, 0x0029e000, 0x002a8000, 0x002a2000, 0x002bc000, 0x002b6000, 
-    0x002d0000, 0x002da000, 0x002c4000, 0x002ce000, 0x002f8000, 0x002f2000, 0x002ec000, 0x002e6000, 
-    0x00220000, 0x0022a000, 0x00234000, 0x0023e000, 0x00208000, 0x00202000, 0x0021c000, 0x00216000, 
-    0x00270000, 0x0027a000, 0x00264000, 0x0026e000, 0x00258000, 0x00252000, 0x0024c000, 0x00246000, 
-    0x003c0000, 0x003ca000, 0x003d4000, 0x003de000, 0x003e8000, 0x003e2000, 0x003fc000, 0x003f6000, 
-    0x00390000, 0x0039a000, 0x00384000, 0x0038e000, 0x003b8000, 0x003b2000, 0x003ac000, 0x003a6000, 
-    0x00360000, 0x0036a000, 0x00374000, 0x0037e000, 0x00348000, 0x00342000, 0x0035c000, 0x00356000, 
-    0x00330000, 0x0033a000, 0x00324000, 0x0032e000, 0x00318000, 0x00312000, 0x0030c000, 0x00306000, 
-    0x00500000, 0x0050a000, 0x00514000, 0x0051e000, 0x00528000, 0x00522000, 0x0053c000, 0x00536000, 
-    0x00550000, 0x0055a000, 0x00544000, 0x0054e000, 0x00578000, 0x00572000, 0x0056c000, 0x00566000, 
-    0x005a0000, 0x005aa000, 0x005b4000, 0x005be000, 0x00588000, 0x00582000, 0x0059c000, 0x00596000, 
-    0x005f0000, 0x005fa000, 0x005e4000, 0x005ee000, 0x005d8000, 0x005d2000, 0x005cc000, 0x005c6000, 
-    0x00440000, 0x0044a000, 0x00454000, 0x0045e000, 0x00468000, 0x00462000, 0x0047c000, 0x00476000, 
-    0x00410000, 0x0041a000, 0x00404000, 0x0040e000, 0x00438000, 0x00432000, 0x0042c000, 0x00426000, 
-    0x004e0000, 0x004ea000, 0x004f4000, 0x004fe000, 0x004c8000, 0x004c2000, 0x004dc000, 0x004d6000, 
-    0x004b0000, 0x004ba000, 0x004a4000, 0x004ae000, 0x00498000, 0x00492000, 0x0048c000, 0x00486000, 
-    0x00780000, 0x0078a000, 0x00794000, 0x0079e000, 0x007a8000, 0x007a2000, 0x007bc000, 0x007b6000, 
-    0x007d0000, 0x007da000, 0x007c4000, 0x007ce000, 0x007f8000, 0x007f2000, 0x007ec000, 0x007e6000, 
-    0x00720000, 0x0072a000, 0x00734000, 0x0073e000, 0x00708000, 0x00702000, 0x0071c000, 0x00716000, 
-    0x00770000, 0x0077a000, 0x00764000, 0x0076e000, 0x00758000, 0x00752000, 0x0074c000, 0x00746000, 
-    0x006c0000, 0x006ca000, 0x006d4000, 0x006de000, 0x006e8000, 0x006e2000, 0x006fc000, 0x006f6000, 
-    0x00690000, 0x0069a000, 0x00684000, 0x0068e000, 0x006b8000, 0x006b2000, 0x006ac000, 0x006a6000, 
-    0x00660000, 0x0066a000, 0x00674000, 0x0067e000, 0x00648000, 0x00642000, 0x0065c000, 0x00656000, 
-    0x00630000, 0x0063a000, 0x00624000, 0x0062e000, 0x00618000, 0x00612000, 0x0060c000, 0x00606000, 
-    0x00a00000, 0x00a0a000, 0x00a14000, 0x00a1e000, 0x00a28000, 0x00a22000, 0x00a3c000, 0x00a36000, 
-    0x00a50000, 0x00a5a000, 0x00a44000, 0x00a4e000, 0x00a78000, 0x00a72000, 0x00a6c000, 0x00a66000, 
-    0x00aa0000, 0x00aaa000, 0x00ab4000, 0x00abe000, 0x00a88000, 0x00a82000, 0x00a9c000, 0x00a96000, 
-    0x00af0000, 0x00afa000, 0x00ae4000, 0x00aee000, 0x00ad8000, 0x00ad2000, 0x00acc000, 0x00ac6000, 
-    0x00b40000, 0x00b4a000, 0x00b54000, 0x00b5e000, 0x00b68000, 0x00b62000, 0x00b7c000, 0x00b76000, 
-    0x00b10000, 0x00b1a000, 0x00b04000, 0x00b0e000, 0x00b38000, 0x00b32000, 0x00b2c000, 0x00b26000, 
-    0x00be0000, 0x00bea000, 0x00bf4000, 0x00bfe000, 0x00bc8000, 0x00bc2000, 0x00bdc000, 0x00bd6000, 
-    0x00bb0000, 0x00bba000, 0x00ba4000, 0x00bae000, 0x00b98000, 0x00b92000, 0x00b8c000, 0x00b86000, 
-    0x00880000, 0x0088a000, 0x00894000, 0x0089e000, 0x008a8000, 0x008a2000, 0x008bc000, 0x008b6000, 
-    0x008d0000, 0x008da000, 0x008c4000, 0x008ce000, 0x008f8000, 0x008f2000, 0x008ec000, 0x008e6000, 
-    0x00820000, 0x0082a000, 0x00834000, 0x0083e000, 0x00808000, 0x00802000, 0x0081c000, 0x00816000, 
-    0x00870000, 0x0087a000, 0x00864000, 0x0086e000, 0x00858000, 0x00852000, 0x0084c000, 0x00846000, 
-    0x009c0000, 0x009ca000, 0x009d4000, 0x009de000, 0x009e8000, 0x009e2000, 0x009fc000, 0x009f6000, 
-    0x00990000, 0x0099a000, 0x00984000, 0x0098e000, 0x009b8000, 0x009b2000, 0x009ac000, 0x009a6000, 
-    0x00960000, 0x0096a000, 0x00974000, 0x0097e000, 0x00948000, 0x00942000, 0x0095c000, 0x00956000, 
-    0x00930000, 0x0093a000, 0x00924000, 0x0092e000, 0x00918000, 0x00912000, 0x0090c000, 0x00906000, 
-    0x00f00000, 0x00f0a000, 0x00f14000, 0x00f1e000, 0x00f28000, 0x00f22000, 0x00f3c000, 0x00f36000, 
-    0x00f50000, 0x00f5a000, 0x00f44000, 0x00f4e000, 0x00f78000, 0x00f72000, 0x00f6c000, 0x00f66000, 
-    0x00fa0000, 0x00faa000, 0x00fb4000, 0x00fbe000, 0x00f88000, 0x00f82000, 0x00f9c000, 0x00f96000, 
-    0x00ff0000, 0x00ffa000, 0x00fe4000, 0x00fee000, 0x00fd8000, 0x00fd2000, 0x00fcc000, 0x00fc6000, 
-    0x00e40000, 0x00e4a000, 0x00e54000, 0x00e5e000, 0x00e68000, 0x00e62000, 0x00e7c000, 0x00e76000, 
-    0x00e10000, 0x00e1a000, 0x00e04000, 0x00e0e000, 0x00e38000, 0x00e32000, 0x00e2c000, 0x00e26000, 
-    0x00ee0000, 0x00eea000, 0x00ef4000, 0x00efe000, 0x00ec8000, 0x00ec2000, 0x00edc000, 0x00ed6000, 
-    0x00eb0000, 0x00eba000, 0x00ea4000, 0x00eae000, 0x00e98000, 0x00e92000, 0x00e8c000, 0x00e86000, 
-    0x00d80000, 0x00d8a000, 0x00d94000, 0x00d9e000, 0x00da8000, 0x00da2000, 0x00dbc000, 0x00db6000, 
-    0x00dd0000, 0x00dda000, 0x00dc4000, 0x00dce000, 0x00df8000, 0x00df2000, 0x00dec000, 0x00de6000, 
-    0x00d20000, 0x00d2a000, 0x00d34000, 0x00d3e000, 0x00d08000, 0x00d02000, 0x00d1c000, 0x00d16000, 
-    0x00d70000, 0x00d7a000, 0x00d64000, 0x00d6e000, 0x00d58000, 0x00d52000, 0x00d4c000, 0x00d46000, 
-    0x00cc0000, 0x00cca000, 0x00cd4000, 0x00cde000, 0x00ce8000, 0x00ce2000, 0x00cfc000, 0x00cf6000, 
-    0x00c90000, 0x00c9a000, 0x00c84000, 0x00c8e000, 0x00cb8000, 0x00cb2000, 0x00cac000, 0x00ca6000, 
-    0x00c60000, 0x00c6a000, 0x00c74000, 0x00c7e000, 0x00c48000, 0x00c42000, 0x00c5c000, 0x00c56000, 
-    0x00c30000, 0x00c3a000, 0x00c24000, 0x00c2e000, 0x00c18000, 0x00c12000, 0x00c0c000, 0x00c06000, 
-    0x01400000, 0x0140a000, 0x01414000, 0x0141e000, 0x01428000, 0x01422000, 0x0143c000, 0x01436000, 
-    0x01450000, 0x0145a000, 0x01444000, 0x0144e000, 0x01478000, 0x01472000, 0x0146c000, 0x01466000, 
-    0x014a0000, 0x014aa000, 0x014b4000, 0x014be000, 0x01488000, 0x01482000, 0x0149c000, 0x01496000, 
-    0x014f0000, 0x014fa000, 0x014e4000, 0x014ee000, 0x014d8000, 0x014d2000, 0x014cc000, 0x014c6000, 
-    0x01540000, 0x0154a000, 0x01554000, 0x0155e000, 0x01568000, 0x01562000, 0x0157c000, 0x01576000, 
-    0x01510000, 0x0151a000, 0x01504000, 0x0150e000, 0x01538000, 0x01532000, 0x0152c000, 0x01526000, 
-    0x015e0000, 0x015ea000, 0x015f4000, 0x015fe000, 0x015c8000, 0x015c2000, 0x015dc000, 0x015d6000, 
-    0x015b0000, 0x015ba000, 0x015a4000, 0x015ae000, 0x01598000, 0x01592000, 0x0158c000, 0x01586000, 
-    0x01680000, 0x0168a000, 0x01694000, 0x0169e000, 0x016a8000, 0x016a2000, 0x016bc000, 0x016b6000, 
-    0x016d0000, 0x016da000, 0x016c4000, 0x016ce000, 0x016f8000, 0x016f2000, 0x016ec000, 0x016e6000, 
-    0x01620000, 0x0162a000, 0x01634000, 0x0163e000, 0x01608000, 0x01602000, 0x0161c000, 0x01616000, 
-    0x01670000, 0x0167a000, 0x01664000, 0x0166e000, 0x01658000, 0x01652000, 0x0164c000, 0x01646000, 
-    0x017c0000, 0x017ca000, 0x017d4000, 0x017de000, 0x017e8000, 0x017e2000, 0x017fc000, 0x017f6000, 
-    0x01790000, 0x0179a000, 0x01784000, 0x0178e000, 0x017b8000, 0x017b2000, 0x017ac000, 0x017a6000, 
-    0x01760000, 0x0176a000, 0x01774000, 0x0177e000, 0x01748000, 0x01742000, 0x0175c000, 0x01756000, 
-    0x01730000, 0x0173a000, 0x01724000, 0x0172e000, 0x01718000, 0x01712000, 0x0170c000, 0x01706000, 
-    0x01100000, 0x0110a000, 0x01114000, 0x0111e000, 0x01128000, 0x01122000, 0x0113c000, 0x01136000, 
-    0x01150000, 0x0115a000, 0x01144000, 0x0114e000, 0x01178000, 0x01172000, 0x0116c000, 0x01166000, 
-    0x011a0000, 0x011aa000, 0x011b4000, 0x011be000, 0x01188000, 0x01182000, 0x0119c000, 0x01196000, 
-    0x011f0000, 0x011fa000, 0x011e4000, 0x011ee000, 0x011d8000, 0x011d2000, 0x011cc000, 0x011c6000, 
-    0x01040000, 0x0104a000, 0x01054000, 0x0105e000, 0x01068000, 0x01062000, 0x0107c000, 0x01076000, 
-    0x01010000, 0x0101a000, 0x01004000, 0x0100e000, 0x01038000, 0x01032000, 0x0102c000, 0x01026000, 
-    0x010e0000, 0x010ea000, 0x010f4000, 0x010fe000, 0x010c8000, 0x010c2000, 0x010dc000, 0x010d6000, 
-    0x010b0000, 0x010ba000, 0x010a4000, 0x010ae000, 0x01098000, 0x01092000, 0x0108c000, 0x01086000, 
-    0x01380000, 0x0138a000, 0x01394000, 0x0139e000, 0x013a8000, 0x013a2000, 0x013bc000, 0x013b6000, 
-    0x013d0000, 0x013da000, 0x013c4000, 0x013ce000, 0x013f8000, 0x013f2000, 0x013ec000, 0x013e6000, 
-    0x01320000, 0x0132a000, 0x01334000, 0x0133e000, 0x01308000, 0x01302000, 0x0131c000, 0x01316000, 
-    0x01370000, 0x0137a000, 0x01364000, 0x0136e000, 0x01358000, 0x01352000, 0x0134c000, 0x01346000, 
-    0x012c0000, 0x012ca000, 0x012d4000, 0x012de000, 0x012e8000, 0x012e2000, 0x012fc000, 0x012f6000, 
-    0x01290000, 0x0129a000, 0x01284000, 0x0128e000, 0x012b8000, 0x012b2000, 0x012ac000, 0x012a6000, 
-    0x01260000, 0x0126a000, 0x01274000, 0x0127e000, 0x01248000, 0x01242000, 0x0125c000, 0x01256000, 
-    0x01230000, 0x0123a000, 0x01224000, 0x0122e000, 0x01218000, 0x01212000, 0x0120c000, 0x01206000, 
-    0x01e00000, 0x01e0a000, 0x01e14000, 0x01e1e000, 0x01e28000, 0x01e22000, 0x01e3c000, 0x01e36000, 
-    0x01e50000, 0x01e5a000, 0x01e44000, 0x01e4e000, 0x01e78000, 0x01e72000, 0x01e6c000, 0x01e66000, 
-    0x01ea0000, 0x01eaa000, 0x01eb4000, 0x01ebe000, 0x01e88000, 0x01e82000, 0x01e9c000, 0x01e96000, 
-    0x01ef0000, 0x01efa000, 0x01ee4000, 0x01eee000, 0x01ed8000, 0x01ed2000, 0x01ecc000, 0x01ec6000, 
-    0x01f40000, 0x01f4a000, 0x01f54000, 0x01f5e000, 0x01f68000, 0x01f62000, 0x01f7c000, 0x01f76000, 
-    0x01f10000, 0x01f1a000, 0x01f04000, 0x01f0e000, 0x01f38000, 0x01f32000, 0x01f2c000, 0x01f26000, 
-    0x01fe0000, 0x01fea000, 0x01ff4000, 0x01ffe000, 0x01fc8000, 0x01fc2000, 0x01fdc000, 0x01fd6000, 
-    0x01fb0000, 0x01fba000, 0x01fa4000, 0x01fae000, 0x01f98000, 0x01f92000, 0x01f8c000, 0x01f86000, 
-    0x01c80000, 0x01c8a000, 0x01c94000, 0x01c9e000, 0x01ca8000, 0x01ca2000, 0x01cbc000, 0x01cb6000, 
-    0x01cd0000, 0x01cda000, 0x01cc4000, 0x01cce000, 0x01cf8000, 0x01cf2000, 0x01cec000, 0x01ce6000, 
-    0x01c20000, 0x01c2a000, 0x01c34000, 0x01c3e000, 0x01c08000, 0x01c02000, 0x01c1c000, 0x01c16000, 
-    0x01c70000, 0x01c7a000, 0x01c64000, 0x01c6e000, 0x01c58000, 0x01c52000, 0x01c4c000, 0x01c46000, 
-    0x01dc0000, 0x01dca000, 0x01dd4000, 0x01dde000, 0x01de8000, 0x01de2000, 0x01dfc000, 0x01df6000, 
-    0x01d90000, 0x01d9a000, 0x01d84000, 0x01d8e000, 0x01db8000, 0x01db2000, 0x01dac000, 0x01da6000, 
-    0x01d60000, 0x01d6a000, 0x01d74000, 0x01d7e000, 0x01d48000, 0x01d42000, 0x01d5c000, 0x01d56000, 
-    0x01d30000, 0x01d3a000, 0x01d24000, 0x01d2e000, 0x01d18000, 0x01d12000, 0x01d0c000, 0x01d06000, 
-    0x01b00000, 0x01b0a000, 0x01b14000, 0x01b1e000, 0x01b28000, 0x01b22000, 0x01b3c000, 0x01b36000, 
-    0x01b50000, 0x01b5a000, 0x01b44000, 0x01b4e000, 0x01b78000, 0x01b72000, 0x01b6c000, 0x01b66000, 
-    0x01ba0000, 0x01baa000, 0x01bb4000, 0x01bbe000, 0x01b88000, 0x01b82000, 0x01b9c000, 0x01b96000, 
-    0x01bf0000, 0x01bfa000, 0x01be4000, 0x01bee000, 0x01bd8000, 0x01bd2000, 0x01bcc000, 0x01bc6000, 
-    0x01a40000, 0x01a4a000, 0x01a54000, 0x01a5e000, 0x01a68000, 0x01a62000, 0x01a7c000, 0x01a76000, 
-    0x01a10000, 0x01a1a000, 0x01a04000, 0x01a0e000, 0x01a38000, 0x01a32000, 0x01a2c000, 0x01a26000, 
-    0x01ae0000, 0x01aea000, 0x01af4000, 0x01afe000, 0x01ac8000, 0x01ac2000, 0x01adc000, 0x01ad6000, 
-    0x01ab0000, 0x01aba000, 0x01aa4000, 0x01aae000, 0x01a98000, 0x01a92000, 0x01a8c000, 0x01a86000, 
-    0x01980000, 0x0198a000, 0x01994000, 0x0199e000, 0x019a8000, 0x019a2000, 0x019bc000, 0x019b6000, 
-    0x019d0000, 0x019da000, 0x019c4000, 0x019ce000, 0x019f8000, 0x019f2000, 0x019ec000, 0x019e6000, 
-    0x01920000, 0x0192a000, 0x01934000, 0x0193e000, 0x01908000, 0x01902000, 0x0191c000, 0x01916000, 
-    0x01970000, 0x0197a000, 0x01964000, 0x0196e000, 0x01958000, 0x01952000, 0x0194c000, 0x01946000, 
-    0x018c0000, 0x018ca000, 0x018d4000, 0x018de000, 0x018e8000, 0x018e2000, 0x018fc000, 0x018f6000, 
-    0x01890000, 0x0189a000, 0x01884000, 0x0188e000, 0x018b8000, 0x018b2000, 0x018ac000, 0x018a6000, 
-    0x01860000, 0x0186a000, 0x01874000, 0x0187e000, 0x01848000, 0x01842000, 0x0185c000, 0x01856000, 
-    0x01830000, 0x0183a000, 0x01824000, 0x0182e000, 0x01818000, 0x01812000, 0x0180c000, 0x01806000, 
-    0x02800001, 0x0280a001, 0x02814001, 0x0281e001, 0x02828001, 0x02822001, 0x0283c001, 0x02836001, 
-    0x02850001, 0x0285a001, 0x02844001, 0x0284e001, 0x02878001, 0x02872001, 0x0286c001, 0x02866001, 
-    0x028a0001, 0x028aa001, 0x028b4001, 0x028be001, 0x02888001, 0x02882001, 0x0289c001, 0x02896001, 
-    0x028f0001, 0x028fa001, 0x028e4001, 0x028ee001, 0x028d8001, 0x028d2001, 0x028cc001, 0x028c6001, 
-    0x02940001, 0x0294a001, 0x02954001, 0x0295e001, 0x02968001, 0x02962001, 0x0297c001, 0x02976001, 
-    0x02910001, 0x0291a001, 0x02904001, 0x0290e001, 0x02938001, 0x02932001, 0x0292c001, 0x02926001, 
-    0x029e0001, 0x029ea001, 0x029f4001, 0x029fe001, 0x029c8001, 0x029c2001, 0x029dc001, 0x029d6001, 
-    0x029b0001, 0x029ba001, 0x029a4001, 0x029ae001, 0x02998001, 0x02992001, 0x0298c001, 0x02986001, 
-    0x02a80001, 0x02a8a001, 0x02a94001, 0x02a9e001, 0x02aa8001, 0x02aa2001, 0x02abc001, 0x02ab6001, 
-    0x02ad0001, 0x02ada001, 0x02ac4001, 0x02ace001, 0x02af8001, 0x02af2001, 0x02aec001, 0x02ae6001, 
-    0x02a20001, 0x02a2a001, 0x02a34001, 0x02a3e001, 0x02a08001, 0x02a02001, 0x02a1c001, 0x02a16001, 
-    0x02a70001, 0x02a7a001, 0x02a64001, 0x02a6e001, 0x02a58001, 0x02a52001, 0x02a4c001, 0x02a46001, 
-    0x02bc0001, 0x02bca001, 0x02bd4001, 0x02bde001, 0x02be8001, 0x02be2001, 0x02bfc001, 0x02bf6001, 
-    0x02b90001, 0x02b9a001, 0x02b84001, 0x02b8e001, 0x02bb8001, 0x02bb2001, 0x02bac001, 0x02ba6001, 
-    0x02b60001, 0x02b6a001, 0x02b74001, 0x02b7e001, 0x02b48001, 0x02b42001, 0x02b5c001, 0x02b56001, 
-    0x02b30001, 0x02b3a001, 0x02b24001, 0x02b2e001, 0x02b18001, 0x02b12001, 0x02b0c001, 0x02b06001, 
-    0x02d00001, 0x02d0a001, 0x02d14001, 0x02d1e001, 0x02d28001, 0x02d22001, 0x02d3c001, 0x02d36001, 
-    0x02d50001, 0x02d5a001, 0x02d44001, 0x02d4e001, 0x02d78001, 0x02d72001, 0x02d6c001, 0x02d66001, 
-    0x02da0001, 0x02daa001, 0x02db4001, 0x02dbe001, 0x02d88001, 0x02d82001, 0x02d9c001, 0x02d96001, 
-    0x02df0001, 0x02dfa001, 0x02de4001, 0x02dee001, 0x02dd8001, 0x02dd2001, 0x02dcc001, 0x02dc6001, 
-    0x02c40001, 0x02c4a001, 0x02c54001, 0x02c5e001, 0x02c68001, 0x02c62001, 0x02c7c001, 0x02c76001, 
-    0x02c10001, 0x02c1a001, 0x02c04001, 0x02c0e001, 0x02c38001, 0x02c32001, 0x02c2c001, 0x02c26001, 
-    0x02ce0001, 0x02cea001, 0x02cf4001, 0x02cfe001, 0x02cc8001, 0x02cc2001, 0x02cdc001, 0x02cd6001, 
-    0x02cb0001, 0x02cba001, 0x02ca4001, 0x02cae001, 0x02c98001, 0x02c92001, 0x02c8c001, 0x02c86001, 
-    0x02f80001, 0x02f8a001, 0x02f94001, 0x02f9e001, 0x02fa8001, 0x02fa2001, 0x02fbc001, 0x02fb6001, 
-    0x02fd0001, 0x02fda001, 0x02fc4001, 0x02fce001, 0x02ff8001, 0x02ff2001, 0x02fec001, 0x02fe6001, 
-    0x02f20001, 0x02f2a001, 0x02f34001, 0x02f3e001, 0x02f08001, 0x02f02001, 0x02f1c001, 0x02f16001, 
-    0x02f70001, 0x02f7a001, 0x02f64001, 0x02f6e001, 0x02f58001, 0x02f52001, 0x02f4c001, 0x02f46001, 
-    0x02ec0001, 0x02eca001, 0x02ed4001, 0x02ede001, 0x02ee8001, 0x02ee2001, 0x02efc001, 0x02ef6001, 
-    0x02e90001, 0x02e9a001, 0x02e84001, 0x02e8e001, 0x02eb8001, 0x02eb2001, 0x02eac001, 0x02ea6001, 
-    0x02e60001, 0x02e6a001, 0x02e74001, 0x02e7e001, 0x02e48001, 0x02e42001, 0x02e5c001, 0x02e56001, 
-    0x02e30001, 0x02e3a001, 0x02e24001, 0x02e2e001, 0x02e18001, 0x02e12001, 0x02e0c001, 0x02e06001, 
-    0x02200001, 0x0220a001, 0x02214001, 0x0221e001, 0x02228001, 0x02222001, 0x0223c001, 0x02236001, 
-    0x02250001, 0x0225a001, 0x02244001, 0x0224e001, 0x02278001, 0x02272001, 0x0226c001, 0x02266001, 
-    0x022a0001, 0x022aa001, 0x022b4001, 0x022be001, 0x02288001, 0x02282001, 0x0229c001, 0x02296001, 
-    0x022f0001, 0x022fa001, 0x022e4001, 0x022ee001, 0x022d8001, 0x022d2001, 0x022cc001, 0x022c6001, 
-    0x02340001, 0x0234a001, 0x02354001, 0x0235e001, 0x02368001, 0x02362001, 0x0237c001, 0x02376001, 
-    0x02310001, 0x0231a001, 0x02304001, 0x0230e001, 0x02338001, 0x02332001, 0x0232c001, 0x02326001, 
-    0x023e0001, 0x023ea001, 0x023f4001, 0x023fe001, 0x023c8001, 0x023c2001, 0x023dc001, 0x023d6001, 
-    0x023b0001, 0x023ba001, 0x023a4001, 0x023ae001, 0x02398001, 0x02392001, 0x0238c001, 0x02386001, 
-    0x02080001, 0x0208a001, 0x02094001, 0x0209e001, 0x020a8001, 0x020a2001, 0x020bc001, 0x020b6001, 
-    0x020d0001, 0x020da001, 0x020c4001, 0x020ce001, 0x020f8001, 0x020f2001, 0x020ec001, 0x020e6001, 
-    0x02020001, 0x0202a001, 0x02034001, 0x0203e001, 0x02008001, 0x02002001, 0x0201c001, 0x02016001, 
-    0x02070001, 0x0207a001, 0x02064001, 0x0206e001, 0x02058001, 0x02052001, 0x0204c001, 0x02046001, 
-    0x021c0001, 0x021ca001, 0x021d4001, 0x021de001, 0x021e8001, 0x021e2001, 0x021fc001, 0x021f6001, 
-    0x02190001, 0x0219a001, 0x02184001, 0x0218e001, 0x021b8001, 0x021b2001, 0x021ac001, 0x021a6001, 
-    0x02160001, 0x0216a001, 0x02174001, 0x0217e001, 0x02148001, 0x02142001, 0x0215c001, 0x02156001, 
-    0x02130001, 0x0213a001, 0x02124001, 0x0212e001, 0x02118001, 0x02112001, 0x0210c001, 0x02106001, 
-    0x02700001, 0x0270a001, 0x02714001, 0x0271e001, 0x02728001, 0x02722001, 0x0273c001, 0x02736001, 
-    0x02750001, 0x0275a001, 0x02744001, 0x0274e001, 0x02778001, 0x02772001, 0x0276c001, 0x02766001, 
-    0x027a0001, 0x027aa001, 0x027b4001, 0x027be001, 0x02788001, 0x02782001, 0x0279c001, 0x02796001, 
-    0x027f0001, 0x027fa001, 0x027e4001, 0x027ee001, 0x027d8001, 0x027d2001, 0x027cc001, 0x027c6001, 
-    0x02640001, 0x0264a001, 0x02654001, 0x0265e001, 0x02668001, 0x02662001, 0x0267c001, 0x02676001, 
-    0x02610001, 0x0261a001, 0x02604001, 0x0260e001, 0x02638001, 0x02632001, 0x0262c001, 0x02626001, 
-    0x026e0001, 0x026ea001, 0x026f4001, 0x026fe001, 0x026c8001, 0x026c2001, 0x026dc001, 0x026d6001, 
-    0x026b0001, 0x026ba001, 0x026a4001, 0x026ae001, 0x02698001, 0x02692001, 0x0268c001, 0x02686001, 
-    0x02580001, 0x0258a001, 0x02594001, 0x0259e001, 0x025a8001, 0x025a2001, 0x025bc001, 0x025b6001, 
-    0x025d0001, 0x025da001, 0x025c4001, 0x025ce001, 0x025f8001, 0x025f2001, 0x025ec001, 0x025e6001, 
-    0x02520001, 0x0252a001, 0x02534001, 0x0253e001, 0x02508001, 0x02502001, 0x0251c001, 0x02516001, 
-    0x02570001, 0x0257a001, 0x02564001, 0x0256e001, 0x02558001, 0x02552001, 0x0254c001, 0x02546001, 
-    0x024c0001, 0x024ca001, 0x024d4001, 0x024de001, 0x024e8001, 0x024e2001, 0x024fc001, 0x024f6001, 
-    0x02490001, 0x0249a001, 0x02484001, 0x0248e001, 0x024b8001, 0x024b2001, 0x024ac001, 0x024a6001, 
-    0x02460001, 0x0246a001, 0x02474001, 0x0247e001, 0x02448001, 0x02442001, 0x0245c001, 0x02456001, 
-    0x02430001, 0x0243a001, 0x02424001, 0x0242e001, 0x02418001, 0x02412001, 0x0240c001, 0x02406001, 
-    0x03c00001, 0x03c0a001, 0x03c14001, 0x03c1e001, 0x03c28001, 0x03c22001, 0x03c3c001, 0x03c36001, 
-    0x03c50001, 0x03c5a001, 0x03c44001, 0x03c4e001, 0x03c78001, 0x03c72001, 0x03c6c001, 0x03c66001, 
-    0x03ca0001, 0x03caa001, 0x03cb4001, 0x03cbe001, 0x03c88001, 0x03c82001, 0x03c9c001, 0x03c96001, 
-    0x03cf0001, 0x03cfa001, 0x03ce4001, 0x03cee001, 0x03cd8001, 0x03cd2001, 0x03ccc001, 0x03cc6001, 
-    0x03d40001, 0x03d4a001, 0x03d54001, 0x03d5e001, 0x03d68001, 0x03d62001, 0x03d7c001, 0x03d76001, 
-    0x03d10001, 0x03d1a001, 0x03d04001, 0x03d0e001, 0x03d38001, 0x03d32001, 0x03d2c001, 0x03d26001, 
-    0x03de0001, 0x03dea001, 0x03df4001, 0x03dfe001, 0x03dc8001, 0x03dc2001, 0x03ddc001, 0x03dd6001, 
-    0x03db0001, 0x03dba001, 0x03da4001, 0x03dae001, 0x03d98001, 0x03d92001, 0x03d8c001, 0x03d86001, 
-    0x03e80001, 0x03e8a001, 0x03e94001, 0x03e9e001, 0x03ea8001, 0x03ea2001, 0x03ebc001, 0x03eb6001, 
-    0x03ed0001, 0x03eda001, 0x03ec4001, 0x03ece001, 0x03ef8001, 0x03ef2001, 0x03eec001, 0x03ee6001, 
-    0x03e20001, 0x03e2a001, 0x03e34001, 0x03e3e001, 0x03e08001, 0x03e02001, 0x03e1c001, 0x03e16001, 
-    0x03e70001, 0x03e7a001, 0x03e64001, 0x03e6e001, 0x03e58001, 0x03e52001, 0x03e4c001, 0x03e46001, 
-    0x03fc0001, 0x03fca001, 0x03fd4001, 0x03fde001, 0x03fe8001, 0x03fe2001, 0x03ffc001, 0x03ff6001, 
-    0x03f90001, 0x03f9a001, 0x03f84001, 0x03f8e001, 0x03fb8001, 0x03fb2001, 0x03fac001, 0x03fa6001, 
-    0x03f60001, 0x03f6a001, 0x03f74001, 0x03f7e001, 0x03f48001, 0x03f42001, 0x03f5c001, 0x03f56001, 
-    0x03f30001, 0x03f3a001, 0x03f24001, 0x03f2e001, 0x03f18001, 0x03f12001, 0x03f0c001, 0x03f06001, 
-    0x03900001, 0x0390a001, 0x03914001, 0x0391e001, 0x03928001, 0x03922001, 0x0393c001, 0x03936001, 
-    0x03950001, 0x0395a001, 0x03944001, 0x0394e001, 0x03978001, 0x03972001, 0x0396c001, 0x03966001, 
-    0x039a0001, 0x039aa001, 0x039b4001, 0x039be001, 0x03988001, 0x03982001, 0x0399c001, 0x03996001, 
-    0x039f0001, 0x039fa001, 0x039e4001, 0x039ee001, 0x039d8001, 0x039d2001, 0x039cc001, 0x039c6001, 
-    0x03840001, 0x0384a001, 0x03854001, 0x0385e001, 0x03868001, 0x03862001, 0x0387c001, 0x03876001, 
-    0x03810001, 0x0381a001, 0x03804001, 0x0380e001, 0x03838001, 0x03832001, 0x0382c001, 0x03826001, 
-    0x038e0001, 0x038ea001, 0x038f4001, 0x038fe001, 0x038c8001, 0x038c2001, 0x038dc001, 0x038d6001, 
-    0x038b0001, 0x038ba001, 0x038a4001, 0x038ae001, 0x03898001, 0x03892001, 0x0388c001, 0x03886001, 
-    0x03b80001, 0x03b8a001, 0x03b94001, 0x03b9e001, 0x03ba8001, 0x03ba2001, 0x03bbc001, 0x03bb6001, 
-    0x03bd0001, 0x03bda001, 0x03bc4001, 0x03bce001, 0x03bf8001, 0x03bf2001, 0x03bec001, 0x03be6001, 
-    0x03b20001, 0x03b2a001, 0x03b34001, 0x03b3e001, 0x03b08001, 0x03b02001, 0x03b1c001, 0x03b16001, 
-    0x03b70001, 0x03b7a001, 0x03b64001, 0x03b6e001, 0x03b58001, 0x03b52001, 0x03b4c001, 0x03b46001, 
-    0x03ac0001, 0x03aca001, 0x03ad4001, 0x03ade001, 0x03ae8001, 0x03ae2001, 0x03afc001, 0x03af6001, 
-    0x03a90001, 0x03a9a001, 0x03a84001, 0x03a8e001, 0x03ab8001, 0x03ab2001, 0x03aac001, 0x03aa6001, 
-    0x03a60001, 0x03a6a001, 0x03a74001, 0x03a7e001, 0x03a48001, 0x03a42001, 0x03a5c001, 0x03a56001, 
-    0x03a30001, 0x03a3a001, 0x03a24001, 0x03a2e001, 0x03a18001, 0x03a12001, 0x03a0c001, 0x03a06001, 
-    0x03600001, 0x0360a001, 0x03614001, 0x0361e001, 0x03628001, 0x03622001, 0x0363c001, 0x03636001, 
-    0x03650001, 0x0365a001, 0x03644001, 0x0364e001, 0x03678001, 0x03672001, 0x0366c001, 0x03666001, 
-    0x036a0001, 0x036aa001, 0x036b4001, 0x036be001, 0x03688001, 0x03682001, 0x0369c001, 0x03696001, 
-    0x036f0001, 0x036fa001, 0x036e4001, 0x036ee001, 0x036d8001, 0x036d2001, 0x036cc001, 0x036c6001, 
-    0x03740001, 0x0374a001, 0x03754001, 0x0375e001, 0x03768001, 0x03762001, 0x0377c001, 0x03776001, 
-    0x03710001, 0x0371a001, 0x03704001, 0x0370e001, 0x03738001, 0x03732001, 0x0372c001, 0x03726001, 
-    0x037e0001, 0x037ea001, 0x037f4001, 0x037fe001, 0x037c8001, 0x037c2001, 0x037dc001, 0x037d6001, 
-    0x037b0001, 0x037ba001, 0x037a4001, 0x037ae001, 0x03798001, 0x03792001, 0x0378c001, 0x03786001, 
-    0x03480001, 0x0348a001, 0x03494001, 0x0349e001, 0x034a8001, 0x034a2001, 0x034bc001, 0x034b6001, 
-    0x034d0001, 0x034da001, 0x034c4001, 0x034ce001, 0x034f8001, 0x034f2001, 0x034ec001, 0x034e6001, 
-    0x03420001, 0x0342a001, 0x03434001, 0x0343e001, 0x03408001, 0x03402001, 0x0341c001, 0x03416001, 
-    0x03470001, 0x0347a001, 0x03464001, 0x0346e001, 0x03458001, 0x03452001, 0x0344c001, 0x03446001, 
-    0x035c0001, 0x035ca001, 0x035d4001, 0x035de001, 0x035e8001, 0x035e2001, 0x035fc001, 0x035f6001, 
-    0x03590001, 0x0359a001, 0x03584001, 0x0358e001, 0x035b8001, 0x035b2001, 0x035ac001, 0x035a6001, 
-    0x03560001, 0x0356a001, 0x03574001, 0x0357e001, 0x03548001, 0x03542001, 0x0355c001, 0x03556001, 
-    0x03530001, 0x0353a001, 0x03524001, 0x0352e001, 0x03518001, 0x03512001, 0x0350c001, 0x03506001, 
-    0x03300001, 0x0330a001, 0x03314001, 0x0331e001, 0x03328001, 0x03322001, 0x0333c001, 0x03336001, 
-    0x03350001, 0x0335a001, 0x03344001, 0x0334e001, 0x03378001, 0x03372001, 0x0336c001, 0x03366001, 
-    0x033a0001, 0x033aa001, 0x033b4001, 0x033be001, 0x03388001, 0x03382001, 0x0339c001, 0x03396001, 
-    0x033f0001, 0x033fa001, 0x033e4001, 0x033ee001, 0x033d8001, 0x033d2001, 0x033cc001, 0x033c6001, 
-    0x03240001, 0x0324a001, 0x03254001, 0x0325e001, 0x03268001, 0x03262001, 0x0327c001, 0x03276001, 
-    0x03210001, 0x0321a001, 0x03204001, 0x0320e001, 0x03238001, 0x03232001, 0x0322c001, 0x03226001, 
-    0x032e0001, 0x032ea001, 0x032f4001, 0x032fe001, 0x032c8001, 0x032c2001, 0x032dc001, 0x032d6001, 
-    0x032b0001, 0x032ba001, 0x032a4001, 0x032ae001, 0x03298001, 0x03292001, 0x0328c001, 0x03286001, 
-    0x03180001, 0x0318a001, 0x03194001, 0x0319e001, 0x031a8001, 0x031a2001, 0x031bc001, 0x031b6001, 
-    0x031d0001, 0x031da001, 0x031c4001, 0x031ce001, 0x031f8001, 0x031f2001, 0x031ec001, 0x031e6001, 
-    0x03120001, 0x0312a001, 0x03134001, 0x0313e001, 0x03108001, 0x03102001, 0x0311c001, 0x03116001, 
-    0x03170001, 0x0317a001, 0x03164001, 0x0316e001, 0x03158001, 0x03152001, 0x0314c001, 0x03146001, 
-    0x030c0001, 0x030ca001, 0x030d4001, 0x030de001, 0x030e8001, 0x030e2001, 0x030fc001, 0x030f6001, 
-    0x03090001, 0x0309a001, 0x03084001, 0x0308e001, 0x030b8001, 0x030b2001, 0x030ac001, 0x030a6001, 
-    0x03060001, 0x0306a001, 0x03074001, 0x0307e001, 0x03048001, 0x03042001, 0x0305c001, 0x03056001, 
-    0x03030001, 0x0303a001, 0x03024001, 0x0302e001, 0x03018001, 0x03012001, 0x0300c001, 0x03006001, 
-    0x05000002, 0x0500a002, 0x05014002, 0x0501e002, 0x05028002, 0x05022002, 0x0503c002, 0x05036002, 
-    0x05050002, 0x0505a002, 0x05044002, 0x0504e002, 0x05078002, 0x05072002, 0x0506c002, 0x05066002, 
-    0x050a0002, 0x050aa002, 0x050b4002, 0x050be002, 0x05088002, 0x05082002, 0x0509c002, 0x05096002, 
-    0x050f0002, 0x050fa002, 0x050e4002, 0x050ee002, 0x050d8002, 0x050d2002, 0x050cc002, 0x050c6002, 
-    0x05140002, 0x0514a002, 0x05154002, 0x0515e002, 0x05168002, 0x05162002, 0x0517c002, 0x05176002, 
-    0x05110002, 0x0511a002, 0x05104002, 0x0510e002, 0x05138002, 0x05132002, 0x0512c002, 0x05126002, 
-    0x051e0002, 0x051ea002, 0x051f4002, 0x051fe002, 0x051c8002, 0x051c2002, 0x051dc002, 0x051d6002, 
-    0x051b0002, 0x051ba002, 0x051a4002, 0x051ae002, 0x05198002, 0x05192002, 0x0518c002, 0x05186002, 
-    0x05280002, 0x0528a002, 0x05294002, 0x0529e002, 0x052a8002, 0x052a2002, 0x052bc002, 0x052b6002, 
-    0x052d0002, 0x052da002, 0x052c4002, 0x052ce002, 0x052f8002, 0x052f2002, 0x052ec002, 0x052e6002, 
-    0x05220002, 0x0522a002, 0x05234002, 0x0523e002, 0x05208002, 0x05202002, 0x0521c002, 0x05216002, 
-    0x05270002, 0x0527a002, 0x05264002, 0x0526e002, 0x05258002, 0x05252002, 0x0524c002, 0x05246002, 
-    0x053c0002, 0x053ca002, 0x053d4002, 0x053de002, 0x053e8002, 0x053e2002, 0x053fc002, 0x053f6002, 
-    0x05390002, 0x0539a002, 0x05384002, 0x0538e002, 0x053b8002, 0x053b2002, 0x053ac002, 0x053a6002, 
-    0x05360002, 0x0536a002, 0x05374002, 0x0537e002, 0x05348002, 0x05342002, 0x0535c002, 0x05356002, 
-    0x05330002, 0x0533a002, 0x05324002, 0x0532e002, 0x05318002, 0x05312002, 0x0530c002, 0x05306002, 
-    0x05500002, 0x0550a002, 0x05514002, 0x0551e002, 0x05528002, 0x05522002, 0x0553c002, 0x05536002, 
-    0x05550002, 0x0555a002, 0x05544002, 0x0554e002, 0x05578002, 0x05572002, 0x0556c002, 0x05566002, 
-    0x055a0002, 0x055aa002, 0x055b4002, 0x055be002, 0x05588002, 0x05582002, 0x0559c002, 0x05596002, 
-    0x055f0002, 0x055fa002, 0x055e4002, 0x055ee002, 0x055d8002, 0x055d2002, 0x055cc002, 0x055c6002, 
-    0x05440002, 0x0544a002, 0x05454002, 0x0545e002, 0x05468002, 0x05462002, 0x0547c002, 0x05476002, 
-    0x05410002, 0x0541a002, 0x05404002, 0x0540e002, 0x05438002, 0x05432002, 0x0542c002, 0x05426002, 
-    0x054e0002, 0x054ea002, 0x054f4002, 0x054fe002, 0x054c8002, 0x054c2002, 0x054dc002, 0x054d6002, 
-    0x054b0002, 0x054ba002, 0x054a4002, 0x054ae002, 0x05498002, 0x05492002, 0x0548c002, 0x05486002, 
-    0x05780002, 0x0578a002, 0x05794002, 0x0579e002, 0x057a8002, 0x057a2002, 0x057bc002, 0x057b6002, 
-    0x057d0002, 0x057da002, 0x057c4002, 0x057ce002, 0x057f8002, 0x057f2002, 0x057ec002, 0x057e6002, 
-    0x05720002, 0x0572a002, 0x05734002, 0x0573e002, 0x05708002, 0x05702002, 0x0571c002, 0x05716002, 
-    0x05770002, 0x0577a002, 0x05764002, 0x0576e002, 0x05758002, 0x05752002, 0x0574c002, 0x05746002, 
-    0x056c0002, 0x056ca002, 0x056d4002, 0x056de002, 0x056e8002, 0x056e2002, 0x056fc002, 0x056f6002, 
-    0x05690002, 0x0569a002, 0x05684002, 0x0568e002, 0x056b8002, 0x056b2002, 0x056ac002, 0x056a6002, 
-    0x05660002, 0x0566a002, 0x05674002, 0x0567e002, 0x05648002, 0x05642002, 0x0565c002, 0x05656002, 
-    0x05630002, 0x0563a002, 0x05624002, 0x0562e002, 0x05618002, 0x05612002, 0x0560c002, 0x05606002, 
-    0x05a00002, 0x05a0a002, 0x05a14002, 0x05a1e002, 0x05a28002, 0x05a22002, 0x05a3c002, 0x05a36002, 
-    0x05a50002, 0x05a5a002, 0x05a44002, 0x05a4e002, 0x05a78002, 0x05a72002, 0x05a6c002, 0x05a66002, 
-    0x05aa0002, 0x05aaa002, 0x05ab4002, 0x05abe002, 0x05a88002, 0x05a82002, 0x05a9c002, 0x05a96002, 
-    0x05af0002, 0x05afa002, 0x05ae4002, 0x05aee002, 0x05ad8002, 0x05ad2002, 0x05acc002, 0x05ac6002, 
-    0x05b40002, 0x05b4a002, 0x05b54002, 0x05b5e002, 0x05b68002, 0x05b62002, 0x05b7c002, 0x05b76002, 
-    0x05b10002, 0x05b1a002, 0x05b04002, 0x05b0e002, 0x05b38002, 0x05b32002, 0x05b2c002, 0x05b26002, 
-    0x05be0002, 0x05bea002, 0x05bf4002, 0x05bfe002, 0x05bc8002, 0x05bc2002, 0x05bdc002, 0x05bd6002, 
-    0x05bb0002, 0x05bba002, 0x05ba4002, 0x05bae002, 0x05b98002, 0x05b92002, 0x05b8c002, 0x05b86002, 
-    0x05880002, 0x0588a002, 0x05894002, 0x0589e002, 0x058a8002, 0x058a2002, 0x058bc002, 0x058b6002, 
-    0x058d0002, 0x058da002, 0x058c4002, 0x058ce002, 0x058f8002, 0x058f2002, 0x058ec002, 0x058e6002, 
-    0x05820002, 0x0582a002, 0x05834002, 0x0583e002, 0x05808002, 0x05802002, 0x0581c002, 0x05816002, 
-    0x05870002, 0x0587a002, 0x05864002, 0x0586e002, 0x05858002, 0x05852002, 0x0584c002, 0x05846002, 
-    0x059c0002, 0x059ca002, 0x059d4002, 0x059de002, 0x059e8002, 0x059e2002, 0x059fc002, 0x059f6002, 
-    0x05990002, 0x0599a002, 0x05984002, 0x0598e002, 0x059b8002, 0x059b2002, 0x059ac002, 0x059a6002, 
-    0x05960002, 0x0596a002, 0x05974002, 0x0597e002, 0x05948002, 0x05942002, 0x0595c002, 0x05956002, 
-    0x05930002, 0x0593a002, 0x05924002, 0x0592e002, 0x05918002, 0x05912002, 0x0590c002, 0x05906002, 
-    0x05f00002, 0x05f0a002, 0x05f14002, 0x05f1e002, 0x05f28002, 0x05f22002, 0x05f3c002, 0x05f36002, 
-    0x05f50002, 0x05f5a002, 0x05f44002, 0x05f4e002, 0x05f78002, 0x05f72002, 0x05f6c002, 0x05f66002, 
-    0x05fa0002, 0x05faa002, 0x05fb4002, 0x05fbe002, 0x05f88002, 0x05f82002, 0x05f9c002, 0x05f96002, 
-    0x05ff0002, 0x05ffa002, 0x05fe4002, 0x05fee002, 0x05fd8002, 0x05fd2002, 0x05fcc002, 0x05fc6002, 
-    0x05e40002, 0x05e4a002, 0x05e54002, 0x05e5e002, 0x05e68002, 0x05e62002, 0x05e7c002, 0x05e76002, 
-    0x05e10002, 0x05e1a002, 0x05e04002, 0x05e0e002, 0x05e38002, 0x05e32002, 0x05e2c002, 0x05e26002, 
-    0x05ee0002, 0x05eea002, 0x05ef4002, 0x05efe002, 0x05ec8002, 0x05ec2002, 0x05edc002, 0x05ed6002, 
-    0x05eb0002, 0x05eba002, 0x05ea4002, 0x05eae002, 0x05e98002, 0x05e92002, 0x05e8c002, 0x05e86002, 
-    0x05d80002, 0x05d8a002, 0x05d94002, 0x05d9e002, 0x05da8002, 0x05da2002, 0x05dbc002, 0x05db6002, 
-    0x05dd0002, 0x05dda002, 0x05dc4002, 0x05dce002, 0x05df8002, 0x05df2002, 0x05dec002, 0x05de6002, 
-    0x05d20002, 0x05d2a002, 0x05d34002, 0x05d3e002, 0x05d08002, 0x05d02002, 0x05d1c002, 0x05d16002, 
-    0x05d70002, 0x05d7a002, 0x05d64002, 0x05d6e002, 0x05d58002, 0x05d52002, 0x05d4c002, 0x05d46002, 
-    0x05cc0002, 0x05cca002, 0x05cd4002, 0x05cde002, 0x05ce8002, 0x05ce2002, 0x05cfc002, 0x05cf6002, 
-    0x05c90002, 0x05c9a002, 0x05c84002, 0x05c8e002, 0x05cb8002, 0x05cb2002, 0x05cac002, 0x05ca6002, 
-    0x05c60002, 0x05c6a002, 0x05c74002, 0x05c7e002, 0x05c48002, 0x05c42002, 0x05c5c002, 0x05c56002, 
-    0x05c30002, 0x05c3a002, 0x05c24002, 0x05c2e002, 0x05c18002, 0x05c12002, 0x05c0c002, 0x05c06002, 
-    0x04400002, 0x0440a002, 0x04414002, 0x0441e002, 0x04428002, 0x04422002, 0x0443c002, 0x04436002, 
-    0x04450002, 0x0445a002, 0x04444002, 0x0444e002, 0x04478002, 0x04472002, 0x0446c002, 0x04466002, 
-    0x044a0002, 0x044aa002, 0x044b4002, 0x044be002, 0x04488002, 0x04482002, 0x0449c002, 0x04496002, 
-    0x044f0002, 0x044fa002, 0x044e4002, 0x044ee002, 0x044d8002, 0x044d2002, 0x044cc002, 0x044c6002, 
-    0x04540002, 0x0454a002, 0x04554002, 0x0455e002, 0x04568002, 0x04562002, 0x0457c002, 0x04576002, 
-    0x04510002, 0x0451a002, 0x04504002, 0x0450e002, 0x04538002, 0x04532002, 0x0452c002, 0x04526002, 
-    0x045e0002, 0x045ea002, 0x045f4002, 0x045fe002, 0x045c8002, 0x045c2002, 0x045dc002, 0x045d6002, 
-    0x045b0002, 0x045ba002, 0x045a4002, 0x045ae002, 0x04598002, 0x04592002, 0x0458c002, 0x04586002, 
-    0x04680002, 0x0468a002, 0x04694002, 0x0469e002, 0x046a8002, 0x046a2002, 0x046bc002, 0x046b6002, 
-    0x046d0002, 0x046da002, 0x046c4002, 0x046ce002, 0x046f8002, 0x046f2002, 0x046ec002, 0x046e6002, 
-    0x04620002, 0x0462a002, 0x04634002, 0x0463e002, 0x04608002, 0x04602002, 0x0461c002, 0x04616002, 
-    0x04670002, 0x0467a002, 0x04664002, 0x0466e002, 0x04658002, 0x04652002, 0x0464c002, 0x04646002, 
-    0x047c0002, 0x047ca002, 0x047d4002, 0x047de002, 0x047e8002, 0x047e2002, 0x047fc002, 0x047f6002, 
-    0x04790002, 0x0479a002, 0x04784002, 0x0478e002, 0x047b8002, 0x047b2002, 0x047ac002, 0x047a6002, 
-    0x04760002, 0x0476a002, 0x04774002, 0x0477e002, 0x04748002, 0x04742002, 0x0475c002, 0x04756002, 
-    0x04730002, 0x0473a002, 0x04724002, 0x0472e002, 0x04718002, 0x04712002, 0x0470c002, 0x04706002, 
-    0x04100002, 0x0410a002, 0x04114002, 0x0411e002, 0x04128002, 0x04122002, 0x0413c002, 0x04136002, 
-    0x04150002, 0x0415a002, 0x04144002, 0x0414e002, 0x04178002, 0x04172002, 0x0416c002, 0x04166002, 
-    0x041a0002, 0x041aa002, 0x041b4002, 0x041be002, 0x04188002, 0x04182002, 0x0419c002, 0x04196002, 
-    0x041f0002, 0x041fa002, 0x041e4002, 0x041ee002, 0x041d8002, 0x041d2002, 0x041cc002, 0x041c6002, 
-    0x04040002, 0x0404a002, 0x04054002, 0x0405e002, 0x04068002, 0x04062002, 0x0407c002, 0x04076002, 
-    0x04010002, 0x0401a002, 0x04004002, 0x0400e002, 0x04038002, 0x04032002, 0x0402c002, 0x04026002, 
-    0x040e0002, 0x040ea002, 0x040f4002, 0x040fe002, 0x040c8002, 0x040c2002, 0x040dc002, 0x040d6002, 
-    0x040b0002, 0x040ba002, 0x040a4002, 0x040ae002, 0x04098002, 0x04092002, 0x0408c002, 0x04086002, 
-    0x04380002, 0x0438a002, 0x04394002, 0x0439e002, 0x043a8002, 0x043a2002, 0x043bc002, 0x043b6002, 
-    0x043d0002, 0x043da002, 0x043c4002, 0x043ce002, 0x043f8002, 0x043f2002, 0x043ec002, 0x043e6002, 
-    0x04320002, 0x0432a002, 0x04334002, 0x0433e002, 0x04308002, 0x04302002, 0x0431c002, 0x04316002, 
-    0x04370002, 0x0437a002, 0x04364002, 0x0436e002, 0x04358002, 0x04352002, 0x0434c002, 0x04346002, 
-    0x042c0002, 0x042ca002, 0x042d4002, 0x042de002, 0x042e8002, 0x042e2002, 0x042fc002, 0x042f6002, 
-    0x04290002, 0x0429a002, 0x04284002, 0x0428e002, 0x042b8002, 0x042b2002, 0x042ac002, 0x042a6002, 
-    0x04260002, 0x0426a002, 0x04274002, 0x0427e002, 0x04248002, 0x04242002, 0x0425c002, 0x04256002, 
-    0x04230002, 0x0423a002, 0x04224002, 0x0422e002, 0x04218002, 0x04212002, 0x0420c002, 0x04206002, 
-    0x04e00002, 0x04e0a002, 0x04e14002, 0x04e1e002, 0x04e28002, 0x04e22002, 0x04e3c002, 0x04e36002, 
-    0x04e50002, 0x04e5a002, 0x04e44002, 0x04e4e002, 0x04e78002, 0x04e72002, 0x04e6c002, 0x04e66002, 
-    0x04ea0002, 0x04eaa002, 0x04eb4002, 0x04ebe002, 0x04e88002, 0x04e82002, 0x04e9c002, 0x04e96002, 
-    0x04ef0002, 0x04efa002, 0x04ee4002, 0x04eee002, 0x04ed8002, 0x04ed2002, 0x04ecc002, 0x04ec6002, 
-    0x04f40002, 0x04f4a002, 0x04f54002, 0x04f5e002, 0x04f68002, 0x04f62002, 0x04f7c002, 0x04f76002, 
-    0x04f10002, 0x04f1a002, 0x04f04002, 0x04f0e002, 0x04f38002, 0x04f32002, 0x04f2c002, 0x04f26002, 
-    0x04fe0002, 0x04fea002, 0x04ff4002, 0x04ffe002, 0x04fc8002, 0x04fc2002, 0x04fdc002, 0x04fd6002, 
-    0x04fb0002, 0x04fba002, 0x04fa4002, 0x04fae002, 0x04f98002, 0x04f92002, 0x04f8c002, 0x04f86002, 
-    0x04c80002, 0x04c8a002, 0x04c94002, 0x04c9e002, 0x04ca8002, 0x04ca2002, 0x04cbc002, 0x04cb6002, 
-    0x04cd0002, 0x04cda002, 0x04cc4002, 0x04cce002, 0x04cf8002, 0x04cf2002, 0x04cec002, 0x04ce6002, 
-    0x04c20002, 0x04c2a002, 0x04c34002, 0x04c3e002, 0x04c08002, 0x04c02002, 0x04c1c002, 0x04c16002, 
-    0x04c70002, 0x04c7a002, 0x04c64002, 0x04c6e002, 0x04c58002, 0x04c52002, 0x04c4c002, 0x04c46002, 
-    0x04dc0002, 0x04dca002, 0x04dd4002, 0x04dde002, 0x04de8002, 0x04de2002, 0x04dfc002, 0x04df6002, 
-    0x04d90002, 0x04d9a002, 0x04d84002, 0x04d8e002, 0x04db8002, 0x04db2002, 0x04dac002, 0x04da6002, 
-    0x04d60002, 0x04d6a002, 0x04d74002, 0x04d7e002, 0x04d48002, 0x04d42002, 0x04d5c002, 0x04d56002, 
-    0x04d30002, 0x04d3a002, 0x04d24002, 0x04d2e002, 0x04d18002, 0x04d12002, 0x04d0c002, 0x04d06002, 
-    0x04b00002, 0x04b0a002, 0x04b14002, 0x04b1e002, 0x04b28002, 0x04b22002, 0x04b3c002, 0x04b36002, 
-    0x04b50002, 0x04b5a002, 0x04b44002, 0x04b4e002, 0x04b78002, 0x04b72002, 0x04b6c002, 0x04b66002, 
-    0x04ba0002, 0x04baa002, 0x04bb4002, 0x04bbe002, 0x04b88002, 0x04b82002, 0x04b9c002, 0x04b96002, 
-    0x04bf0002, 0x04bfa002, 0x04be4002, 0x04bee002, 0x04bd8002, 0x04bd2002, 0x04bcc002, 0x04bc6002, 
-    0x04a40002, 0x04a4a002, 0x04a54002, 0x04a5e002, 0x04a68002, 0x04a62002, 0x04a7c002, 0x04a76002, 
-    0x04a10002, 0x04a1a002, 0x04a04002, 0x04a0e002, 0x04a38002, 0x04a32002, 0x04a2c002, 0x04a26002, 
-    0x04ae0002, 0x04aea002, 0x04af4002, 0x04afe002, 0x04ac8002, 0x04ac2002, 0x04adc002, 0x04ad6002, 
-    0x04ab0002, 0x04aba002, 0x04aa4002, 0x04aae002, 0x04a98002, 0x04a92002, 0x04a8c002, 0x04a86002, 
-    0x04980002, 0x0498a002, 0x04994002, 0x0499e002, 0x049a8002, 0x049a2002, 0x049bc002, 0x049b6002, 
-    0x049d0002, 0x049da002, 0x049c4002, 0x049ce002, 0x049f8002, 0x049f2002, 0x049ec002, 0x049e6002, 
-    0x04920002, 0x0492a002, 0x04934002, 0x0493e002, 0x04908002, 0x04902002, 0x0491c002, 0x04916002, 
-    0x04970002, 0x0497a002, 0x04964002, 0x0496e002, 0x04958002, 0x04952002, 0x0494c002, 0x04946002, 
-    0x048c0002, 0x048ca002, 0x048d4002, 0x048de002, 0x048e8002, 0x048e2002, 0x048fc002, 0x048f6002, 
-    0x04890002, 0x0489a002, 0x04884002, 0x0488e002, 0x048b8002, 0x048b2002, 0x048ac002, 0x048a6002, 
-    0x04860002, 0x0486a002, 0x04874002, 0x0487e002, 0x04848002, 0x04842002, 0x0485c002, 0x04856002, 
-    0x04830002, 0x0483a002, 0x04824002, 0x0482e002, 0x04818002, 0x04812002, 0x0480c002, 0x04806002, 
-    0x07800003, 0x0780a003, 0x07814003, 0x0781e003, 0x07828003, 0x07822003, 0x0783c003, 0x07836003, 
-    0x07850003, 0x0785a003, 0x07844003, 0x0784e003, 0x07878003, 0x07872003, 0x0786c003, 0x07866003, 
-    0x078a0003, 0x078aa003, 0x078b4003, 0x078be003, 0x07888003, 0x07882003, 0x0789c003, 0x07896003, 
-    0x078f0003, 0x078fa003, 0x078e4003, 0x078ee003, 0x078d8003, 0x078d2003, 0x078cc003, 0x078c6003, 
-    0x07940003, 0x0794a003, 0x07954003, 0x0795e003, 0x07968003, 0x07962003, 0x0797c003, 0x07976003, 
-    0x07910003, 0x0791a003, 0x07904003, 0x0790e003, 0x07938003, 0x07932003, 0x0792c003, 0x07926003, 
-    0x079e0003, 0x079ea003, 0x079f4003, 0x079fe003, 0x079c8003, 0x079c2003, 0x079dc003, 0x079d6003, 
-    0x079b0003, 0x079ba003, 0x079a4003, 0x079ae003, 0x07998003, 0x07992003, 0x0798c003, 0x07986003, 
-    0x07a80003, 0x07a8a003, 0x07a94003, 0x07a9e003, 0x07aa8003, 0x07aa2003, 0x07abc003, 0x07ab6003, 
-    0x07ad0003, 0x07ada003, 0x07ac4003, 0x07ace003, 0x07af8003, 0x07af2003, 0x07aec003, 0x07ae6003, 
-    0x07a20003, 0x07a2a003, 0x07a34003, 0x07a3e003, 0x07a08003, 0x07a02003, 0x07a1c003, 0x07a16003, 
-    0x07a70003, 0x07a7a003, 0x07a64003, 0x07a6e003, 0x07a58003, 0x07a52003, 0x07a4c003, 0x07a46003, 
-    0x07bc0003, 0x07bca003, 0x07bd4003, 0x07bde003, 0x07be8003, 0x07be2003, 0x07bfc003, 0x07bf6003, 
-    0x07b90003, 0x07b9a003, 0x07b84003, 0x07b8e003, 0x07bb8003, 0x07bb2003, 0x07bac003, 0x07ba6003, 
-    0x07b60003, 0x07b6a003, 0x07b74003, 0x07b7e003, 0x07b48003, 0x07b42003, 0x07b5c003, 0x07b56003, 
-    0x07b30003, 0x07b3a003, 0x07b24003, 0x07b2e003, 0x07b18003, 0x07b12003, 0x07b0c003, 0x07b06003, 
-    0x07d00003, 0x07d0a003, 0x07d14003, 0x07d1e003, 0x07d28003, 0x07d22003, 0x07d3c003, 0x07d36003, 
-    0x07d50003, 0x07d5a003, 0x07d44003, 0x07d4e003, 0x07d78003, 0x07d72003, 0x07d6c003, 0x07d66003, 
-    0x07da0003, 0x07daa003, 0x07db4003, 0x07dbe003, 0x07d88003, 0x07d82003, 0x07d9c003, 0x07d96003, 
-    0x07df0003, 0x07dfa003, 0x07de4003, 0x07dee003, 0x07dd8003, 0x07dd2003, 0x07dcc003, 0x07dc6003, 
-    0x07c40003, 0x07c4a003, 0x07c54003, 0x07c5e003, 0x07c68003, 0x07c62003, 0x07c7c003, 0x07c76003, 
-    0x07c10003, 0x07c1a003, 0x07c04003, 0x07c0e003, 0x07c38003, 0x07c32003, 0x07c2c003, 0x07c26003, 
-    0x07ce0003, 0x07cea003, 0x07cf4003, 0x07cfe003, 0x07cc8003, 0x07cc2003, 0x07cdc003, 0x07cd6003, 
-    0x07cb0003, 0x07cba003, 0x07ca4003, 0x07cae003, 0x07c98003, 0x07c92003, 0x07c8c003, 0x07c86003, 
-    0x07f80003, 0x07f8a003, 0x07f94003, 0x07f9e003, 0x07fa8003, 0x07fa2003, 0x07fbc003, 0x07fb6003, 
-    0x07fd0003, 0x07fda003, 0x07fc4003, 0x07fce003, 0x07ff8003, 0x07ff2003, 0x07fec003, 0x07fe6003, 
-    0x07f20003, 0x07f2a003, 0x07f34003, 0x07f3e003, 0x07f08003, 0x07f02003, 0x07f1c003, 0x07f16003, 
-    0x07f70003, 0x07f7a003, 0x07f64003, 0x07f6e003, 0x07f58003, 0x07f52003, 0x07f4c003, 0x07f46003, 
-    0x07ec0003, 0x07eca003, 0x07ed4003, 0x07ede003, 0x07ee8003, 0x07ee2003, 0x07efc003, 0x07ef6003, 
-    0x07e90003, 0x07e9a003, 0x07e84003, 0x07e8e003, 0x07eb8003, 0x07eb2003, 0x07eac003, 0x07ea6003, 
-    0x07e60003, 0x07e6a003, 0x07e74003, 0x07e7e003, 0x07e48003, 0x07e42003, 0x07e5c003, 0x07e56003, 
-    0x07e30003, 0x07e3a003, 0x07e24003, 0x07e2e003, 0x07e18003, 0x07e12003, 0x07e0c003, 0x07e06003, 
-    0x07200003, 0x0720a003, 0x07214003, 0x0721e003, 0x07228003, 0x07222003, 0x0723c003, 0x07236003, 
-    0x07250003, 0x0725a003, 0x07244003, 0x0724e003, 0x07278003, 0x07272003, 0x0726c003, 0x07266003, 
-    0x072a0003, 0x072aa003, 0x072b4003, 0x072be003, 0x07288003, 0x07282003, 0x0729c003, 0x07296003, 
-    0x072f0003, 0x072fa003, 0x072e4003, 0x072ee003, 0x072d8003, 0x072d2003, 0x072cc003, 0x072c6003, 
-    0x07340003, 0x0734a003, 0x07354003, 0x0735e003, 0x07368003, 0x07362003, 0x0737c003, 0x07376003, 
-    0x07310003, 0x0731a003, 0x07304003, 0x0730e003, 0x07338003, 0x07332003, 0x0732c003, 0x07326003, 
-    0x073e0003, 0x073ea003, 0x073f4003, 0x073fe003, 0x073c8003, 0x073c2003, 0x073dc003, 0x073d6003, 
-    0x073b0003, 0x073ba003, 0x073a4003, 0x073ae003, 0x07398003, 0x07392003, 0x0738c003, 0x07386003, 
-    0x07080003, 0x0708a003, 0x07094003, 0x0709e003, 0x070a8003, 0x070a2003, 0x070bc003, 0x070b6003, 
-    0x070d0003, 0x070da003, 0x070c4003, 0x070ce003, 0x070f8003, 0x070f2003, 0x070ec003, 0x070e6003, 
-    0x07020003, 0x0702a003, 0x07034003, 0x0703e003, 0x07008003, 0x07002003, 0x0701c003, 0x07016003, 
-    0x07070003, 0x0707a003, 0x07064003, 0x0706e003, 0x07058003, 0x07052003, 0x0704c003, 0x07046003, 
-    0x071c0003, 0x071ca003, 0x071d4003, 0x071de003, 0x071e8003, 0x071e2003, 0x071fc003, 0x071f6003, 
-    0x07190003, 0x0719a003, 0x07184003, 0x0718e003, 0x071b8003, 0x071b2003, 0x071ac003, 0x071a6003, 
-    0x07160003, 0x0716a003, 0x07174003, 0x0717e003, 0x07148003, 0x07142003, 0x0715c003, 0x07156003, 
-    0x07130003, 0x0713a003, 0x07124003, 0x0712e003, 0x07118003, 0x07112003, 0x0710c003, 0x07106003, 
-    0x07700003, 0x0770a003, 0x07714003, 0x0771e003, 0x07728003, 0x07722003, 0x0773c003, 0x07736003, 
-    0x07750003, 0x0775a003, 0x07744003, 0x0774e003, 0x07778003, 0x07772003, 0x0776c003, 0x07766003, 
-    0x077a0003, 0x077aa003, 0x077b4003, 0x077be003, 0x07788003, 0x07782003, 0x0779c003, 0x07796003, 
-    0x077f0003, 0x077fa003, 0x077e4003, 0x077ee003, 0x077d8003, 0x077d2003, 0x077cc003, 0x077c6003, 
-    0x07640003, 0x0764a003, 0x07654003, 0x0765e003, 0x07668003, 0x07662003, 0x0767c003, 0x07676003, 
-    0x07610003, 0x0761a003, 0x07604003, 0x0760e003, 0x07638003, 0x07632003, 0x0762c003, 0x07626003, 
-    0x076e0003, 0x076ea003, 0x076f4003, 0x076fe003, 0x076c8003, 0x076c2003, 0x076dc003, 0x076d6003, 
-    0x076b0003, 0x076ba003, 0x076a4003, 0x076ae003, 0x07698003, 0x07692003, 0x0768c003, 0x07686003, 
-    0x07580003, 0x0758a003, 0x07594003, 0x0759e003, 0x075a8003, 0x075a2003, 0x075bc003, 0x075b6003, 
-    0x075d0003, 0x075da003, 0x075c4003, 0x075ce003, 0x075f8003, 0x075f2003, 0x075ec003, 0x075e6003, 
-    0x07520003, 0x0752a003, 0x07534003, 0x0753e003, 0x07508003, 0x07502003, 0x0751c003, 0x07516003, 
-    0x07570003, 0x0757a003, 0x07564003, 0x0756e003, 0x07558003, 0x07552003, 0x0754c003, 0x07546003, 
-    0x074c0003, 0x074ca003, 0x074d4003, 0x074de003, 0x074e8003, 0x074e2003, 0x074fc003, 0x074f6003, 
-    0x07490003, 0x0749a003, 0x07484003, 0x0748e003, 0x074b8003, 0x074b2003, 0x074ac003, 0x074a6003, 
-    0x07460003, 0x0746a003, 0x07474003, 0x0747e003, 0x07448003, 0x07442003, 0x0745c003, 0x07456003, 
-    0x07430003, 0x0743a003, 0x07424003, 0x0742e003, 0x07418003, 0x07412003, 0x0740c003, 0x07406003, 
-    0x06c00003, 0x06c0a003, 0x06c14003, 0x06c1e003, 0x06c28003, 0x06c22003, 0x06c3c003, 0x06c36003, 
-    0x06c50003, 0x06c5a003, 0x06c44003, 0x06c4e003, 0x06c78003, 0x06c72003, 0x06c6c003, 0x06c66003, 
-    0x06ca0003, 0x06caa003, 0x06cb4003, 0x06cbe003, 0x06c88003, 0x06c82003, 0x06c9c003, 0x06c96003, 
-    0x06cf0003, 0x06cfa003, 0x06ce4003, 0x06cee003, 0x06cd8003, 0x06cd2003, 0x06ccc003, 0x06cc6003, 
-    0x06d40003, 0x06d4a003, 0x06d54003, 0x06d5e003, 0x06d68003, 0x06d62003, 0x06d7c003, 0x06d76003, 
-    0x06d10003, 0x06d1a003, 0x06d04003, 0x06d0e003, 0x06d38003, 0x06d32003, 0x06d2c003, 0x06d26003, 
-    0x06de0003, 0x06dea003, 0x06df4003, 0x06dfe003, 0x06dc8003, 0x06dc2003, 0x06ddc003, 0x06dd6003, 
-    0x06db0003, 0x06dba003, 0x06da4003, 0x06dae003, 0x06d98003, 0x06d92003, 0x06d8c003, 0x06d86003, 
-    0x06e80003, 0x06e8a003, 0x06e94003, 0x06e9e003, 0x06ea8003, 0x06ea2003, 0x06ebc003, 0x06eb6003, 
-    0x06ed0003, 0x06eda003, 0x06ec4003, 0x06ece003, 0x06ef8003, 0x06ef2003, 0x06eec003, 0x06ee6003, 
-    0x06e20003, 0x06e2a003, 0x06e34003, 0x06e3e003, 0x06e08003, 0x06e02003, 0x06e1c003, 0x06e16003, 
-    0x06e70003, 0x06e7a003, 0x06e64003, 0x06e6e003, 0x06e58003, 0x06e52003, 0x06e4c003, 0x06e46003, 
-    0x06fc0003, 0x06fca003, 0x06fd4003, 0x06fde003, 0x06fe8003, 0x06fe2003, 0x06ffc003, 0x06ff6003, 
-    0x06f90003, 0x06f9a003, 0x06f84003, 0x06f8e003, 0x06fb8003, 0x06fb2003, 0x06fac003, 0x06fa6003, 
-    0x06f60003, 0x06f6a003, 0x06f74003, 0x06f7e003, 0x06f48003, 0x06f42003, 0x06f5c003, 0x06f56003, 
-    0x06f30003, 0x06f3a003, 0x06f24003, 0x06f2e003, 0x06f18003, 0x06f12003, 0x06f0c003, 0x06f06003, 
-    0x06900003, 0x0690a003, 0x06914003, 0x0691e003, 0x06928003, 0x06922003, 0x0693c003, 0x06936003, 
-    0x06950003, 0x0695a003, 0x06944003, 0x0694e003, 0x06978003, 0x06972003, 0x0696c003, 0x06966003, 
-    0x069a0003, 0x069aa003, 0x069b4003, 0x069be003, 0x06988003, 0x06982003, 0x0699c003, 0x06996003, 
-    0x069f0003, 0x069fa003, 0x069e4003, 0x069ee003, 0x069d8003, 0x069d2003, 0x069cc003, 0x069c6003, 
-    0x06840003, 0x0684a003, 0x06854003, 0x0685e003, 0x06868003, 0x06862003, 0x0687c003, 0x06876003, 
-    0x06810003, 0x0681a003, 0x06804003, 0x0680e003, 0x06838003, 0x06832003, 0x0682c003, 0x06826003, 
-    0x068e0003, 0x068ea003, 0x068f4003, 0x068fe003, 0x068c8003, 0x068c2003, 0x068dc003, 0x068d6003, 
-    0x068b0003, 0x068ba003, 0x068a4003, 0x068ae003, 0x06898003, 0x06892003, 0x0688c003, 0x06886003, 
-    0x06b80003, 0x06b8a003, 0x06b94003, 0x06b9e003, 0x06ba8003, 0x06ba2003, 0x06bbc003, 0x06bb6003, 
-    0x06bd0003, 0x06bda003, 0x06bc4003, 0x06bce003, 0x06bf8003, 0x06bf2003, 0x06bec003, 0x06be6003, 
-    0x06b20003, 0x06b2a003, 0x06b34003, 0x06b3e003, 0x06b08003, 0x06b02003, 0x06b1c003, 0x06b16003, 
-    0x06b70003, 0x06b7a003, 0x06b64003, 0x06b6e003, 0x06b58003, 0x06b52003, 0x06b4c003, 0x06b46003, 
-    0x06ac0003, 0x06aca003, 0x06ad4003, 0x06ade003, 0x06ae8003, 0x06ae2003, 0x06afc003, 0x06af6003, 
-    0x06a90003, 0x06a9a003, 0x06a84003, 0x06a8e003, 0x06ab8003, 0x06ab2003, 0x06aac003, 0x06aa6003, 
-    0x06a60003, 0x06a6a003, 0x06a74003, 0x06a7e003, 0x06a48003, 0x06a42003, 0x06a5c003, 0x06a56003, 
-    0x06a30003, 0x06a3a003, 0x06a24003, 0x06a2e003, 0x06a18003, 0x06a12003, 0x06a0c003, 0x06a06003, 
-    0x06600003, 0x0660a003, 0x06614003, 0x0661e003, 0x06628003, 0x06622003, 0x0663c003, 0x06636003, 
-    0x06650003, 0x0665a003, 0x06644003, 0x0664e003, 0x06678003, 0x06672003, 0x0666c003, 0x06666003, 
-    0x066a0003, 0x066aa003, 0x066b4003, 0x066be003, 0x06688003, 0x06682003, 0x0669c003, 0x06696003, 
-    0x066f0003, 0x066fa003, 0x066e4003, 0x066ee003, 0x066d8003, 0x066d2003, 0x066cc003, 0x066c6003, 
-    0x06740003, 0x0674a003, 0x06754003, 0x0675e003, 0x06768003, 0x06762003, 0x0677c003, 0x06776003, 
-    0x06710003, 0x0671a003, 0x06704003, 0x0670e003, 0x06738003, 0x06732003, 0x0672c003, 0x06726003, 
-    0x067e0003, 0x067ea003, 0x067f4003, 0x067fe003, 0x067c8003, 0x067c2003, 0x067dc003, 0x067d6003, 
-    0x067b0003, 0x067ba003, 0x067a4003, 0x067ae003, 0x06798003, 0x06792003, 0x0678c003, 0x06786003, 
-    0x06480003, 0x0648a003, 0x06494003, 0x0649e003, 0x064a8003, 0x064a2003, 0x064bc003, 0x064b6003, 
-    0x064d0003, 0x064da003, 0x064c4003, 0x064ce003, 0x064f8003, 0x064f2003, 0x064ec003, 0x064e6003, 
-    0x06420003, 0x0642a003, 0x06434003, 0x0643e003, 0x06408003, 0x06402003, 0x0641c003, 0x06416003, 
-    0x06470003, 0x0647a003, 0x06464003, 0x0646e003, 0x06458003, 0x06452003, 0x0644c003, 0x06446003, 
-    0x065c0003, 0x065ca003, 0x065d4003, 0x065de003, 0x065e8003, 0x065e2003, 0x065fc003, 0x065f6003, 
-    0x06590003, 0x0659a003, 0x06584003, 0x0658e003, 0x065b8003, 0x065b2003, 0x065ac003, 0x065a6003, 
-    0x06560003, 0x0656a003, 0x06574003, 0x0657e003, 0x06548003, 0x06542003, 0x0655c003, 0x06556003, 
-    0x06530003, 0x0653a003, 0x06524003, 0x0652e003, 0x06518003, 0x06512003, 0x0650c003, 0x06506003, 
-    0x06300003, 0x0630a003, 0x06314003, 0x0631e003, 0x06328003, 0x06322003, 0x0633c003, 0x06336003, 
-    0x06350003, 0x0635a003, 0x06344003, 0x0634e003, 0x06378003, 0x06372003, 0x0636c003, 0x06366003, 
-    0x063a0003, 0x063aa003, 0x063b4003, 0x063be003, 0x06388003, 0x06382003, 0x0639c003, 0x06396003, 
-    0x063f0003, 0x063fa003, 0x063e4003, 0x063ee003, 0x063d8003, 0x063d2003, 0x063cc003, 0x063c6003, 
-    0x06240003, 0x0624a003, 0x06254003, 0x0625e003, 0x06268003, 0x06262003, 0x0627c003, 0x06276003, 
-    0x06210003, 0x0621a003, 0x06204003, 0x0620e003, 0x06238003, 0x06232003, 0x0622c003, 0x06226003, 
-    0x062e0003, 0x062ea003, 0x062f4003, 0x062fe003, 0x062c8003, 0x062c2003, 0x062dc003, 0x062d6003, 
-    0x062b0003, 0x062ba003, 0x062a4003, 0x062ae003, 0x06298003, 0x06292003, 0x0628c003, 0x06286003, 
-    0x06180003, 0x0618a003, 0x06194003, 0x0619e003, 0x061a8003, 0x061a2003, 0x061bc003, 0x061b6003, 
-    0x061d0003, 0x061da003, 0x061c4003, 0x061ce003, 0x061f8003, 0x061f2003, 0x061ec003, 0x061e6003, 
-    0x06120003, 0x0612a003, 0x06134003, 0x0613e003, 0x06108003, 0x06102003, 0x0611c003, 0x06116003, 
-    0x06170003, 0x0617a003, 0x06164003, 0x0616e003, 0x06158003, 0x06152003, 0x0614c003, 0x06146003, 
-    0x060c0003, 0x060ca003, 0x060d4003, 0x060de003, 0x060e8003, 0x060e2003, 0x060fc003, 0x060f6003, 
-    0x06090003, 0x0609a003, 0x06084003, 0x0608e003, 0x060b8003, 0x060b2003, 0x060ac003, 0x060a6003, 
-    0x06060003, 0x0606a003, 0x06074003, 0x0607e003, 0x06048003, 0x06042003, 0x0605c003, 0x06056003, 
-    0x06030003, 0x0603a003, 0x06024003, 0x0602e003, 0x06018003, 0x06012003, 0x0600c003, 0x06006003 
-};
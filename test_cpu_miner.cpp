@@ -0,0 +1,89 @@
+#include "cpu_miner.hpp"
+#include "cpu_dispatch.hpp"
+#include "gpu_job.hpp"
+#include "nonce_scan.hpp"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+const uint32_t genesisNonce = 2083236893;
+
+BlockHeader genesisHeader() {
+    std::array<uint8_t, 76> bytes = genesisHeaderPrefix();
+    auto le32 = [&](size_t at) {
+        return uint32_t(bytes[at]) | uint32_t(bytes[at + 1]) << 8 | uint32_t(bytes[at + 2]) << 16 |
+               uint32_t(bytes[at + 3]) << 24;
+    };
+    BlockHeader header;
+    header.version = le32(0);
+    std::copy(bytes.begin() + 4, bytes.begin() + 36, header.prevBlockHash.begin());
+    std::copy(bytes.begin() + 36, bytes.begin() + 68, header.merkleRoot.begin());
+    header.timestamp = le32(68);
+    header.bits = le32(72);
+    header.nonce = 0;
+    return header;
+}
+
+// Little-endian targets: difficulty 1, where the kernels run their H7 early
+// exit, and one loose enough for a hit every few thousand nonces
+std::vector<uint8_t> difficultyOne() {
+    std::vector<uint8_t> target(32, 0);
+    target[26] = target[27] = 0xff;
+    return target;
+}
+
+std::vector<uint8_t> loose() {
+    std::vector<uint8_t> target(32, 0);
+    target[29] = target[28] = 0xff;
+    target[30] = 0x0f;
+    return target;
+}
+
+// What the session must report for [base, base + count): the lowest hit, as
+// found by the scalar reference
+void checkRange(MiningSession& session, const GpuJob& job, uint32_t base, uint32_t count) {
+    MiningResult result = session.mine(base, count);
+    std::vector<uint32_t> hits;
+    scanNoncesScalar(job.scan, base, count, hits);
+    BOOST_TEST_CONTEXT("range " << base << " + " << count) {
+        BOOST_TEST(result.hashesTried == count);
+        BOOST_TEST(result.found == !hits.empty());
+        if (result.found && !hits.empty())
+            BOOST_TEST(result.nonce == *std::min_element(hits.begin(), hits.end()));
+        BOOST_TEST(result.hash.size() == 32u);
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(cpu_miner)
+
+BOOST_AUTO_TEST_CASE(finds_the_genesis_nonce) {
+    for (unsigned threads : {1u, 3u}) {
+        auto session = makeCpuSession(threads);
+        session->setJob(genesisHeader(), difficultyOne());
+        MiningResult result = session->mine(genesisNonce - 100000, 200001);
+        BOOST_TEST(result.found);
+        BOOST_TEST(result.nonce == genesisNonce);
+        BOOST_TEST(result.hashesTried == 200001u);
+    }
+}
+
+// Unaligned starts and lengths, slices smaller than the thread count, and a
+// range that wraps past 2^32, for thread counts that split ranges unevenly
+BOOST_AUTO_TEST_CASE(ranges_match_the_scalar_scan) {
+    BlockHeader header = genesisHeader();
+    GpuJob job = makeGpuJob(header, loose());
+    for (unsigned threads : {1u, 3u, 4u}) {
+        auto session = makeCpuSession(threads);
+        session->setJob(header, loose());
+        checkRange(*session, job, 0, 65536);
+        checkRange(*session, job, 1000003, 77777);
+        checkRange(*session, job, 5, 3);
+        checkRange(*session, job, 4294967295u - 30000, 65536);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+#include "job_factory.hpp"
+#include "cpu_dispatch.hpp"
+#include "utils.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Hash = std::array<uint8_t, 32>;
+
+// The genesis coinbase split around its 4-byte extranonce, ffff001d
+const std::string genesisPrefix =
+    "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff4d04";
+const std::string genesisSuffix =
+    "0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e206272696e6b206f66"
+    "207365636f6e64206261696c6f757420666f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe55"
+    "48271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba"
+    "0b8d578a4c702b6bf11d5fac00000000";
+
+Hash sha256d(const uint8_t* data, size_t size) {
+    Hash out;
+    hashDispatch().sha256d(data, size, out.data());
+    return out;
+}
+
+JobTemplate genesisTemplate() {
+    JobTemplate tmpl;
+    tmpl.header.version = 1;
+    tmpl.header.timestamp = 1231006505;
+    tmpl.header.bits = 0x1d00ffff;
+    tmpl.target.assign(32, 0xff);
+    tmpl.coinbasePrefix = hexToBytes(genesisPrefix);
+    tmpl.coinbaseSuffix = hexToBytes(genesisSuffix);
+    return tmpl;
+}
+
+// The whole tree, built level by level the way a node does
+Hash naiveRoot(std::vector<Hash> level) {
+    while (level.size() > 1) {
+        if (level.size() % 2) level.push_back(level.back());
+        std::vector<Hash> up;
+        for (size_t i = 0; i < level.size(); i += 2) {
+            uint8_t pair[64];
+            std::memcpy(pair, level[i].data(), 32);
+            std::memcpy(pair + 32, level[i + 1].data(), 32);
+            up.push_back(sha256d(pair, 64));
+        }
+        level = up;
+    }
+    return level[0];
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(job_factory)
+
+BOOST_AUTO_TEST_CASE(genesis_coinbase_gives_the_genesis_root) {
+    PreparedJob job = prepareJob(genesisTemplate(), 0x1d00ffff);
+    std::vector<uint8_t> root(job.header.merkleRoot.rbegin(), job.header.merkleRoot.rend());
+    BOOST_TEST(bytesToHex(root) == "4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_branch_matches_the_full_tree) {
+    JobTemplate tmpl = genesisTemplate();
+    for (int others = 0; others < 10; ++others) {
+        std::vector<Hash> txids;
+        for (int i = 0; i < others; ++i) {
+            uint8_t seed = (uint8_t)i;
+            txids.push_back(sha256d(&seed, 1));
+        }
+        tmpl.merkleBranch = merkleBranch(txids);
+        PreparedJob job = prepareJob(tmpl, 7);
+        std::vector<Hash> leaves{sha256d(job.coinbase.data(), job.coinbase.size())};
+        leaves.insert(leaves.end(), txids.begin(), txids.end());
+        BOOST_TEST(job.header.merkleRoot == naiveRoot(leaves), others << " other transactions");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(jobs_come_in_order_until_the_extranonces_run_out) {
+    JobTemplate tmpl = genesisTemplate();
+    tmpl.extranonceSize = 1;
+    JobFactory factory(tmpl, 4);
+    for (uint64_t sequence = 0; sequence < 256; ++sequence) {
+        PreparedJob job = factory.next();
+        BOOST_REQUIRE(job.sequence == sequence);
+        BOOST_TEST(job.coinbase[tmpl.coinbasePrefix.size()] == (uint8_t)sequence);
+    }
+    BOOST_CHECK_THROW(factory.next(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(without_a_coinbase_the_timestamp_rolls) {
+    JobTemplate tmpl = genesisTemplate();
+    tmpl.coinbasePrefix.clear();
+    tmpl.coinbaseSuffix.clear();
+    {
+        JobFactory factory(tmpl, 2);
+        for (uint32_t i = 0; i < 3; ++i) {
+            PreparedJob job = factory.next();
+            BOOST_TEST(job.header.timestamp == tmpl.header.timestamp + i);
+            BOOST_TEST(job.coinbase.empty());
+        }
+    }
+    BOOST_CHECK_THROW(prepareJob(tmpl, maxTimestampRoll + 1), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,4 @@
+// Boost.Test runner for the test_*.cpp suites; build.sh links them into
+// build/tests/unit_tests and runs it after every build
+#define BOOST_TEST_MODULE quantum_miner
+#include <boost/test/included/unit_test.hpp>
@@ -0,0 +1,264 @@
+#include "nonce_scheduler.hpp"
+#include "cpu_miner.hpp"
+#include "gpu_job.hpp"
+#include "nonce_scan.hpp"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Records every range it is given; sleeps per call, and optionally per nonce, to
+// stand in for a device
+struct FakeSession : MiningSession {
+    struct Log {
+        std::mutex mutex;
+        std::map<uint64_t, uint64_t> ranges;   // base -> nonces reported tried
+    };
+
+    Log& log;
+    std::chrono::microseconds delay;
+    int failOnCall = 0;           // throw on this call (1-based), 0: never
+    uint32_t cap = UINT32_MAX;    // scans at most this many nonces of a range
+    double noncesPerUs = 0;       // hash rate; 0: only the fixed delay
+    std::vector<uint32_t> counts;   // every range's count, in order
+    int calls = 0;
+
+    FakeSession(Log& log, std::chrono::microseconds delay) : log(log), delay(delay) {}
+
+    std::string describe() const override { return "fake"; }
+    void loadJob(const GpuJob&) override {}
+
+    MiningResult mine(uint32_t nonceBase, uint32_t count) override {
+        counts.push_back(count);
+        count = std::min(count, cap);
+        std::this_thread::sleep_for(delay);
+        if (noncesPerUs > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds((long long)(count / noncesPerUs)));
+        if (++calls == failOnCall) throw std::runtime_error("fake session failed");
+        {
+            std::lock_guard<std::mutex> lock(log.mutex);
+            log.ranges[nonceBase] = count;
+        }
+        MiningResult result;
+        result.hashesTried = count;
+        result.hash.assign(32, 0);
+        return result;
+    }
+};
+
+// True if the logged ranges tile [0, 2^32) exactly, with no gap or overlap
+bool tilesNonceSpace(const FakeSession::Log& log) {
+    uint64_t next = 0;
+    for (const auto& [base, count] : log.ranges) {
+        if (base != next) return false;
+        next = base + count;
+    }
+    return next == uint64_t(1) << 32;
+}
+
+// GPU-like: three ranges deep, and while the epoch is 1 every range it returns
+// claims a hit; results of an older job must never be reported as found
+struct StalePipe : MiningSession {
+    const std::atomic<uint64_t>& epoch;
+    std::deque<std::pair<uint32_t, uint32_t>> queue;
+
+    explicit StalePipe(const std::atomic<uint64_t>& epoch) : epoch(epoch) {}
+
+    std::string describe() const override { return "stale pipe"; }
+    void loadJob(const GpuJob&) override {}
+    MiningResult mine(uint32_t nonceBase, uint32_t count) override {
+        submit(nonceBase, count);
+        return collect();
+    }
+    size_t pipelineDepth() const override { return 3; }
+    void submit(uint32_t nonceBase, uint32_t count) override { queue.emplace_back(nonceBase, count); }
+    MiningResult collect() override {
+        auto [nonceBase, count] = queue.front();
+        queue.pop_front();
+        std::this_thread::sleep_for(std::chrono::microseconds(count / 1000));   // 1 GH/s
+        MiningResult result;
+        result.hashesTried = count;
+        result.hash.assign(32, 0);
+        if (epoch.load() == 1) {
+            result.found = true;
+            result.nonce = nonceBase;
+        }
+        return result;
+    }
+};
+
+const BlockHeader header{};
+const std::vector<uint8_t> target(32, 0);
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(nonce_scheduler)
+
+BOOST_AUTO_TEST_CASE(chunks_cover_the_nonce_space_once) {
+    for (uint32_t chunkSize : {1u << 22, 3000000000u}) {
+        FakeSession::Log log;
+        std::vector<std::unique_ptr<MiningSession>> sessions;
+        sessions.push_back(std::make_unique<FakeSession>(log, std::chrono::microseconds(0)));
+        sessions.push_back(std::make_unique<FakeSession>(log, std::chrono::microseconds(0)));
+        NonceScheduler scheduler(std::move(sessions), chunkSize);
+        std::atomic<bool> stop{false};
+        uint64_t reported = 0;
+        MiningResult result = scheduler.mineJob(header, target, stop,
+            [&](size_t, uint32_t, const MiningResult& batch) { reported += batch.hashesTried; });
+        BOOST_TEST(tilesNonceSpace(log));
+        BOOST_TEST(result.hashesTried == uint64_t(1) << 32);
+        BOOST_TEST(reported == result.hashesTried);
+        BOOST_TEST(!result.found);
+    }
+}
+
+// A fast worker empties its own share and then takes most of the slow one's
+BOOST_AUTO_TEST_CASE(fast_worker_steals_from_slow_one) {
+    FakeSession::Log log;
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    sessions.push_back(std::make_unique<FakeSession>(log, std::chrono::microseconds(100)));
+    sessions.push_back(std::make_unique<FakeSession>(log, std::chrono::milliseconds(20)));
+    NonceScheduler scheduler(std::move(sessions), 1u << 26);   // 64 chunks, 32 each to start
+    std::atomic<bool> stop{false};
+    std::vector<int> batches(2);
+    scheduler.mineJob(header, target, stop,
+        [&](size_t worker, uint32_t, const MiningResult&) { batches[worker]++; });
+    BOOST_TEST(tilesNonceSpace(log));
+    BOOST_TEST(batches[0] > 48);
+    BOOST_TEST(batches[0] + batches[1] == 64);
+}
+
+BOOST_AUTO_TEST_CASE(stop_ends_the_job_early) {
+    FakeSession::Log log;
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    sessions.push_back(std::make_unique<FakeSession>(log, std::chrono::microseconds(500)));
+    sessions.push_back(std::make_unique<FakeSession>(log, std::chrono::microseconds(500)));
+    NonceScheduler scheduler(std::move(sessions), 1u << 20);
+    std::atomic<bool> stop{false};
+    int batches = 0;
+    MiningResult result = scheduler.mineJob(header, target, stop,
+        [&](size_t, uint32_t, const MiningResult&) { if (++batches == 50) stop = true; });
+    BOOST_TEST(!result.found);
+    BOOST_TEST(log.ranges.size() < 60u);
+    BOOST_TEST(result.hashesTried == uint64_t(log.ranges.size()) << 20);
+}
+
+BOOST_AUTO_TEST_CASE(worker_exception_is_rethrown) {
+    FakeSession::Log log;
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    sessions.push_back(std::make_unique<FakeSession>(log, std::chrono::microseconds(100)));
+    auto failing = std::make_unique<FakeSession>(log, std::chrono::microseconds(100));
+    failing->failOnCall = 5;
+    sessions.push_back(std::move(failing));
+    NonceScheduler scheduler(std::move(sessions), 1u << 20);
+    std::atomic<bool> stop{false};
+    BOOST_CHECK_THROW(scheduler.mineJob(header, target, stop, nullptr), std::runtime_error);
+}
+
+// Sessions that scan only part of each range get the rest back, so the nonce
+// space is still tiled exactly
+BOOST_AUTO_TEST_CASE(shortfall_is_queued_again) {
+    FakeSession::Log log;
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    for (uint32_t cap : {1000000u, 3u << 20}) {
+        auto capped = std::make_unique<FakeSession>(log, std::chrono::microseconds(0));
+        capped->cap = cap;
+        sessions.push_back(std::move(capped));
+    }
+    NonceScheduler scheduler(std::move(sessions), 1u << 22);
+    std::atomic<bool> stop{false};
+    MiningResult result = scheduler.mineJob(header, target, stop, nullptr);
+    BOOST_TEST(tilesNonceSpace(log));
+    BOOST_TEST(result.hashesTried == uint64_t(1) << 32);
+}
+
+BOOST_AUTO_TEST_CASE(session_scanning_nothing_is_an_error) {
+    FakeSession::Log log;
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    auto stuck = std::make_unique<FakeSession>(log, std::chrono::microseconds(0));
+    stuck->cap = 0;
+    sessions.push_back(std::move(stuck));
+    NonceScheduler scheduler(std::move(sessions), 1u << 22);
+    std::atomic<bool> stop{false};
+    BOOST_CHECK_THROW(scheduler.mineJob(header, target, stop, nullptr), std::runtime_error);
+}
+
+// Batches start at one chunk and grow to about the batch target's worth of the
+// measured rate; loose bounds, the sleeps are only roughly timed
+BOOST_AUTO_TEST_CASE(batches_grow_to_the_target_latency) {
+    FakeSession::Log log;
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    auto rated = std::make_unique<FakeSession>(log, std::chrono::microseconds(0));
+    rated->noncesPerUs = 100;   // 100 MH/s: 2M nonces in the 20 ms target
+    FakeSession& session = *rated;
+    sessions.push_back(std::move(rated));
+    NonceScheduler scheduler(std::move(sessions), 4096, std::chrono::milliseconds(20));
+    std::atomic<bool> stop{false};
+    int batches = 0;
+    scheduler.mineJob(header, target, stop,
+        [&](size_t, uint32_t, const MiningResult&) { if (++batches == 60) stop = true; });
+    BOOST_REQUIRE(session.counts.size() >= 60u);
+    BOOST_TEST(session.counts.front() == 4096u);
+    std::vector<uint32_t> late(session.counts.end() - 20, session.counts.end());
+    std::sort(late.begin(), late.end());
+    BOOST_TEST(late[10] > 500000u);
+    BOOST_TEST(late[10] < 8000000u);
+}
+
+// A new epoch mid-job: the CPU session cuts its batch short, the pipe's stale
+// "hits" are counted but not found, and the job returns without finishing the
+// nonce space. The same sessions then mine the next epoch normally.
+BOOST_AUTO_TEST_CASE(new_epoch_cuts_the_job_short) {
+    std::atomic<uint64_t> epoch{0};
+    std::vector<std::unique_ptr<MiningSession>> sessions;
+    sessions.push_back(makeCpuSession(2));
+    sessions.push_back(std::make_unique<StalePipe>(epoch));
+    NonceScheduler scheduler(std::move(sessions), 65536, std::chrono::milliseconds(50));
+    std::atomic<bool> stop{false};
+
+    std::vector<uint8_t> unreachable(32, 0);
+    unreachable[0] = 1;
+    uint64_t reported = 0, cpuPartial = 0;
+    bool wrongEpoch = false;
+    std::thread bump([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        epoch = 1;
+    });
+    auto start = std::chrono::steady_clock::now();
+    MiningResult result = scheduler.mineJob(makeGpuJob(header, unreachable), 0, epoch, stop,
+        [&](size_t worker, uint32_t, const MiningResult& batch) {
+            reported += batch.hashesTried;
+            wrongEpoch |= batch.epoch != 0;
+            if (worker == 0 && batch.hashesTried % 65536) cpuPartial++;
+        });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    bump.join();
+
+    BOOST_TEST(!result.found);
+    BOOST_TEST(result.epoch == 0u);
+    BOOST_TEST(!wrongEpoch);
+    BOOST_TEST(seconds < 1.5);
+    BOOST_TEST(result.hashesTried < uint64_t(1) << 32);
+    BOOST_TEST(result.hashesTried == reported);
+    BOOST_TEST(cpuPartial > 0u);
+
+    // About one hit per 2^12 nonces: the CPU session finds one at once
+    std::vector<uint8_t> loose(32, 0xff);
+    loose[31] = 0;
+    loose[30] = 0x0f;
+    epoch = 5;
+    GpuJob job = makeGpuJob(header, loose);
+    MiningResult next = scheduler.mineJob(job, 5, epoch, stop, nullptr);
+    BOOST_TEST(next.epoch == 5u);
+    BOOST_TEST(next.found);
+    BOOST_TEST(confirmNonce(job.scan, next.nonce));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
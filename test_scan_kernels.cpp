@@ -0,0 +1,83 @@
+#include "cpu_dispatch.hpp"
+#include "midstate_utils.hpp"
+#include "nonce_scan.hpp"
+#include "sha256_bitslice.hpp"
+#include "sha256_ilp.hpp"
+#include "sha256_jit.hpp"
+#include <boost/test/unit_test.hpp>
+#include <vector>
+
+namespace {
+
+const uint32_t genesisNonce = 2083236893;
+
+typedef uint64_t (*ScanFn)(const ScanJob&, uint32_t, uint32_t, std::vector<uint32_t>&);
+
+// Every hit the scalar reference finds in [start, start + count), in order
+std::vector<uint32_t> scalarHits(const ScanJob& job, uint32_t start, uint32_t count) {
+    std::vector<uint32_t> hits;
+    scanNoncesScalar(job, start, count, hits);
+    return hits;
+}
+
+// The kernel must agree with the scalar scan on starts and lengths that are not
+// multiples of its width, at difficulty 1 (H7 early exit) and with a target
+// loose enough that most batches carry a hit (full compare). The longer ranges
+// span whole 512-nonce batches with a partial one at each end, the last running
+// up to the top of the nonce space.
+void checkAgainstScalar(ScanFn fn) {
+    ScanJob network = genesisScanJob(0);
+    ScanJob loose = genesisScanJob(0x0fffffff);
+    struct Range { uint32_t start, count; };
+    const Range ranges[] = {{0, 1},    {1, 2},       {3, 5},
+                            {1000, 1}, {1001, 127},  {4294967295u - 70, 70},
+                            {0, 1024}, {511, 1537},  {4294967296u - 1100, 1100}};
+
+    for (const Range& r : ranges) {
+        BOOST_TEST_CONTEXT("range " << r.start << " + " << r.count) {
+            std::vector<uint32_t> hits;
+            BOOST_TEST(fn(loose, r.start, r.count, hits) == r.count);
+            BOOST_TEST(hits == scalarHits(loose, r.start, r.count));
+        }
+    }
+
+    std::vector<uint32_t> hits;
+    BOOST_TEST(fn(network, genesisNonce - 1001, 2003, hits) == 2003u);
+    BOOST_TEST(hits == std::vector<uint32_t>{genesisNonce});
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(scan_kernels)
+
+BOOST_AUTO_TEST_CASE(ilp_matches_scalar) {
+    checkAgainstScalar(scanNoncesILP<2>);
+    checkAgainstScalar(scanNoncesILP<3>);
+    checkAgainstScalar(scanNoncesILP<4>);
+}
+
+// Batches are aligned to the lane count, so heads and tails go through the
+// scalar scan and only the middle of a range is bitsliced
+BOOST_AUTO_TEST_CASE(bitslice_matches_scalar) {
+    if (cpuFeatures().avx2) checkAgainstScalar(scanNoncesBitslice256);
+    if (cpuFeatures().avx512f && cpuFeatures().avx512vl) checkAgainstScalar(scanNoncesBitslice512);
+}
+
+// Alternating jobs on one thread: the kernel each thread keeps must be swapped
+// whenever the job changes, not reused for the next job's nonces
+BOOST_AUTO_TEST_CASE(jit_matches_scalar_across_job_changes) {
+    checkAgainstScalar(scanNoncesJIT);
+
+    ScanJob jobs[] = {genesisScanJob(0x0fffffff), genesisScanJob(0x0fffffff)};
+    jobs[1].tail[0] ^= 1;
+    jobs[1].prepared = prepareTail(jobs[1].midstate, jobs[1].tail);
+    for (int round = 0; round < 3; ++round) {
+        for (const ScanJob& job : jobs) {
+            std::vector<uint32_t> hits;
+            scanNoncesJIT(job, 5000, 300, hits);
+            BOOST_TEST(hits == scalarHits(job, 5000, 300));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
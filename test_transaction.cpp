@@ -0,0 +1,99 @@
+#include "blocktemplate.hpp"
+#include "transaction.hpp"
+#include "utils.hpp"
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+// The genesis block's coinbase, txid 4a5e1e4b...a33b
+const std::string genesisCoinbase =
+    "01000000010000000000000000000000000000000000000000000000000000000000000000ffffffff4d04ffff001d"
+    "0104455468652054696d65732030332f4a616e2f32303039204368616e63656c6c6f72206f6e206272696e6b206f66"
+    "207365636f6e64206261696c6f757420666f722062616e6b73ffffffff0100f2052a01000000434104678afdb0fe55"
+    "48271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba"
+    "0b8d578a4c702b6bf11d5fac00000000";
+const std::string genesisTxid = "4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b";
+
+// The same transaction with a BIP 144 marker, flag and one 32-byte witness item
+// (bytes 00..1f): stripping them must give the genesis txid back. The wtxid was
+// computed separately over the full serialization.
+const std::string segwitCoinbase =
+    "01000000000101" + genesisCoinbase.substr(10, genesisCoinbase.size() - 18) +
+    "0120000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f00000000";
+const std::string segwitWtxid = "4b08d196bb7c5181c3824eae217caab594c0157d7461197befab879f0b94681a";
+
+std::string display(const std::array<uint8_t, 32>& hash) {
+    return bytesToHex(std::vector<uint8_t>(hash.rbegin(), hash.rend()));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(transaction)
+
+BOOST_AUTO_TEST_CASE(legacy_txid_and_weight) {
+    std::vector<uint8_t> raw = hexToBytes(genesisCoinbase);
+    std::vector<TxView> txs{parseTransaction(raw, 0)};
+    hashTransactions(raw, txs);
+    BOOST_TEST(!txs[0].segwit);
+    BOOST_TEST(txs[0].size == raw.size());
+    BOOST_TEST(txs[0].weight == 4 * raw.size());
+    BOOST_TEST(display(txs[0].txid) == genesisTxid);
+    BOOST_TEST(display(txs[0].wtxid) == genesisTxid);
+}
+
+BOOST_AUTO_TEST_CASE(segwit_txid_skips_the_witness) {
+    std::vector<uint8_t> raw = hexToBytes(segwitCoinbase);
+    std::vector<TxView> txs{parseTransaction(raw, 0)};
+    hashTransactions(raw, txs);
+    BOOST_TEST(txs[0].segwit);
+    BOOST_TEST(txs[0].size == 240u);
+    BOOST_TEST(txs[0].witnessSize == 34u);
+    BOOST_TEST(txs[0].strippedSize() == 204u);
+    BOOST_TEST(txs[0].weight == 204u * 3 + 240u);
+    BOOST_TEST(display(txs[0].txid) == genesisTxid);
+    BOOST_TEST(display(txs[0].wtxid) == segwitWtxid);
+}
+
+BOOST_AUTO_TEST_CASE(malformed_transactions_throw) {
+    std::vector<uint8_t> raw = hexToBytes(segwitCoinbase);
+    raw.pop_back();
+    BOOST_CHECK_THROW(parseTransaction(raw, 0), std::runtime_error);
+    BOOST_CHECK_THROW(parseTransaction(raw, raw.size() + 1), std::runtime_error);
+    BOOST_CHECK_THROW(hexToBytes("abc"), std::runtime_error);
+    BOOST_CHECK_THROW(hexToBytes("0g"), std::runtime_error);
+}
+
+// Enough transactions that the hashes are split across the worker pool on
+// multi-core hosts; every one must still match its own single hash
+BOOST_AUTO_TEST_CASE(large_template_matches_single_hashes) {
+    nlohmann::json txs = nlohmann::json::array();
+    for (int i = 0; i < 3000; ++i) {
+        std::string hex = i % 2 ? segwitCoinbase : genesisCoinbase;
+        hex.replace(hex.size() - 8, 8, bytesToHex({uint8_t(i), uint8_t(i >> 8), 0, 0}));   // locktime
+        txs.push_back({{"data", hex}});
+    }
+    std::vector<uint8_t> buffer;
+    std::vector<TxView> views = decodeTransactions(txs, buffer);
+    BOOST_REQUIRE(views.size() == 3000u);
+    for (size_t i = 0; i < views.size(); ++i) {
+        std::vector<uint8_t> raw = hexToBytes(txs[i]["data"].get<std::string>());
+        std::vector<TxView> single{parseTransaction(raw, 0)};
+        hashTransactions(raw, single);
+        BOOST_TEST(views[i].txid == single[0].txid);
+        BOOST_TEST(views[i].wtxid == single[0].wtxid);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(node_txid_must_match) {
+    std::vector<uint8_t> buffer;
+    nlohmann::json good = {{{"data", segwitCoinbase}, {"txid", genesisTxid}}};
+    BOOST_TEST(decodeTransactions(good, buffer).size() == 1u);
+    nlohmann::json bad = {{{"data", segwitCoinbase}, {"txid", segwitWtxid}}};
+    BOOST_CHECK_THROW(decodeTransactions(bad, buffer), std::runtime_error);
+    nlohmann::json trailing = {{{"data", genesisCoinbase + "00"}}};
+    BOOST_CHECK_THROW(decodeTransactions(trailing, buffer), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,30 @@
+#include "worker_pool.hpp"
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(worker_pool)
+
+BOOST_AUTO_TEST_CASE(every_worker_runs_each_task_once) {
+    WorkerPool pool(4);
+    BOOST_TEST(pool.size() == 4u);
+    for (int round = 0; round < 100; ++round) {
+        std::vector<std::atomic<int>> runs(pool.size());
+        pool.run([&](unsigned worker) { runs[worker]++; });
+        for (const auto& n : runs) BOOST_TEST(n.load() == 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(first_exception_is_rethrown) {
+    WorkerPool pool(3);
+    BOOST_CHECK_THROW(pool.run([](unsigned worker) {
+        if (worker == 1) throw std::runtime_error("worker failed");
+    }), std::runtime_error);
+    // and the pool stays usable
+    std::atomic<int> runs{0};
+    pool.run([&](unsigned) { runs++; });
+    BOOST_TEST(runs.load() == 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,145 @@
+#include "transaction.hpp"
+#include "sha256_multibuffer.hpp"
+#include "worker_pool.hpp"
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Below this many hashes the threads cost more than they save
+static const size_t jobsPerWorker = 512;
+
+namespace {
+
+// Bounds-checked reads over the buffer
+struct TxReader {
+    std::span<const uint8_t> buffer;
+    size_t pos;
+
+    void need(uint64_t n) const {
+        if (n > buffer.size() - pos)
+            throw std::runtime_error("Transaction truncated at byte " + std::to_string(pos));
+    }
+
+    void skip(uint64_t n) {
+        need(n);
+        pos += n;
+    }
+
+    uint64_t varInt() {
+        need(1);
+        uint8_t first = buffer[pos++];
+        int width = first == 0xfd ? 2 : first == 0xfe ? 4 : first == 0xff ? 8 : 0;
+        if (!width) return first;
+        need(width);
+        uint64_t value = 0;
+        for (int i = 0; i < width; i++) value |= uint64_t(buffer[pos++]) << (8 * i);
+        return value;
+    }
+};
+
+} // namespace
+
+TxView parseTransaction(std::span<const uint8_t> buffer, size_t offset) {
+    if (offset > buffer.size()) throw std::runtime_error("Transaction offset past the buffer");
+    TxReader in{buffer, offset};
+    TxView tx;
+    tx.offset = offset;
+
+    in.skip(4);   // version
+    in.need(2);
+    tx.segwit = buffer[in.pos] == 0x00 && buffer[in.pos + 1] == 0x01;
+    if (tx.segwit) in.skip(2);
+
+    uint64_t inputs = in.varInt();
+    if (inputs == 0) throw std::runtime_error("Transaction has no inputs");
+    for (uint64_t i = 0; i < inputs; i++) {
+        in.skip(36);              // prevout
+        in.skip(in.varInt());     // scriptSig
+        in.skip(4);               // sequence
+    }
+    uint64_t outputs = in.varInt();
+    for (uint64_t i = 0; i < outputs; i++) {
+        in.skip(8);               // value
+        in.skip(in.varInt());     // scriptPubKey
+    }
+
+    if (tx.segwit) {
+        tx.witnessOffset = in.pos;
+        for (uint64_t i = 0; i < inputs; i++) {
+            uint64_t items = in.varInt();
+            for (uint64_t j = 0; j < items; j++) in.skip(in.varInt());
+        }
+        tx.witnessSize = in.pos - tx.witnessOffset;
+    }
+
+    in.skip(4);   // locktime
+    tx.size = in.pos - offset;
+    tx.weight = (uint32_t)(tx.strippedSize() * 3 + tx.size);
+    return tx;
+}
+
+namespace {
+
+// Started on the first large template and kept for later ones; the mutex keeps
+// templates hashed from different threads to one task at a time
+WorkerPool& hashPool() {
+    static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    return pool;
+}
+
+std::mutex hashPoolMutex;
+
+} // namespace
+
+void hashTransactions(std::span<const uint8_t> buffer, std::span<TxView> txs) {
+    // The txid skips marker, flag and witnesses; the wtxid hashes everything.
+    // Without witness data the two are the same hash, computed once.
+    std::vector<Sha256dJob> jobs;
+    jobs.reserve(txs.size() * 2);
+    for (TxView& tx : txs) {
+        const uint8_t* raw = buffer.data() + tx.offset;
+        Sha256dJob txid;
+        txid.out = tx.txid.data();
+        if (tx.segwit) {
+            size_t witnessAt = tx.witnessOffset - tx.offset;
+            txid.part[0] = raw;
+            txid.len[0] = 4;
+            txid.part[1] = raw + 6;
+            txid.len[1] = witnessAt - 6;
+            txid.part[2] = raw + tx.size - 4;
+            txid.len[2] = 4;
+
+            Sha256dJob wtxid;
+            wtxid.part[0] = raw;
+            wtxid.len[0] = tx.size;
+            wtxid.out = tx.wtxid.data();
+            jobs.push_back(wtxid);
+        } else {
+            txid.part[0] = raw;
+            txid.len[0] = tx.size;
+        }
+        jobs.push_back(txid);
+    }
+
+    size_t workers = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                      jobs.size() / jobsPerWorker);
+    if (workers <= 1) {
+        sha256dMultiBuffer(jobs);
+    } else {
+        std::lock_guard<std::mutex> lock(hashPoolMutex);
+        WorkerPool& pool = hashPool();
+        workers = std::min<size_t>(workers, pool.size());
+        size_t chunk = (jobs.size() + workers - 1) / workers;
+        pool.run([&](unsigned worker) {
+            size_t start = worker * chunk;
+            if (start >= jobs.size()) return;
+            sha256dMultiBuffer(std::span<const Sha256dJob>(jobs.data() + start, std::min(chunk, jobs.size() - start)));
+        });
+    }
+
+    for (TxView& tx : txs)
+        if (!tx.segwit) tx.wtxid = tx.txid;
+}
@@ -0,0 +1,33 @@
+#ifndef TRANSACTION_HPP
+#define TRANSACTION_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// A transaction's layout inside a caller-owned buffer of serialized transactions,
+// plus the values derived from it. Nothing is copied out of the buffer.
+struct TxView {
+    size_t offset = 0;          // serialization starts here in the buffer
+    size_t size = 0;            // total size, witness included
+    size_t witnessOffset = 0;   // BIP 144 witness section, or 0 with witnessSize 0
+    size_t witnessSize = 0;
+    bool segwit = false;        // has the 0x00 0x01 marker and flag
+    std::array<uint8_t, 32> txid;    // hash byte order (reverse for display)
+    std::array<uint8_t, 32> wtxid;
+    uint32_t weight = 0;        // 3 * stripped size + total size
+
+    // Serialized size without marker, flag and witnesses
+    size_t strippedSize() const { return segwit ? size - 2 - witnessSize : size; }
+};
+
+// Parses the transaction at `offset`: sizes and witness location, no hashes.
+// Throws std::runtime_error if it is malformed or runs past the buffer.
+TxView parseTransaction(std::span<const uint8_t> buffer, size_t offset);
+
+// Fills txid, wtxid and weight for every parsed view. The hashes run through
+// sha256dMultiBuffer, split across a shared worker pool for large templates.
+void hashTransactions(std::span<const uint8_t> buffer, std::span<TxView> txs);
+
+#endif // TRANSACTION_HPP
@@ -7,9 +7,6 @@
 #include <string>
 #include "block.hpp"  // for BlockHeader struct
 
-// Calculate midstate from header prefix bytes (first 64 bytes)
-std::array<uint32_t, 8> calculateMidstateArray(const std::vector<uint8_t>& headerPrefix);
-
 // Serialize a block header to a vector of bytes (inline to avoid duplicate symbol)
 inline std::vector<uint8_t> serializeHeader(const BlockHeader& header) {
     return header.toBytes();
@@ -24,6 +21,9 @@ std::vector<uint8_t> bitsToTarget(uint32_t bits);
 // Convert bytes to hex string
 std::string bytesToHex(const std::vector<uint8_t>& bytes);
 
+// Convert hex string to bytes; throws std::runtime_error on odd length or a non-hex digit
+std::vector<uint8_t> hexToBytes(const std::string& hex);
+
 // Load block template JSON from file
 std::string loadBlockTemplate(const std::string& filepath);
 
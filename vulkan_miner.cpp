@@ -0,0 +1,390 @@
+#include "vulkan_miner.hpp"
+#include "gpu_job.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vulkan/vulkan.h>
+
+static const uint32_t localSize = 256;   // local_size_x in mineKernel.comp
+
+static void check(VkResult result, const char* what) {
+    if (result != VK_SUCCESS)
+        throw std::runtime_error(std::string("Vulkan: ") + what + " failed (VkResult " +
+                                 std::to_string(result) + ")");
+}
+
+static std::vector<uint32_t> readShader() {
+    const char* path = std::getenv("MINER_VULKAN_SHADER");
+    if (!path) path = "mineKernel.spv";
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error(std::string("Vulkan: cannot open shader ") + path);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (bytes.empty() || bytes.size() % 4 != 0)
+        throw std::runtime_error(std::string("Vulkan: ") + path + " is not SPIR-V");
+    std::vector<uint32_t> code(bytes.size() / 4);
+    std::memcpy(code.data(), bytes.data(), bytes.size());
+    return code;
+}
+
+// A storage buffer in host-visible, coherent memory, mapped for its whole life
+struct HostBuffer {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    uint32_t* mapped = nullptr;
+};
+
+// Device, pipeline, buffers and recorded dispatches, created once. Each pipeline
+// slot has its own result and nonce-base buffers, descriptor set, command buffer
+// and fence, so gpuPipelineDepth ranges can be queued at once. The nonce base
+// lives in a buffer, so ranges of the same size resubmit a slot's command buffer;
+// it is re-recorded only when the range size changes.
+class VulkanSession : public MiningSession {
+public:
+    VulkanSession() {
+        try {
+            setup();
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    ~VulkanSession() override { release(); }
+
+    VulkanSession(const VulkanSession&) = delete;
+    VulkanSession& operator=(const VulkanSession&) = delete;
+
+    std::string describe() const override { return "vulkan (" + deviceName + ")"; }
+
+    // Coherent mappings: these writes are visible to the device at the next submit
+    void loadJob(const GpuJob& prepared) override {
+        if (inFlight) throw std::runtime_error("Vulkan: loadJob with ranges still in flight");
+        job = prepared;
+        std::memcpy(jobBuffers[Midstate].mapped, job.midstate, sizeof(job.midstate));
+        std::memcpy(jobBuffers[Tail].mapped, job.tail32, sizeof(job.tail32));
+        std::memcpy(jobBuffers[Target].mapped, job.target32, sizeof(job.target32));
+    }
+
+    MiningResult mine(uint32_t nonceBase, uint32_t count) override {
+        submit(nonceBase, count);
+        return collect();
+    }
+
+    size_t pipelineDepth() const override { return gpuPipelineDepth; }
+
+    void submit(uint32_t nonceBase, uint32_t count) override {
+        if (inFlight == gpuPipelineDepth) throw std::runtime_error("Vulkan: submit with the pipeline full");
+        Slot& slot = slots[(next + inFlight) % gpuPipelineDepth];
+        uint64_t wanted = std::max<uint64_t>(1, (uint64_t(count) + localSize - 1) / localSize);
+        uint32_t groups = (uint32_t)std::min<uint64_t>(wanted, maxGroups);
+        if (groups != slot.recordedGroups) recordDispatch(slot, groups);
+        resetGpuResult(*reinterpret_cast<GpuResult*>(slot.result.mapped), nonceBase);
+        // The last work group may run past count; those invocations don't hash
+        slot.nonceBase.mapped[0] = nonceBase;
+        slot.nonceBase.mapped[1] = count;
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &slot.commandBuffer;
+        check(vkQueueSubmit(queue, 1, &submitInfo, slot.fence), "vkQueueSubmit");
+        ++inFlight;
+    }
+
+    MiningResult collect() override {
+        if (inFlight == 0) throw std::runtime_error("Vulkan: collect with nothing submitted");
+        Slot& slot = slots[next];
+        next = (next + 1) % gpuPipelineDepth;
+        --inFlight;
+        check(vkWaitForFences(device, 1, &slot.fence, VK_TRUE, UINT64_MAX), "vkWaitForFences");
+        check(vkResetFences(device, 1, &slot.fence), "vkResetFences");
+
+        // Read in place: the header words and only the candidates that were written
+        return finishGpuResult(job, *reinterpret_cast<GpuResult*>(slot.result.mapped));
+    }
+
+private:
+    // Binding order in mineKernel.comp
+    enum { Midstate, Tail, Target, Result, NonceBase, BufferCount };
+
+    struct Slot {
+        HostBuffer result, nonceBase;
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+        uint32_t recordedGroups = 0;   // work groups in the recorded dispatch; 0 before the first
+    };
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    VkShaderModule shader = VK_NULL_HANDLE;
+    VkDescriptorSetLayout setLayout = VK_NULL_HANDLE;
+    VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    HostBuffer jobBuffers[Result];   // midstate, tail and target, shared by every slot
+    Slot slots[gpuPipelineDepth];
+    size_t next = 0;                 // oldest in-flight slot
+    size_t inFlight = 0;
+    std::string deviceName;
+    uint32_t maxGroups = 0;          // the device's maxComputeWorkGroupCount[0]
+    GpuJob job{};
+
+    void setup() {
+        VkApplicationInfo app{};
+        app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        app.pApplicationName = "quantum_miner";
+        app.apiVersion = VK_API_VERSION_1_0;
+        VkInstanceCreateInfo instanceInfo{};
+        instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instanceInfo.pApplicationInfo = &app;
+        check(vkCreateInstance(&instanceInfo, nullptr, &instance), "vkCreateInstance");
+
+        uint32_t queueFamily = pickDevice();
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+        deviceName = properties.deviceName;
+        maxGroups = properties.limits.maxComputeWorkGroupCount[0];
+
+        float priority = 1.0f;
+        VkDeviceQueueCreateInfo queueInfo{};
+        queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueInfo.queueFamilyIndex = queueFamily;
+        queueInfo.queueCount = 1;
+        queueInfo.pQueuePriorities = &priority;
+        VkDeviceCreateInfo deviceInfo{};
+        deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        deviceInfo.queueCreateInfoCount = 1;
+        deviceInfo.pQueueCreateInfos = &queueInfo;
+        check(vkCreateDevice(physicalDevice, &deviceInfo, nullptr, &device), "vkCreateDevice");
+        vkGetDeviceQueue(device, queueFamily, 0, &queue);
+
+        createBuffer(jobBuffers[Midstate], sizeof(uint32_t) * 8);
+        createBuffer(jobBuffers[Tail], sizeof(uint32_t) * 4);
+        createBuffer(jobBuffers[Target], sizeof(uint32_t) * 8);
+        for (Slot& slot : slots) {
+            createBuffer(slot.result, sizeof(GpuResult));
+            createBuffer(slot.nonceBase, sizeof(uint32_t) * 2);   // nonceBase, nonceCount
+        }
+
+        createPipeline();
+
+        VkDescriptorPoolSize poolSize{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, BufferCount * (uint32_t)gpuPipelineDepth};
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.maxSets = (uint32_t)gpuPipelineDepth;
+        poolInfo.poolSizeCount = 1;
+        poolInfo.pPoolSizes = &poolSize;
+        check(vkCreateDescriptorPool(device, &poolInfo, nullptr, &descriptorPool), "vkCreateDescriptorPool");
+        for (Slot& slot : slots) {
+            VkDescriptorSetAllocateInfo setInfo{};
+            setInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            setInfo.descriptorPool = descriptorPool;
+            setInfo.descriptorSetCount = 1;
+            setInfo.pSetLayouts = &setLayout;
+            check(vkAllocateDescriptorSets(device, &setInfo, &slot.descriptorSet), "vkAllocateDescriptorSets");
+
+            const HostBuffer* bound[BufferCount] = {&jobBuffers[Midstate], &jobBuffers[Tail], &jobBuffers[Target],
+                                                    &slot.result, &slot.nonceBase};
+            VkDescriptorBufferInfo bufferInfos[BufferCount];
+            VkWriteDescriptorSet writes[BufferCount];
+            for (uint32_t i = 0; i < BufferCount; i++) {
+                bufferInfos[i] = {bound[i]->buffer, 0, VK_WHOLE_SIZE};
+                writes[i] = {};
+                writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writes[i].dstSet = slot.descriptorSet;
+                writes[i].dstBinding = i;
+                writes[i].descriptorCount = 1;
+                writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                writes[i].pBufferInfo = &bufferInfos[i];
+            }
+            vkUpdateDescriptorSets(device, BufferCount, writes, 0, nullptr);
+        }
+
+        VkCommandPoolCreateInfo commandPoolInfo{};
+        commandPoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        commandPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        commandPoolInfo.queueFamilyIndex = queueFamily;
+        check(vkCreateCommandPool(device, &commandPoolInfo, nullptr, &commandPool), "vkCreateCommandPool");
+        VkCommandBufferAllocateInfo commandInfo{};
+        commandInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        commandInfo.commandPool = commandPool;
+        commandInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        commandInfo.commandBufferCount = 1;
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        for (Slot& slot : slots) {
+            check(vkAllocateCommandBuffers(device, &commandInfo, &slot.commandBuffer), "vkAllocateCommandBuffers");
+            check(vkCreateFence(device, &fenceInfo, nullptr, &slot.fence), "vkCreateFence");
+        }
+    }
+
+    // Discrete GPU, then integrated, then anything with a compute queue
+    uint32_t pickDevice() {
+        uint32_t count = 0;
+        check(vkEnumeratePhysicalDevices(instance, &count, nullptr), "vkEnumeratePhysicalDevices");
+        std::vector<VkPhysicalDevice> devices(count);
+        check(vkEnumeratePhysicalDevices(instance, &count, devices.data()), "vkEnumeratePhysicalDevices");
+
+        auto computeFamily = [](VkPhysicalDevice candidate) -> int {
+            uint32_t familyCount = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(candidate, &familyCount, nullptr);
+            std::vector<VkQueueFamilyProperties> families(familyCount);
+            vkGetPhysicalDeviceQueueFamilyProperties(candidate, &familyCount, families.data());
+            for (uint32_t i = 0; i < familyCount; i++)
+                if (families[i].queueFlags & VK_QUEUE_COMPUTE_BIT) return (int)i;
+            return -1;
+        };
+
+        if (const char* forced = std::getenv("MINER_VULKAN_DEVICE")) {
+            size_t index = std::strtoul(forced, nullptr, 10);
+            if (index >= devices.size() || computeFamily(devices[index]) < 0)
+                throw std::runtime_error("Vulkan: MINER_VULKAN_DEVICE=" + std::string(forced) +
+                                         " is not a device with a compute queue");
+            physicalDevice = devices[index];
+            return (uint32_t)computeFamily(physicalDevice);
+        }
+
+        int bestRank = -1;
+        for (VkPhysicalDevice candidate : devices) {
+            if (computeFamily(candidate) < 0) continue;
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(candidate, &properties);
+            int rank = properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU ? 2
+                     : properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU ? 1 : 0;
+            if (rank > bestRank) {
+                bestRank = rank;
+                physicalDevice = candidate;
+            }
+        }
+        if (bestRank < 0) throw std::runtime_error("Vulkan: no device with a compute queue");
+        return (uint32_t)computeFamily(physicalDevice);
+    }
+
+    void createBuffer(HostBuffer& out, VkDeviceSize size) {
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = size;
+        bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        check(vkCreateBuffer(device, &bufferInfo, nullptr, &out.buffer), "vkCreateBuffer");
+
+        VkMemoryRequirements requirements;
+        vkGetBufferMemoryRequirements(device, out.buffer, &requirements);
+        VkPhysicalDeviceMemoryProperties memory;
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memory);
+        const VkMemoryPropertyFlags wanted = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        uint32_t type = UINT32_MAX;
+        for (uint32_t i = 0; i < memory.memoryTypeCount && type == UINT32_MAX; i++)
+            if ((requirements.memoryTypeBits & (1u << i)) && (memory.memoryTypes[i].propertyFlags & wanted) == wanted)
+                type = i;
+        if (type == UINT32_MAX) throw std::runtime_error("Vulkan: no host-visible coherent memory");
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = requirements.size;
+        allocInfo.memoryTypeIndex = type;
+        check(vkAllocateMemory(device, &allocInfo, nullptr, &out.memory), "vkAllocateMemory");
+        check(vkBindBufferMemory(device, out.buffer, out.memory, 0), "vkBindBufferMemory");
+        void* mapped = nullptr;
+        check(vkMapMemory(device, out.memory, 0, VK_WHOLE_SIZE, 0, &mapped), "vkMapMemory");
+        out.mapped = static_cast<uint32_t*>(mapped);
+    }
+
+    void createPipeline() {
+        std::vector<uint32_t> code = readShader();
+        VkShaderModuleCreateInfo shaderInfo{};
+        shaderInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        shaderInfo.codeSize = code.size() * sizeof(uint32_t);
+        shaderInfo.pCode = code.data();
+        check(vkCreateShaderModule(device, &shaderInfo, nullptr, &shader), "vkCreateShaderModule");
+
+        VkDescriptorSetLayoutBinding bindings[BufferCount];
+        for (uint32_t i = 0; i < BufferCount; i++) {
+            bindings[i] = {};
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = BufferCount;
+        layoutInfo.pBindings = bindings;
+        check(vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &setLayout), "vkCreateDescriptorSetLayout");
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &setLayout;
+        check(vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &pipelineLayout), "vkCreatePipelineLayout");
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = shader;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.layout = pipelineLayout;
+        check(vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline),
+              "vkCreateComputePipelines");
+    }
+
+    // Only called while the slot is idle, once its fence has signalled
+    void recordDispatch(Slot& slot, uint32_t groups) {
+        VkCommandBuffer commandBuffer = slot.commandBuffer;
+        check(vkResetCommandBuffer(commandBuffer, 0), "vkResetCommandBuffer");
+        VkCommandBufferBeginInfo begin{};
+        begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        check(vkBeginCommandBuffer(commandBuffer, &begin), "vkBeginCommandBuffer");
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1,
+                                &slot.descriptorSet, 0, nullptr);
+        vkCmdDispatch(commandBuffer, groups, 1, 1);
+
+        // Make the shader's candidate writes visible to the host once the fence signals
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+        check(vkEndCommandBuffer(commandBuffer), "vkEndCommandBuffer");
+        slot.recordedGroups = groups;
+    }
+
+    void release() {
+        if (device) vkDeviceWaitIdle(device);
+        for (Slot& slot : slots)
+            if (slot.fence) vkDestroyFence(device, slot.fence, nullptr);
+        if (commandPool) vkDestroyCommandPool(device, commandPool, nullptr);
+        if (descriptorPool) vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+        if (pipeline) vkDestroyPipeline(device, pipeline, nullptr);
+        if (pipelineLayout) vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
+        if (setLayout) vkDestroyDescriptorSetLayout(device, setLayout, nullptr);
+        if (shader) vkDestroyShaderModule(device, shader, nullptr);
+        auto destroy = [&](HostBuffer& b) {
+            if (b.buffer) vkDestroyBuffer(device, b.buffer, nullptr);
+            if (b.memory) vkFreeMemory(device, b.memory, nullptr);   // also unmaps
+        };
+        for (HostBuffer& b : jobBuffers) destroy(b);
+        for (Slot& slot : slots) {
+            destroy(slot.result);
+            destroy(slot.nonceBase);
+        }
+        if (device) vkDestroyDevice(device, nullptr);
+        if (instance) vkDestroyInstance(instance, nullptr);
+    }
+};
+
+std::unique_ptr<MiningSession> makeVulkanSession() {
+    return std::make_unique<VulkanSession>();
+}
@@ -0,0 +1,13 @@
+#ifndef VULKAN_MINER_HPP
+#define VULKAN_MINER_HPP
+
+#include "mining_session.hpp"
+#include <memory>
+
+// MiningSession on a Vulkan compute queue: the first discrete or integrated GPU,
+// otherwise any device (e.g. Mesa's lavapipe CPU driver); MINER_VULKAN_DEVICE
+// picks one by index. The SPIR-V is read from mineKernel.spv, or
+// MINER_VULKAN_SHADER. Throws std::runtime_error if Vulkan setup fails.
+std::unique_ptr<MiningSession> makeVulkanSession();
+
+#endif // VULKAN_MINER_HPP
@@ -0,0 +1,48 @@
+#include "worker_pool.hpp"
+
+WorkerPool::WorkerPool(unsigned workers) {
+    for (unsigned i = 0; i < workers; ++i)
+        threads.emplace_back([this, i] { workerLoop(i); });
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& t : threads) t.join();
+}
+
+void WorkerPool::run(const std::function<void(unsigned)>& fn) {
+    std::unique_lock<std::mutex> lock(mutex);
+    task = &fn;
+    pending = size();
+    error = nullptr;
+    ++generation;
+    wake.notify_all();
+    done.wait(lock, [this] { return pending == 0; });
+    task = nullptr;
+    if (error) std::rethrow_exception(error);
+}
+
+void WorkerPool::workerLoop(unsigned index) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wake.wait(lock, [&] { return stopping || generation != seen; });
+        if (stopping) return;
+        seen = generation;
+        const std::function<void(unsigned)>* fn = task;
+        lock.unlock();
+        std::exception_ptr failure;
+        try {
+            (*fn)(index);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        lock.lock();
+        if (failure && !error) error = failure;
+        if (--pending == 0) done.notify_one();
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads that sleep between tasks. run() hands every worker the same task
+// and returns once all of them have finished it.
+class WorkerPool {
+public:
+    explicit WorkerPool(unsigned workers);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    unsigned size() const { return (unsigned)threads.size(); }
+
+    // Runs task(i) on worker i for every worker; rethrows the first exception.
+    // One task at a time: callers sharing a pool must not call run() concurrently.
+    void run(const std::function<void(unsigned)>& fn);
+
+private:
+    void workerLoop(unsigned index);
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake, done;
+    const std::function<void(unsigned)>* task = nullptr;
+    uint64_t generation = 0;
+    unsigned pending = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+};
+
+#endif // WORKER_POOL_HPP